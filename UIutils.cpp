@@ -78,3 +78,19 @@ HarmonicList UIutils::jsonToHarmonicList(const QString& jsonStr)
     }
     return list;
 }
+
+QString UIutils::formatSimulationTime(std::chrono::nanoseconds time)
+{
+    using namespace std::chrono;
+    const auto totalMs = duration_cast<milliseconds>(time).count();
+    const long long hours = totalMs / 3'600'000;
+    const int minutes = static_cast<int>((totalMs / 60'000) % 60);
+    const int seconds = static_cast<int>((totalMs / 1000) % 60);
+    const int ms = static_cast<int>(totalMs % 1000);
+
+    return QString("%1:%2:%3.%4")
+        .arg(hours, 2, 10, QChar('0'))
+        .arg(minutes, 2, 10, QChar('0'))
+        .arg(seconds, 2, 10, QChar('0'))
+        .arg(ms, 3, 10, QChar('0'));
+}
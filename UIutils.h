@@ -3,6 +3,7 @@
 
 #include "UIconfig.h"
 #include "shared_data_types.h"
+#include <chrono>
 
 class UIutils
 {
@@ -13,6 +14,9 @@ public:
     // double 값을 유효 숫자 4자리로 포맷팅하여 반환(예: 12.34, 1.234, 0.123)
     static QString formatValue(double value);
 
+    // 시뮬레이션 경과 시간을 "HH:mm:ss.zzz" 형식으로 변환 (시간은 24를 넘을 수 있음)
+    static QString formatSimulationTime(std::chrono::nanoseconds time);
+
     // 고조파 리스트 <-> JSON 문자열 변환
     static QString harmonicListToJson(const HarmonicList& list);
     static HarmonicList jsonToHarmonicList(const QString& jsonStr);
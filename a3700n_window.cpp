@@ -105,7 +105,7 @@ void A3700N_Window::createAndAddPage(
     submenu->addItem(submenuName); // 메뉴 이름 설정
 }
 
-void A3700N_Window::updateSummaryData(const OneSecondSummaryData& data)
+void A3700N_Window::updateSummaryData(const OneSecondSummarySnapshot& data)
 {
     emit summaryDataUpdated(data);
 }
@@ -115,6 +115,11 @@ void A3700N_Window::updateDemandData(const DemandData& data)
     emit demandDataUpdated(data);
 }
 
+void A3700N_Window::updateHarmonicGroups(const HarmonicGroupResult& result)
+{
+    emit harmonicGroupsUpdated(result);
+}
+
 void A3700N_Window::createVoltagePage(QListWidget* submenu, QStackedWidget* contentsStack)
 {
     const std::vector<PageConfig> pageConfigs = {
@@ -245,6 +250,8 @@ void A3700N_Window::createAnalysisPage(QListWidget* submenu, QStackedWidget* sta
     AnalysisHarmonicPage* harmonicsPage = new AnalysisHarmonicPage(this);
 
     connect(this, &A3700N_Window::summaryDataUpdated, harmonicsPage, &AnalysisHarmonicPage::onOneSecondDataUpdated);
+    connect(this, &A3700N_Window::harmonicGroupsUpdated, harmonicsPage, &AnalysisHarmonicPage::onHarmonicGroupsUpdated);
+    connect(harmonicsPage, &AnalysisHarmonicPage::harmonicGroupsToggled, this, &A3700N_Window::harmonicGroupAnalysisToggled);
     stack->addWidget(harmonicsPage);
     submenu->addItem("Harmonics");
 
@@ -4,6 +4,7 @@
 #include <QWidget>
 #include "demand_data.h"
 #include "measured_data.h"
+#include "harmonic_group_analyzer.h"
 
 class QListWidget;
 class QStackedWidget;
@@ -21,12 +22,15 @@ public:
     explicit A3700N_Window(QWidget *parent = nullptr);
 
 public slots:
-    void updateSummaryData(const OneSecondSummaryData& data);
+    void updateSummaryData(const OneSecondSummarySnapshot& data);
     void updateDemandData(const DemandData& data);
+    void updateHarmonicGroups(const HarmonicGroupResult& result);
 
 signals:
-    void summaryDataUpdated(const OneSecondSummaryData& data);
+    void summaryDataUpdated(const OneSecondSummarySnapshot& data);
     void demandDataUpdated(const DemandData& data);
+    void harmonicGroupsUpdated(const HarmonicGroupResult& result);
+    void harmonicGroupAnalysisToggled(bool enabled); // Harmonics 페이지의 그룹 모드 체크박스
 
 private:
     void setupUi();
@@ -0,0 +1,267 @@
+#include "adc_front_end.h"
+#include "config.h"
+#include <algorithm>
+#include <cmath>
+#include <numbers>
+
+namespace {
+    // Paul Kellet의 3극 핑크 잡음 필터 (단위 분산 백색 입력에 대한 출력 표준편차로 정규화)
+    struct PinkFilter {
+        static constexpr std::array<double, 3> Pole = {0.99765, 0.96300, 0.57000};
+        static constexpr std::array<double, 3> Gain = {0.0990460, 0.2965164, 1.0526913};
+        static constexpr double Direct = 0.1848;
+        static constexpr double OutputStdDev = 2.979014;
+    };
+
+    uint64_t rotl(uint64_t x, int k)
+    {
+        return (x << k) | (x >> (64 - k));
+    }
+
+    // Marsaglia-Tsang 지구라트 표 (128층). 대부분의 샘플은 비교 한 번과 곱셈 한 번으로 끝남
+    struct ZigguratTables {
+        static constexpr int Layers = 128;
+        static constexpr double R = 3.442619855899;        // 가장 바깥 층 경계
+        static constexpr double Area = 9.91256303526217e-3; // 층당 넓이
+        static constexpr double Scale = 2147483648.0;      // 2^31
+
+        std::array<uint32_t, Layers> k{};
+        std::array<double, Layers> w{};
+        std::array<double, Layers> f{};
+
+        ZigguratTables()
+        {
+            double d = R;
+            double t = d;
+            const double q = Area / std::exp(-0.5 * d * d);
+            k[0] = static_cast<uint32_t>((d / q) * Scale);
+            k[1] = 0;
+            w[0] = q / Scale;
+            w[Layers - 1] = d / Scale;
+            f[0] = 1.0;
+            f[Layers - 1] = std::exp(-0.5 * d * d);
+            for(int i = Layers - 2; i >= 1; --i) {
+                d = std::sqrt(-2.0 * std::log(Area / d + std::exp(-0.5 * d * d)));
+                k[i + 1] = static_cast<uint32_t>((d / t) * Scale);
+                t = d;
+                f[i] = std::exp(-0.5 * d * d);
+                w[i] = d / Scale;
+            }
+        }
+    };
+
+    const ZigguratTables& ziggurat()
+    {
+        static const ZigguratTables tables;
+        return tables;
+    }
+
+    // |x| < 2^51에서 현재 반올림 모드(최근접 짝수)로 정수화. 라이브러리 호출 없이 덧셈 두 번
+    double roundToInteger(double x)
+    {
+        constexpr double Magic = 6755399441055744.0; // 1.5 * 2^52
+        return (x + Magic) - Magic;
+    }
+}
+
+// ---- Xoshiro256 ----
+
+void AdcFrontEnd::Xoshiro256::seed(uint64_t value)
+{
+    // splitmix64로 상태 확장 (0 상태 방지)
+    for(auto& word : state) {
+        value += 0x9e3779b97f4a7c15ULL;
+        uint64_t z = value;
+        z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ULL;
+        z = (z ^ (z >> 27)) * 0x94d049bb133111ebULL;
+        word = z ^ (z >> 31);
+    }
+}
+
+double AdcFrontEnd::Xoshiro256::nextGaussian()
+{
+    const ZigguratTables& z = ziggurat();
+    while(true) {
+        const auto hz = static_cast<int32_t>(next() >> 32);
+        const int iz = hz & (ZigguratTables::Layers - 1);
+        const uint32_t magnitude = static_cast<uint32_t>(hz < 0 ? -static_cast<int64_t>(hz) : hz);
+        const double x = hz * z.w[iz];
+        if(magnitude < z.k[iz]) {
+            return x; // 층 안쪽 (대부분)
+        }
+        if(iz == 0) {
+            // 꼬리: R 바깥은 지수 분포로 샘플링
+            double tailX;
+            double tailY;
+            do {
+                tailX = -std::log(1.0 - nextDouble()) / ZigguratTables::R;
+                tailY = -std::log(1.0 - nextDouble());
+            } while(tailY + tailY < tailX * tailX);
+            return (hz > 0) ? ZigguratTables::R + tailX : -ZigguratTables::R - tailX;
+        }
+        // 층 경계의 쐐기 영역: 밀도 함수와 직접 비교
+        if(z.f[iz] + nextDouble() * (z.f[iz - 1] - z.f[iz]) < std::exp(-0.5 * x * x)) {
+            return x;
+        }
+    }
+}
+
+uint64_t AdcFrontEnd::Xoshiro256::next()
+{
+    const uint64_t result = state[0] + state[3];
+    const uint64_t t = state[1] << 17;
+    state[2] ^= state[0];
+    state[3] ^= state[1];
+    state[1] ^= state[2];
+    state[0] ^= state[3];
+    state[2] ^= t;
+    state[3] = rotl(state[3], 45);
+    return result;
+}
+
+// ---- AdcFrontEnd ----
+
+AdcFrontEnd::Settings AdcFrontEnd::defaultSettings()
+{
+    using C = config::Adc;
+    Settings settings;
+    settings.bits = C::DefaultBits;
+    settings.voltageFullScale = C::VoltageFullScale;
+    settings.currentFullScale = C::CurrentFullScale;
+
+    // 상마다 다른 오차가 있어야 불평형/대칭 성분 알고리즘의 반응을 볼 수 있음
+    constexpr std::array<double, 3> gainSign = {1.0, -1.0, 0.5};
+    for(int phase{0}; phase < 3; ++phase) {
+        ChannelError& voltage = settings.channels[VoltageA + phase];
+        voltage.gain = 1.0 + gainSign[phase] * C::DefaultGainError;
+        voltage.whiteNoiseRms = C::VoltageNoiseRms;
+        voltage.pinkNoiseRms = C::VoltageNoiseRms * C::PinkNoiseRatio;
+
+        ChannelError& current = settings.channels[CurrentA + phase];
+        current.gain = 1.0 - gainSign[phase] * C::DefaultGainError;
+        current.whiteNoiseRms = C::CurrentNoiseRms;
+        current.pinkNoiseRms = C::CurrentNoiseRms * C::PinkNoiseRatio;
+    }
+    return settings;
+}
+
+AdcFrontEnd::AdcFrontEnd(uint64_t seed)
+    : m_settings(defaultSettings())
+    , m_noise(config::Adc::NoiseBlockSize * ChannelCount)
+    , m_gaussian(2 * config::Adc::NoiseBlockSize * ChannelCount)
+{
+    m_rng.seed(seed);
+    updateDerived();
+    reset();
+}
+
+void AdcFrontEnd::setSettings(const Settings& settings)
+{
+    m_settings = settings;
+    updateDerived();
+    m_noiseIndex = m_noise.size(); // 새 잡음 크기로 다음 샘플에서 다시 생성
+}
+
+void AdcFrontEnd::setTiming(double sampleRateHz, double fundamentalHz)
+{
+    m_samplesPerRadian = (fundamentalHz > 0.0) ? sampleRateHz / (2.0 * std::numbers::pi * fundamentalHz) : 0.0;
+    updateDerived();
+}
+
+void AdcFrontEnd::reset()
+{
+    m_hasPrevious = false;
+    for(auto& state : m_pinkState) {
+        state.fill(0.0);
+    }
+    m_noiseIndex = m_noise.size();
+}
+
+void AdcFrontEnd::updateDerived()
+{
+    const int bits = std::clamp(m_settings.bits, 0, 32);
+    for(int ch{0}; ch < ChannelCount; ++ch) {
+        const ChannelError& error = m_settings.channels[ch];
+        // 위상 지연(도) -> 샘플 지연. 선형 보간이므로 ±1샘플로 제한
+        const double delay = utils::degreesToRadians(error.phaseErrorDeg) * m_samplesPerRadian;
+        m_delay[ch] = std::clamp(delay, -1.0, 1.0);
+
+        const double fullScale = (ch < CurrentA) ? m_settings.voltageFullScale : m_settings.currentFullScale;
+        if(bits == 0 || fullScale <= 0.0) {
+            m_lsb[ch] = 0.0;
+            continue;
+        }
+        // 양극성 2의 보수 코드: [-2^(n-1), 2^(n-1) - 1]
+        const double halfCodes = std::ldexp(1.0, bits - 1);
+        m_lsb[ch] = fullScale / halfCodes;
+        m_inverseLsb[ch] = halfCodes / fullScale;
+        m_minCode[ch] = -halfCodes;
+        m_maxCode[ch] = halfCodes - 1.0;
+    }
+}
+
+void AdcFrontEnd::refillNoise()
+{
+    // 1. 표준 정규 난수 블록
+    for(double& value : m_gaussian) {
+        value = m_rng.nextGaussian();
+    }
+
+    // 2. 채널별 백색 + 핑크 잡음 (핑크 필터 상태는 블록 사이에 이어짐)
+    std::array<double, ChannelCount> whiteRms;
+    std::array<double, ChannelCount> pinkRms;
+    for(int ch{0}; ch < ChannelCount; ++ch) {
+        whiteRms[ch] = m_settings.channels[ch].whiteNoiseRms;
+        pinkRms[ch] = m_settings.channels[ch].pinkNoiseRms / PinkFilter::OutputStdDev;
+    }
+
+    // 앞 절반은 핑크 필터 입력, 뒤 절반은 백색 성분 (서로 독립)
+    const double* pinkInput = m_gaussian.data();
+    const double* whiteInput = m_gaussian.data() + m_noise.size();
+    for(size_t sample = 0; sample < config::Adc::NoiseBlockSize; ++sample) {
+        const size_t offset = sample * ChannelCount;
+        double* noise = &m_noise[offset];
+        for(int ch{0}; ch < ChannelCount; ++ch) {
+            const double w = pinkInput[offset + ch];
+            auto& state = m_pinkState[ch];
+            state[0] = PinkFilter::Pole[0] * state[0] + PinkFilter::Gain[0] * w;
+            state[1] = PinkFilter::Pole[1] * state[1] + PinkFilter::Gain[1] * w;
+            state[2] = PinkFilter::Pole[2] * state[2] + PinkFilter::Gain[2] * w;
+            const double pink = state[0] + state[1] + state[2] + PinkFilter::Direct * w;
+            noise[ch] = whiteRms[ch] * whiteInput[offset + ch] + pinkRms[ch] * pink;
+        }
+    }
+    m_noiseIndex = 0;
+}
+
+void AdcFrontEnd::process(Frame& frame)
+{
+    if(m_noiseIndex >= m_noise.size()) {
+        refillNoise();
+    }
+    const double* noise = &m_noise[m_noiseIndex];
+    m_noiseIndex += ChannelCount;
+
+    if(!m_hasPrevious) {
+        m_previous = frame;
+        m_hasPrevious = true;
+    }
+
+    for(int ch{0}; ch < ChannelCount; ++ch) {
+        const double x = frame[ch];
+        const ChannelError& error = m_settings.channels[ch];
+
+        // 지연 d: x[n] - d (x[n] - x[n-1])
+        double y = x - m_delay[ch] * (x - m_previous[ch]);
+        m_previous[ch] = x;
+
+        y = error.gain * y + error.offset + noise[ch];
+
+        if(m_lsb[ch] > 0.0) {
+            // 범위를 먼저 제한해 반올림 트릭의 유효 범위(|x| < 2^51) 안에 둠
+            const double code = roundToInteger(std::clamp(y * m_inverseLsb[ch], m_minCode[ch], m_maxCode[ch]));
+            y = code * m_lsb[ch];
+        }
+        frame[ch] = y;
+    }
+}
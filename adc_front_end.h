@@ -0,0 +1,84 @@
+#ifndef ADC_FRONT_END_H
+#define ADC_FRONT_END_H
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+// AdcFrontEnd 클래스
+// 이상적인 생성 신호에 실제 계측 전단의 오차를 더함 (채널: 전압 A/B/C, 전류 A/B/C).
+//  - 위상 오차: 기본파 기준 각도를 시간 지연으로 바꿔 직전 샘플과 선형 보간
+//  - 이득/오프셋 오차, 백색 + 1/f(핑크) 가우시안 잡음
+//  - 비트 수와 입력 범위에 따른 양자화 및 클리핑
+// 잡음은 xoshiro256+ 와 지구라트 정규 난수로 NoiseBlockSize 샘플씩 미리 만들어 두고(핑크 필터 포함),
+// 샘플마다는 보간, 곱셈/덧셈, 반올림만 수행.
+class AdcFrontEnd
+{
+public:
+    enum Channel { VoltageA, VoltageB, VoltageC, CurrentA, CurrentB, CurrentC, ChannelCount };
+    using Frame = std::array<double, ChannelCount>;
+
+    struct ChannelError {
+        double gain = 1.0;          // 이득 (1 + 오차)
+        double offset = 0.0;        // 직류 오프셋 (V/A)
+        double phaseErrorDeg = 0.0; // 기본파 기준 위상 지연 (도, 음수면 앞섬)
+        double whiteNoiseRms = 0.0;
+        double pinkNoiseRms = 0.0;
+    };
+
+    struct Settings {
+        int bits = 0;                 // 0이면 양자화 안 함
+        double voltageFullScale = 0.0;
+        double currentFullScale = 0.0;
+        std::array<ChannelError, ChannelCount> channels{};
+    };
+    // config::Adc 기준 기본 오차 (상마다 이득 오차 부호가 다름)
+    static Settings defaultSettings();
+
+    explicit AdcFrontEnd(uint64_t seed);
+
+    void setSettings(const Settings& settings);
+    const Settings& settings() const { return m_settings; }
+    // 위상 오차를 샘플 지연으로 바꾸기 위한 샘플링/기본 주파수
+    void setTiming(double sampleRateHz, double fundamentalHz);
+    void reset(); // 지연/핑크 필터 상태 초기화 (난수열은 이어짐)
+
+    // 한 프레임을 제자리에서 변환
+    void process(Frame& frame);
+
+private:
+    // xoshiro256+ (상위 53비트로 [0, 1) 실수 생성)
+    struct Xoshiro256 {
+        std::array<uint64_t, 4> state;
+        void seed(uint64_t value);
+        uint64_t next();
+        double nextDouble() { return (next() >> 11) * 0x1.0p-53; }
+        double nextGaussian(); // 지구라트 방식 표준 정규 난수
+    };
+
+    void updateDerived();
+    void refillNoise();
+
+    Settings m_settings;
+    Xoshiro256 m_rng;
+
+    // 설정에서 파생된 샘플별 계수
+    Frame m_delay{};        // 지연 (샘플, -1 ~ 1)
+    Frame m_lsb{};          // 0이면 양자화 안 함
+    Frame m_inverseLsb{};
+    Frame m_minCode{};
+    Frame m_maxCode{};
+    double m_samplesPerRadian = 0.0;
+
+    Frame m_previous{};
+    bool m_hasPrevious = false;
+
+    // 채널 교차 배치 잡음 블록 [샘플][채널] (백색 + 핑크, 채널별 RMS 적용 완료)
+    std::vector<double> m_noise;
+    size_t m_noiseIndex = 0;
+    std::vector<double> m_gaussian; // 블록 생성용 표준 정규 난수 (핑크 입력 + 백색)
+    std::array<std::array<double, 3>, ChannelCount> m_pinkState{};
+};
+
+#endif // ADC_FRONT_END_H
@@ -2,6 +2,7 @@
 #include <QTableWidget>
 #include <QVBoxLayout>
 #include <QHeaderView>
+#include <cmath>
 
 AdditionalMetricsWindow::AdditionalMetricsWindow(QWidget *parent) : QWidget(parent)
 {
@@ -28,6 +29,7 @@ void AdditionalMetricsWindow::setupUi()
     setupHeaderRow(MetricsRow::HeaderSymmetrical, "▼ 대칭 성분 분석");
     setupHeaderRow(MetricsRow::HeaderNemaUnbalance, "▼ NEMA Unbalance");
     setupHeaderRow(MetricsRow::HeaederU0U2Unbalance, "▼ U0U2 Unbalance");
+    setupHeaderRow(MetricsRow::HeaderFlicker, "▼ Flicker");
 
     m_tableWidget->horizontalHeader()->setSectionResizeMode(MetricsCol::Title, QHeaderView::ResizeToContents);
     m_tableWidget->horizontalHeader()->setSectionResizeMode(MetricsCol::Voltage, QHeaderView::Stretch);
@@ -60,6 +62,9 @@ void AdditionalMetricsWindow::setupUi()
     m_tableWidget->setItem(MetricsRow::NemaUnbalance, MetricsCol::Title, new QTableWidgetItem("Unbal"));
     m_tableWidget->setItem(MetricsRow::U0Unbalance, MetricsCol::Title, new QTableWidgetItem("U0 Unbalance (%)"));
     m_tableWidget->setItem(MetricsRow::U2Unbalance, MetricsCol::Title, new QTableWidgetItem("U2 Unbalance (%)"));
+    m_tableWidget->setItem(MetricsRow::FlickerPinst, MetricsCol::Title, new QTableWidgetItem("Pinst (A/B/C)"));
+    m_tableWidget->setItem(MetricsRow::FlickerPst, MetricsCol::Title, new QTableWidgetItem("Pst (A/B/C)"));
+    m_tableWidget->setItem(MetricsRow::FlickerPlt, MetricsCol::Title, new QTableWidgetItem("Plt (A/B/C)"));
 
     // 초기값 아이템 생성
     for(int row{0}; row < MetricsRow::RowCount; ++row) {
@@ -90,14 +95,19 @@ void AdditionalMetricsWindow::setupUi()
     m_tableWidget->item(MetricsRow::PowerFactorB, MetricsCol::Current)->setText("");
     m_tableWidget->item(MetricsRow::PowerFactorC, MetricsCol::Current)->setText("");
     m_tableWidget->item(MetricsRow::TotalPowerFactor, MetricsCol::Current)->setText("");
+    m_tableWidget->item(MetricsRow::FlickerPinst, MetricsCol::Current)->setText("");
+    m_tableWidget->item(MetricsRow::FlickerPst, MetricsCol::Current)->setText("");
+    m_tableWidget->item(MetricsRow::FlickerPlt, MetricsCol::Current)->setText("");
 
     auto mainLayout = new QVBoxLayout(this);
     mainLayout->addWidget(m_tableWidget);
     setLayout(mainLayout);
 }
 
-void AdditionalMetricsWindow::updateData(const OneSecondSummaryData& data)
+void AdditionalMetricsWindow::updateData(const OneSecondSummarySnapshot& snapshot)
 {
+    if(!snapshot) return;
+    const OneSecondSummaryData& data = *snapshot;
 
     // 잔류 정보 표시
     m_tableWidget->item(MetricsRow::ResidualRms, MetricsCol::Voltage)
@@ -160,4 +170,13 @@ void AdditionalMetricsWindow::updateData(const OneSecondSummaryData& data)
     m_tableWidget->item(MetricsRow::U0Unbalance, MetricsCol::Current)->setText(QString::number(data.currentU0Unbalance, 'f', 3));
     m_tableWidget->item(MetricsRow::U2Unbalance, MetricsCol::Voltage)->setText(QString::number(data.voltageU2Unbalance, 'f', 3));
     m_tableWidget->item(MetricsRow::U2Unbalance, MetricsCol::Current)->setText(QString::number(data.currentU2Unbalance, 'f', 3));
+
+    // 플리커 (관측 구간이 차기 전의 NaN은 "-"로 표시)
+    const auto flickerText = [](const PhaseData& value) {
+        const auto format = [](double v) { return std::isnan(v) ? QString("-") : QString::number(v, 'f', 3); };
+        return QString("%1 / %2 / %3").arg(format(value.a), format(value.b), format(value.c));
+    };
+    m_tableWidget->item(MetricsRow::FlickerPinst, MetricsCol::Voltage)->setText(flickerText(data.flickerPinst));
+    m_tableWidget->item(MetricsRow::FlickerPst, MetricsCol::Voltage)->setText(flickerText(data.flickerPst));
+    m_tableWidget->item(MetricsRow::FlickerPlt, MetricsCol::Voltage)->setText(flickerText(data.flickerPlt));
 }
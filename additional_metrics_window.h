@@ -38,6 +38,10 @@ enum {
     HeaederU0U2Unbalance,
     U0Unbalance,
     U2Unbalance,
+    HeaderFlicker,
+    FlickerPinst,
+    FlickerPst,
+    FlickerPlt,
     RowCount
     };
 }
@@ -57,7 +61,7 @@ public:
     explicit AdditionalMetricsWindow(QWidget* parent = nullptr);
 
 public slots:
-    void updateData(const OneSecondSummaryData& data);
+    void updateData(const OneSecondSummarySnapshot& snapshot);
 private:
     void setupUi();
 
@@ -0,0 +1,190 @@
+#include "aggregation_engine.h"
+#include "config.h"
+#include <cmath>
+
+void AggregationEngine::Accumulator::addCycle(const MeasuredData& data, Nanoseconds cycleStart, double cycleDurationSec)
+{
+    if(cycleCount == 0) {
+        startTime = cycleStart;
+    }
+    endTime = data.timestamp;
+
+    const std::array<double, 3> v = {data.voltageRms.a, data.voltageRms.b, data.voltageRms.c};
+    const std::array<double, 3> v_ll = {data.voltageRms_ll.ab, data.voltageRms_ll.bc, data.voltageRms_ll.ca};
+    const std::array<double, 3> i = {data.currentRms.a, data.currentRms.b, data.currentRms.c};
+    const std::array<double, 3> p = {data.activePower.a, data.activePower.b, data.activePower.c};
+
+    for(int k{0}; k < 3; ++k) {
+        voltageRmsSumSq[k] += v[k] * v[k];
+        voltageRmsSumSq_ll[k] += v_ll[k] * v_ll[k];
+        currentRmsSumSq[k] += i[k] * i[k];
+        activePowerSum[k] += p[k];
+    }
+
+    // 첫 사이클은 길이를 알 수 없으므로 주파수 계산에서 제외
+    if(cycleDurationSec > 0.0) {
+        fundamentalCycles += data.fundamentalVoltage.a.order;
+        durationSec += cycleDurationSec;
+    }
+    ++cycleCount;
+}
+
+void AggregationEngine::Accumulator::merge(const Accumulator& other)
+{
+    if(other.cycleCount == 0) return;
+
+    if(cycleCount == 0) {
+        startTime = other.startTime;
+    }
+    endTime = other.endTime;
+
+    for(int k{0}; k < 3; ++k) {
+        voltageRmsSumSq[k] += other.voltageRmsSumSq[k];
+        voltageRmsSumSq_ll[k] += other.voltageRmsSumSq_ll[k];
+        currentRmsSumSq[k] += other.currentRmsSumSq[k];
+        activePowerSum[k] += other.activePowerSum[k];
+    }
+    fundamentalCycles += other.fundamentalCycles;
+    durationSec += other.durationSec;
+    cycleCount += other.cycleCount;
+    flagged = flagged || other.flagged;
+}
+
+AggregatedData AggregationEngine::Accumulator::finalize(AggregationTier tier) const
+{
+    AggregatedData result;
+    result.tier = tier;
+    result.startTime = startTime;
+    result.endTime = endTime;
+    result.cycleCount = cycleCount;
+    result.flagged = flagged;
+
+    if(cycleCount == 0) return result;
+
+    const double N = static_cast<double>(cycleCount);
+    result.voltageRms = {std::sqrt(voltageRmsSumSq[0] / N), std::sqrt(voltageRmsSumSq[1] / N), std::sqrt(voltageRmsSumSq[2] / N)};
+    result.voltageRms_ll = {std::sqrt(voltageRmsSumSq_ll[0] / N), std::sqrt(voltageRmsSumSq_ll[1] / N), std::sqrt(voltageRmsSumSq_ll[2] / N)};
+    result.currentRms = {std::sqrt(currentRmsSumSq[0] / N), std::sqrt(currentRmsSumSq[1] / N), std::sqrt(currentRmsSumSq[2] / N)};
+    result.activePower = {activePowerSum[0] / N, activePowerSum[1] / N, activePowerSum[2] / N};
+    result.frequency = (durationSec > 0.0) ? fundamentalCycles / durationSec : 0.0;
+
+    return result;
+}
+
+AggregationEngine::AggregationEngine(QObject* parent)
+    : QObject{parent}
+    , m_nominalFrequency(config::Source::Frequency::Default)
+{
+    qRegisterMetaType<AggregatedData>();
+    reset();
+}
+
+void AggregationEngine::process(const MeasuredData& cycleData)
+{
+    Nanoseconds cycleStart = cycleData.timestamp;
+    double cycleDurationSec = 0.0;
+
+    if(m_hasLastTimestamp) {
+        cycleStart = m_lastTimestamp;
+        cycleDurationSec = std::chrono::duration<double>(cycleData.timestamp - m_lastTimestamp).count();
+    } else {
+        // 첫 입력 시점 기준으로 다음 RTC 경계 설정
+        m_nextTenMinuteTick = nextBoundary(cycleStart, config::Aggregation::TenMinuteInterval);
+        m_nextTwoHourTick = nextBoundary(cycleStart, config::Aggregation::TwoHourInterval);
+    }
+    m_lastTimestamp = cycleData.timestamp;
+    m_hasLastTimestamp = true;
+
+    m_base.addCycle(cycleData, cycleStart, cycleDurationSec);
+
+    if(m_base.cycleCount >= m_baseCycles) {
+        closeBaseWindow();
+    }
+}
+
+void AggregationEngine::flagCurrentInterval()
+{
+    m_base.flagged = true;
+}
+
+void AggregationEngine::setNominalFrequency(double frequency)
+{
+    m_nominalFrequency = frequency;
+    // 아직 사이클이 들어오지 않은 구간이면 바로 반영
+    if(m_base.cycleCount == 0) {
+        m_baseCycles = baseCyclesFor(frequency);
+    }
+}
+
+void AggregationEngine::reset()
+{
+    m_base = {};
+    m_shortInterval = {};
+    m_tenMinutes = {};
+    m_twoHours = {};
+    m_baseCycles = baseCyclesFor(m_nominalFrequency);
+    m_baseWindowsInShort = 0;
+    m_hasLastTimestamp = false;
+    m_lastTimestamp = Nanoseconds{0};
+    m_nextTenMinuteTick = Nanoseconds{0};
+    m_nextTwoHourTick = Nanoseconds{0};
+}
+
+int AggregationEngine::baseWindowCycles() const { return m_baseCycles; }
+
+void AggregationEngine::closeBaseWindow()
+{
+    // 1. 기본 구간 (10/12 사이클)
+    const AggregatedData base = m_base.finalize(AggregationTier::BaseWindow);
+    emit intervalAggregated(base);
+
+    // 2. 상위 단계에 병합
+    m_shortInterval.merge(m_base);
+    m_tenMinutes.merge(m_base);
+    ++m_baseWindowsInShort;
+
+    // 3. 150/180 사이클 구간
+    if(m_baseWindowsInShort >= config::Aggregation::BaseWindowsPerShortInterval) {
+        emit intervalAggregated(m_shortInterval.finalize(AggregationTier::ShortInterval));
+        m_shortInterval = {};
+        m_baseWindowsInShort = 0;
+    }
+
+    // 4. 10분 구간 (RTC 경계를 지난 기본 구간까지 포함)
+    const Nanoseconds baseEnd = m_base.endTime;
+    if(baseEnd >= m_nextTenMinuteTick) {
+        emit intervalAggregated(m_tenMinutes.finalize(AggregationTier::TenMinutes));
+        m_twoHours.merge(m_tenMinutes);
+        m_tenMinutes = {};
+
+        // 150/180 사이클 구간은 10분 경계에서 재동기화 (미완성 구간은 버림)
+        m_shortInterval = {};
+        m_baseWindowsInShort = 0;
+
+        m_nextTenMinuteTick = nextBoundary(baseEnd, config::Aggregation::TenMinuteInterval);
+
+        // 5. 2시간 구간 (10분 경계와 항상 일치)
+        if(baseEnd >= m_nextTwoHourTick) {
+            emit intervalAggregated(m_twoHours.finalize(AggregationTier::TwoHours));
+            m_twoHours = {};
+            m_nextTwoHourTick = nextBoundary(baseEnd, config::Aggregation::TwoHourInterval);
+        }
+    }
+
+    // 6. 다음 기본 구간 길이 결정 (50Hz: 10사이클, 60Hz: 12사이클)
+    m_baseCycles = baseCyclesFor(base.frequency);
+
+    m_base = {};
+}
+
+int AggregationEngine::baseCyclesFor(double frequency)
+{
+    return (frequency >= config::Aggregation::NominalFrequencyThreshold)
+               ? config::Aggregation::BaseCycles60Hz
+               : config::Aggregation::BaseCycles50Hz;
+}
+
+AggregationEngine::Nanoseconds AggregationEngine::nextBoundary(Nanoseconds time, Nanoseconds interval)
+{
+    return (time / interval + 1) * interval;
+}
@@ -0,0 +1,103 @@
+#ifndef AGGREGATION_ENGINE_H
+#define AGGREGATION_ENGINE_H
+
+#include <QObject>
+#include <array>
+#include <chrono>
+#include "measured_data.h"
+#include "shared_data_types.h"
+
+// IEC 61000-4-30 집계 단계
+enum class AggregationTier {
+    BaseWindow,     // 10/12 사이클 (200ms)
+    ShortInterval,  // 150/180 사이클 (3s)
+    TenMinutes,     // 10분 (RTC 정렬)
+    TwoHours        // 2시간 (RTC 정렬)
+};
+
+// 한 집계 구간의 결과
+struct AggregatedData {
+    AggregationTier tier = AggregationTier::BaseWindow;
+    std::chrono::nanoseconds startTime{0};
+    std::chrono::nanoseconds endTime{0};
+    int cycleCount = 0;
+
+    PhaseData voltageRms;
+    LineToLineData voltageRms_ll;
+    PhaseData currentRms;
+    PhaseData activePower;
+    double frequency = 0.0;
+
+    // 구간 내 이벤트(dip/swell/interruption) 발생 여부. 상위 단계로 전파됨
+    bool flagged = false;
+};
+Q_DECLARE_METATYPE(AggregatedData)
+
+// AggregationEngine 클래스
+// 사이클 단위 측정값을 10/12사이클 기본 구간으로 모으고,
+// 150/180사이클 / 10분 / 2시간 구간을 하위 단계의 누적값을 병합하여 계산.
+// 모든 단계는 제곱합/합계만 보관하므로 사이클당 O(1), 기본 구간 종료당 O(1).
+// 10분/2시간 경계는 시뮬레이션 시간(RTC 역할)의 정각 배수에 맞춰 정렬됨.
+class AggregationEngine : public QObject
+{
+    Q_OBJECT
+public:
+    explicit AggregationEngine(QObject* parent = nullptr);
+
+    // 새 사이클 측정값 입력 (timestamp는 사이클 종료 시각)
+    void process(const MeasuredData& cycleData);
+
+    // 현재 진행 중인 기본 구간에 플래그 설정 (이벤트 검출기에서 호출)
+    void flagCurrentInterval();
+
+    // 공칭 주파수 설정. 초기화 후 첫 기본 구간 길이(10/12 사이클)를 정하는 데 사용
+    void setNominalFrequency(double frequency);
+
+    // 모든 단계 초기화
+    void reset();
+
+    // 현재 기본 구간의 사이클 수 (10 또는 12)
+    int baseWindowCycles() const;
+
+signals:
+    void intervalAggregated(const AggregatedData& data);
+
+private:
+    using Nanoseconds = std::chrono::nanoseconds;
+
+    struct Accumulator {
+        std::array<double, 3> voltageRmsSumSq{};
+        std::array<double, 3> voltageRmsSumSq_ll{}; // [0]:ab [1]:bc [2]:ca
+        std::array<double, 3> currentRmsSumSq{};
+        std::array<double, 3> activePowerSum{};
+        double fundamentalCycles = 0.0; // 기본파 사이클 수 합 (주파수 계산용)
+        double durationSec = 0.0;
+        int cycleCount = 0;
+        bool flagged = false;
+        Nanoseconds startTime{0};
+        Nanoseconds endTime{0};
+
+        void addCycle(const MeasuredData& data, Nanoseconds cycleStart, double cycleDurationSec);
+        void merge(const Accumulator& other);
+        AggregatedData finalize(AggregationTier tier) const;
+    };
+
+    void closeBaseWindow();
+    static Nanoseconds nextBoundary(Nanoseconds time, Nanoseconds interval);
+    static int baseCyclesFor(double frequency);
+
+    Accumulator m_base;
+    Accumulator m_shortInterval;
+    Accumulator m_tenMinutes;
+    Accumulator m_twoHours;
+
+    double m_nominalFrequency;   // 첫 기본 구간 길이 결정용
+    int m_baseCycles;            // 현재 기본 구간 길이 (10 또는 12)
+    int m_baseWindowsInShort;    // 150/180 구간에 누적된 기본 구간 수
+    bool m_hasLastTimestamp;
+    Nanoseconds m_lastTimestamp;
+    Nanoseconds m_nextTenMinuteTick;
+    Nanoseconds m_nextTwoHourTick;
+};
+
+#endif // AGGREGATION_ENGINE_H
@@ -151,8 +151,10 @@ void AnalysisGraphWindow::setupSeries()
     }
 }
 
-void AnalysisGraphWindow::updateGraph(const std::deque<MeasuredData>& data)
+void AnalysisGraphWindow::updateGraph(const MeasuredDataSnapshot& snapshot)
 {
+    if(!snapshot) return;
+    const std::deque<MeasuredData>& data = *snapshot;
     if(data.empty()) {
         for(const auto& info : m_seriesInfoList) {
             info.series->clear();
@@ -192,18 +194,27 @@ void AnalysisGraphWindow::updateVisiblePoints(const std::deque<MeasuredData>& da
     const int threshold = m_chartView->width(); // 픽셀 너비만큼 점을 뽑음
 
     if(pointCount > threshold) {
-        std::vector<std::function<double(const MeasuredData&)>> extractors;
-        for(const auto& info : m_seriesInfoList) {
-            if(info.isVisible) {
-                extractors.push_back([&info](const MeasuredData& d) {
-                    return info.extractor(QVariant::fromValue(d));
-                });
+        // 보이는 계열만 중요도 계산에 포함 (비트 순서 = m_seriesInfoList 순서)
+        uint32_t seriesMask = 0;
+        for(size_t i = 0; i < m_seriesInfoList.size(); ++i) {
+            if(m_seriesInfoList[i].isVisible) {
+                seriesMask |= (1u << i);
             }
         }
-        if(extractors.empty()) {
+        if(seriesMask == 0) {
             m_visibleMeasuredData.assign(first, last);
         } else {
-            m_visibleMeasuredData = downsampleLTTB(first, last, threshold, extractors);
+            // QVariant를 거치지 않는 형식 지정 추출기 (m_seriesInfoList 순서와 동일)
+            m_visibleMeasuredData = downsampleLTTB(first, last, threshold, seriesMask,
+                [](const MeasuredData& d) { return d.voltageRms.a; },
+                [](const MeasuredData& d) { return d.currentRms.a; },
+                [](const MeasuredData& d) { return d.activePower.a; },
+                [](const MeasuredData& d) { return d.voltageRms.b; },
+                [](const MeasuredData& d) { return d.currentRms.b; },
+                [](const MeasuredData& d) { return d.activePower.b; },
+                [](const MeasuredData& d) { return d.voltageRms.c; },
+                [](const MeasuredData& d) { return d.currentRms.c; },
+                [](const MeasuredData& d) { return d.activePower.c; });
         }
     } else {
         m_visibleMeasuredData.assign(first, last);
@@ -18,7 +18,7 @@ signals:
     void redrawNeeded(); // 재요청
 
 public slots:
-    void updateGraph(const std::deque<MeasuredData>& data);
+    void updateGraph(const MeasuredDataSnapshot& snapshot);
     void onWaveformVisibilityChanged(int type, bool isVisible);
 
 private:
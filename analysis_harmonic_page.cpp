@@ -35,8 +35,9 @@ AnalysisHarmonicPage::AnalysisHarmonicPage(QWidget *parent)
 }
 // public
 
-void AnalysisHarmonicPage::onOneSecondDataUpdated(const OneSecondSummaryData& data)
+void AnalysisHarmonicPage::onOneSecondDataUpdated(const OneSecondSummarySnapshot& data)
 {
+    if(!data) return;
     m_lastSummaryData = data;
     m_hasData = true;
     updateInfoLabels();
@@ -44,6 +45,14 @@ void AnalysisHarmonicPage::onOneSecondDataUpdated(const OneSecondSummaryData& da
     updateText();
 }
 
+void AnalysisHarmonicPage::onHarmonicGroupsUpdated(const HarmonicGroupResult& result)
+{
+    if(!m_groupCheckBox->isChecked()) return;
+    // 200ms마다 들어오므로 보관만 하고 화면은 1초 데이터 갱신 시 다시 그림
+    m_lastGroups = result;
+    m_hasGroups = true;
+}
+
 // private
 void AnalysisHarmonicPage::setupUi()
 {
@@ -85,39 +94,48 @@ HarmonicDataSources AnalysisHarmonicPage::getCurrentDataSources(int phaseIndex)
     bool isVoltage = m_voltageButton->isChecked();
 
     const auto& fullHarmonics = isVoltage ?
-                                        m_lastSummaryData.lastCycleFullVoltageHarmonics :
-                                        m_lastSummaryData.lastCycleFullCurrentHarmonics;
+                                        m_lastSummaryData->lastCycleFullVoltageHarmonics :
+                                        m_lastSummaryData->lastCycleFullCurrentHarmonics;
 
     sources.harmonics = &AnalysisUtils::getPhaseComponent(phaseIndex, fullHarmonics);
-    sources.totalRms = isVoltage ? &m_lastSummaryData.totalVoltageRms : &m_lastSummaryData.totalCurrentRms;
-    sources.fundamental = isVoltage ? &m_lastSummaryData.fundamentalVoltage : &m_lastSummaryData.fundamentalCurrent;
+    sources.totalRms = isVoltage ? &m_lastSummaryData->totalVoltageRms : &m_lastSummaryData->totalCurrentRms;
+    sources.fundamental = isVoltage ? &m_lastSummaryData->fundamentalVoltage : &m_lastSummaryData->fundamentalCurrent;
     sources.dataTypeIndex = m_dataTypeComboBox->currentIndex();
 
+    if(m_hasGroups) {
+        const int channel = (isVoltage ? HarmonicGroupResult::VoltageA : HarmonicGroupResult::CurrentA) + phaseIndex;
+        sources.groups = &m_lastGroups.channels[channel].groups;
+    }
+
     return sources;
 }
 
 double AnalysisHarmonicPage::calculateRawValue(const HarmonicDataSources& sources, int order, int phaseIndex) const
 {
-    double rawValue = 0.0;
+    double rms = 0.0;
 
-    auto it = std::find_if(sources.harmonics->begin(), sources.harmonics->end(), [order](const HarmonicAnalysisResult& h) {
-        return h.order == order;
-    });
-
-    if(it != sources.harmonics->end()) {
-        const auto& harmonic = *it;
+    if(sources.groups) {
+        // 그룹 모드: 차수 주변 빈까지 합친 고조파 그룹 값
+        if(order < 0 || static_cast<size_t>(order) >= sources.groups->size()) return 0.0;
+        rms = (*sources.groups)[order];
+    } else {
+        auto it = std::find_if(sources.harmonics->begin(), sources.harmonics->end(), [order](const HarmonicAnalysisResult& h) {
+            return h.order == order;
+        });
+        if(it == sources.harmonics->end()) return 0.0;
+        rms = it->rms;
+    }
 
-        switch(sources.dataTypeIndex) {
-            case 0: // voltage or current
-                return harmonic.rms;
-            case 1: {// %RMS
-                const auto& totalRms = AnalysisUtils::getPhaseComponent(phaseIndex, *sources.totalRms);
-                return (totalRms > 1e-9) ? (harmonic.rms / totalRms) * 100.0 : 0.0;
-            }
-            case 2: {// %Fund
-                const auto& fundamental = AnalysisUtils::getPhaseComponent(phaseIndex, *sources.fundamental);
-                return (fundamental.rms > 1e-9) ? (harmonic.rms / fundamental.rms) * 100.0 : 0.0;
-            }
+    switch(sources.dataTypeIndex) {
+        case 0: // voltage or current
+            return rms;
+        case 1: {// %RMS
+            const auto& totalRms = AnalysisUtils::getPhaseComponent(phaseIndex, *sources.totalRms);
+            return (totalRms > 1e-9) ? (rms / totalRms) * 100.0 : 0.0;
+        }
+        case 2: {// %Fund
+            const auto& fundamental = AnalysisUtils::getPhaseComponent(phaseIndex, *sources.fundamental);
+            return (fundamental.rms > 1e-9) ? (rms / fundamental.rms) * 100.0 : 0.0;
         }
     }
     return 0.0;
@@ -220,8 +238,8 @@ void AnalysisHarmonicPage::updateInfoLabels()
         label->setText(fundUnit);
     }
 
-    const auto* thdData = isVoltage ? &m_lastSummaryData.voltageThd : &m_lastSummaryData.currentThd;
-    const auto* fundData = isVoltage ? &m_lastSummaryData.fundamentalVoltage : &m_lastSummaryData.fundamentalCurrent;
+    const auto* thdData = isVoltage ? &m_lastSummaryData->voltageThd : &m_lastSummaryData->currentThd;
+    const auto* fundData = isVoltage ? &m_lastSummaryData->fundamentalVoltage : &m_lastSummaryData->fundamentalCurrent;
 
     m_thdValueLabels[0]->setText(QString::number(thdData->a, 'f', 1));
     m_thdValueLabels[1]->setText(QString::number(thdData->a, 'f', 1));
@@ -294,6 +312,13 @@ void AnalysisHarmonicPage::setupControlBar(QVBoxLayout* mainLayout)
     m_fundCheckBox->setProperty("checkType", "fundCheck");
 
     controlBarLayout->addWidget(m_fundCheckBox);
+
+    // IEC 61000-4-7 그룹 체크박스 (엔진의 10/12 사이클 그룹 분석을 켜고 끔)
+    m_groupCheckBox = new QCheckBox("Group");
+    m_groupCheckBox->setChecked(false);
+    m_groupCheckBox->setProperty("checkType", "fundCheck");
+
+    controlBarLayout->addWidget(m_groupCheckBox);
     controlBarLayout->addStretch();
 
     // A, B, C 상 체크박스
@@ -314,6 +339,7 @@ void AnalysisHarmonicPage::setupControlBar(QVBoxLayout* mainLayout)
     }
 
     connect(m_fundCheckBox, &QCheckBox::checkStateChanged, this, &AnalysisHarmonicPage::onFundVisibleChanged);
+    connect(m_groupCheckBox, &QCheckBox::toggled, this, &AnalysisHarmonicPage::onGroupModeToggled);
     connect(m_phaseButtonGroup, &QButtonGroup::idToggled, this, &AnalysisHarmonicPage::onPhaseVisibleChanged);
 }
 
@@ -642,6 +668,15 @@ void AnalysisHarmonicPage::onFundVisibleChanged(bool checked)
     updateGraph();
 }
 
+void AnalysisHarmonicPage::onGroupModeToggled(bool checked)
+{
+    // 끄면 이전 그룹 결과 대신 즉시 사이클 FFT 값으로 표시
+    if(!checked) m_hasGroups = false;
+    emit harmonicGroupsToggled(checked);
+    updateGraph();
+    updateText();
+}
+
 void AnalysisHarmonicPage::onPhaseVisibleChanged(int id, bool checked)
 {
     if(id >= 0 && id < 3) {
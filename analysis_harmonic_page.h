@@ -3,6 +3,7 @@
 
 #include "UIconfig.h"
 #include "measured_data.h"
+#include "harmonic_group_analyzer.h"
 #include <QStyledItemDelegate>
 #include <QWidget>
 
@@ -35,6 +36,7 @@ struct HarmonicDataSources {
     const std::vector<HarmonicAnalysisResult>* harmonics = nullptr;
     const PhaseData* totalRms = nullptr;
     const GenericPhaseData<HarmonicAnalysisResult>* fundamental = nullptr;
+    const std::vector<double>* groups = nullptr; // IEC 61000-4-7 그룹 모드일 때 고조파 그룹 G_g,h (인덱스 = 차수)
     int dataTypeIndex = 0;
 };
 
@@ -45,7 +47,11 @@ public:
     explicit AnalysisHarmonicPage(QWidget *parent = nullptr);
 
 public slots:
-    void onOneSecondDataUpdated(const OneSecondSummaryData& data);
+    void onOneSecondDataUpdated(const OneSecondSummarySnapshot& data);
+    void onHarmonicGroupsUpdated(const HarmonicGroupResult& result);
+
+signals:
+    void harmonicGroupsToggled(bool enabled);
 
 private slots:
     void onDisplayTypeChanged(int id);
@@ -53,6 +59,7 @@ private slots:
     void onScaleInClicked();
     void onScaleOutClicked();
     void onFundVisibleChanged(bool checked);
+    void onGroupModeToggled(bool checked);
     void onPhaseVisibleChanged(int id, bool checked);
     void onViewTypeChanged(int index);
 
@@ -78,6 +85,7 @@ private:
     QPushButton* m_voltageButton;
     QPushButton* m_currentButton;
     QCheckBox* m_fundCheckBox;
+    QCheckBox* m_groupCheckBox;
     QComboBox* m_dataTypeComboBox;
     QComboBox* m_viewTypeComboBox;
     std::array<QCheckBox*, 3> m_phaseCheckBoxes;
@@ -103,8 +111,10 @@ private:
     QBarSeries* m_barSeries;
     std::array<QBarSet*, 3> m_barSets; // A B C상
 
-    OneSecondSummaryData m_lastSummaryData;
+    OneSecondSummarySnapshot m_lastSummaryData;
     bool m_hasData = false;
+    HarmonicGroupResult m_lastGroups;
+    bool m_hasGroups = false;
 };
 
 #endif // ANALYSIS_HARMONIC_PAGE_H
@@ -34,9 +34,11 @@ AnalysisPhasorPage::AnalysisPhasorPage(QWidget *parent)
     setupConnections();
 }
 
-void AnalysisPhasorPage::updateSummaryData(const OneSecondSummaryData& data)
+void AnalysisPhasorPage::updateSummaryData(const OneSecondSummarySnapshot& snapshot)
 {
-    m_lastSummaryData = data;
+    if(!snapshot) return;
+    m_lastSummaryData = snapshot;
+    const OneSecondSummaryData& data = *snapshot;
 
     GenericPhaseData<HarmonicAnalysisResult> voltageData;
     QStringList voltageLabels;
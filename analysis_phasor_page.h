@@ -23,7 +23,7 @@ public:
     explicit AnalysisPhasorPage(QWidget *parent = nullptr);
 
 public slots:
-    void updateSummaryData(const OneSecondSummaryData& data);
+    void updateSummaryData(const OneSecondSummarySnapshot& snapshot);
 
 private:
     struct TableWidgets {
@@ -55,7 +55,7 @@ private:
     std::array<QLabel*, 3> m_currentNameLabels;
     std::array<QLabel* , 6> m_voltageTable;
     std::array<QLabel*, 6> m_currentTable;
-    OneSecondSummaryData m_lastSummaryData; // 데이터 캐싱
+    OneSecondSummarySnapshot m_lastSummaryData; // 데이터 캐싱 (공유 스냅샷)
     QPushButton* m_vlnButton = nullptr;
     QPushButton* m_vllButton = nullptr;
     QButtonGroup* m_voltageModeGroup = nullptr; // 라디오 동작용
@@ -1,5 +1,7 @@
 #include "analysis_utils.h"
 #include "config.h"
+#include "one_second_accumulator.h"
+#include <algorithm>
 #include <complex>
 #include <QDebug>
 
@@ -19,168 +21,101 @@ namespace {
         };
     }
 
-    struct CycleAccumulators {
-        std::array<double, 3> totalVoltageRmsSumSq = {0.0};
-        std::array<double, 3> totalCurrentRmsSumSq = {0.0};
-        std::array<double, 3> totalVoltageRmsSumSq_ll = {0.0}; // [0]:ab [1]:bc [2]:ca
-        std::array<double, 3> activePowerSum = {0.0};
-        std::array<double, 3> fundVoltageRmsSumSq = {0.0};
-        std::array<double, 3> fundCurrentRmsSumSq = {0.0};
-        std::array<double, 3> fundVoltageRmsSumSq_ll = {0.0};
-        double residualVoltageRmsSum = 0.0;
-        double residualCurrentRmsSum = 0.0;
-        double residualVoltageFundamentalSum = 0.0;
-        double residualCurrentFundamentalSum = 0.0;
-
-        // A상 기준
-        double dominantVoltageRmsSumSq = 0.0;
-        double dominantCurrentRmsSumSq = 0.0;
-    };
-
-    CycleAccumulators accumulateCycleData(const std::vector<MeasuredData>& cycleBuffer, int dominantVoltageOrder, int dominantCurrentOrder) {
-        CycleAccumulators acc;
-
-        // Phasor 3개의 복소수 합을 계산하는 헬퍼 함수
-        auto accumulatePhase = [&](int index, double v_rms, double v_ll_rms, double i_rms, double p_active, const auto& fv, const auto& fv_ll, const auto& fi) {
-            acc.totalVoltageRmsSumSq[index] += v_rms * v_rms;
-            acc.totalVoltageRmsSumSq_ll[index] += v_ll_rms * v_ll_rms;
-            acc.totalCurrentRmsSumSq[index] += i_rms * i_rms;
-            acc.activePowerSum[index] += p_active;
-            acc.fundVoltageRmsSumSq[index] += fv.rms * fv.rms;
-            acc.fundVoltageRmsSumSq_ll[index] += fv_ll.rms * fv_ll.rms;
-            acc.fundCurrentRmsSumSq[index] += fi.rms * fi.rms;
-        };
-        auto sumPhasor = [&](const GenericPhaseData<HarmonicAnalysisResult>& phasePhasors) {
-            std::complex<double> sum(0, 0);
-            sum += phasePhasors.a.phasor + phasePhasors.b.phasor + phasePhasors.c.phasor;
-            return sum;
-        };
-
-        for(const auto& data : cycleBuffer) {
-            accumulatePhase(0, data.voltageRms.a, data.voltageRms_ll.ab, data.currentRms.a, data.activePower.a, data.fundamentalVoltage.a, data.fundamentalVoltage_ll.ab, data.fundamentalCurrent.a);
-            accumulatePhase(1, data.voltageRms.b, data.voltageRms_ll.bc, data.currentRms.b, data.activePower.b, data.fundamentalVoltage.b, data.fundamentalVoltage_ll.bc, data.fundamentalCurrent.b);
-            accumulatePhase(2, data.voltageRms.c, data.voltageRms_ll.ca, data.currentRms.c, data.activePower.c, data.fundamentalVoltage.c, data.fundamentalVoltage_ll.ca, data.fundamentalCurrent.c);
-
-            acc.residualVoltageRmsSum += data.residualVoltageRms;
-            acc.residualCurrentRmsSum += data.residualCurrentRms;
-
-            // 복소수 합의 절대값 계산 (잔류 기본파)
-            acc.residualVoltageFundamentalSum += std::abs(sumPhasor(data.fundamentalVoltage));
-            acc.residualCurrentFundamentalSum += std::abs(sumPhasor(data.fundamentalCurrent));
-
-            if(dominantVoltageOrder > 1 && data.dominantVoltage.a.order == dominantVoltageOrder) {
-                acc.dominantVoltageRmsSumSq += data.dominantVoltage.a.rms * data.dominantVoltage.a.rms;
-            }
-            if(dominantCurrentOrder > 1 && data.dominantCurrent.a.order == dominantCurrentOrder) {
-                acc.dominantCurrentRmsSumSq += data.dominantCurrent.a.rms * data.dominantCurrent.a.rms;
-            }
+    // 0차 제1종 변형 베셀 함수 (Kaiser 창용 급수)
+    double besselI0(double x)
+    {
+        const double quarterSq = 0.25 * x * x;
+        double term = 1.0;
+        double sum = 1.0;
+        for(int k{1}; k < 100 && term > sum * 1e-17; ++k) {
+            term *= quarterSq / (static_cast<double>(k) * k);
+            sum += term;
         }
-        return acc;
+        return sum;
     }
 
-    void calculatePhaseMetrics(OneSecondSummaryData& summary, const CycleAccumulators& acc, size_t N) {
-        std::array<double, 3> voltageRms, currentRms, pActive, apparent, powerFactor, voltageThd, currentThd, reactive_arr;
-        std::array<double, 3> voltageRms_ll, voltageThd_ll;
-
-        for(int i{0}; i < 3; ++i) {
-            voltageRms[i] = std::sqrt(acc.totalVoltageRmsSumSq[i] / N);
-            voltageRms_ll[i] = std::sqrt(acc.totalVoltageRmsSumSq_ll[i] / N);
-            currentRms[i] = std::sqrt(acc.totalCurrentRmsSumSq[i] / N);
-            pActive[i] = acc.activePowerSum[i] / N;
-
-            apparent[i] = voltageRms[i] * currentRms[i];
-            powerFactor[i] = (apparent[i] > 1e-9) ? std::abs(pActive[i] / apparent[i]) : 0.0;
-
-            // 무효 전력
-            double reactive_sq_arg = apparent[i] * apparent[i] - pActive[i] * pActive[i];
-            reactive_arr[i] = (reactive_sq_arg > 0.0) ? std::sqrt(reactive_sq_arg) : 0.0;
-
-            // THD (THD = harmonicRMS / fundamentalRMS)
-            const double fundVoltageRms = std::sqrt(acc.fundVoltageRmsSumSq[i] / N);
-            const double fundVoltageRms_ll = std::sqrt(acc.fundVoltageRmsSumSq_ll[i] / N);
-            const double fundCurrentRms = std::sqrt(acc.fundCurrentRmsSumSq[i] / N);
-
-            if(fundVoltageRms > 1e-9) {
-                double harmonicVoltageRmsSq = (voltageRms[i] * voltageRms[i]) - (fundVoltageRms * fundVoltageRms);
-                voltageThd[i] = (harmonicVoltageRmsSq > 1e-9) ? (std::sqrt(harmonicVoltageRmsSq) / fundVoltageRms) * 100.0 : 0.0;
-            } else {
-                voltageThd[i] = (voltageRms[i] > 1e-9) ? std::numeric_limits<double>::infinity() : 0.0;
-            }
-
-            if(fundCurrentRms > 1e-9) {
-                double harmonicCurrentRmsSq = (currentRms[i] * currentRms[i]) - (fundCurrentRms * fundCurrentRms);
-                currentThd[i] = (harmonicCurrentRmsSq > 1e-9) ? (std::sqrt(harmonicCurrentRmsSq) / fundCurrentRms) * 100.0 : 0.0;
-            } else {
-                currentThd[i] = (currentRms[i] > 1e-9) ? std::numeric_limits<double>::infinity() : 0.0;
-            }
-
-            if(fundVoltageRms_ll > 1e-9) {
-                double harmonicVoltageRmsSq_ll = (voltageRms_ll[i] * voltageRms_ll[i]) - (fundVoltageRms_ll * fundVoltageRms_ll);
-                voltageThd_ll[i] = (harmonicVoltageRmsSq_ll > 1e-9) ? (std::sqrt(harmonicVoltageRmsSq_ll) / fundVoltageRms_ll) * 100.0 : 0.0;
-            } else {
-                // 전압값이 0이라면 THD 값은 의미 없음
-                voltageThd_ll[i] = (voltageRms_ll[i] > 1e-9) ? std::numeric_limits<double>::infinity() : 0.0;
-            }
+    // cos 급수 창 a0 - a1 cos(x) + a2 cos(2x) - ...
+    template<size_t Terms>
+    double cosineSum(const std::array<double, Terms>& a, double x)
+    {
+        double value = 0.0;
+        double sign = 1.0;
+        for(size_t k = 0; k < Terms; ++k) {
+            value += sign * a[k] * std::cos(k * x);
+            sign = -sign;
         }
+        return value;
+    }
 
-        // 결과 할당
-        summary.totalVoltageRms = {voltageRms[0], voltageRms[1], voltageRms[2]};
-        summary.totalVoltageRms_ll = {voltageRms_ll[0], voltageRms_ll[1], voltageRms_ll[2]};
-        summary.totalCurrentRms = {currentRms[0], currentRms[1], currentRms[2]};
-        summary.activePower = {pActive[0], pActive[1], pActive[2]};
-        summary.apparentPower = {apparent[0], apparent[1], apparent[2]};
-        summary.powerFactor = {powerFactor[0], powerFactor[1], powerFactor[2]};
-        summary.voltageThd = {voltageThd[0], voltageThd[1], voltageThd[2]};
-        summary.voltageThd_ll = {voltageThd_ll[0], voltageThd_ll[1], voltageThd_ll[2]};
-        summary.currentThd = {currentThd[0], currentThd[1], currentThd[2]};
-        summary.reactivePower = {reactive_arr[0], reactive_arr[1], reactive_arr[2]};
-    }
-
-    void calculateTotalMetrics(OneSecondSummaryData& summary, const std::vector<MeasuredData>& cycleBuffer, const CycleAccumulators& acc, size_t N) {
-        summary.totalActivePower = summary.activePower.a + summary.activePower.b + summary.activePower.c;
-        summary.totalApparentPower = summary.apparentPower.a + summary.apparentPower.b + summary.apparentPower.c;
-        summary.totalReactivePower = summary.reactivePower.a + summary.reactivePower.b + summary.reactivePower.c;
-        summary.totalPowerFactor = (summary.totalApparentPower > 1e-6) ? std::abs(summary.totalActivePower) / summary.totalApparentPower : 0.0;
-
-        // 주파수 계산 (2샘플 필요)
-        if(cycleBuffer.size() >= 2) {
-            double duration = std::chrono::duration<double>(
-                                  cycleBuffer.back().timestamp - (cycleBuffer.end() - 2)->timestamp).count();
-            summary.frequency = cycleBuffer.back().fundamentalVoltage.a.order * (1.0 / duration);
-        } else {
-            summary.frequency = 0.0;
+    double windowValue(AnalysisUtils::WindowType type, size_t n, size_t N)
+    {
+        using Window = config::Window;
+        const double x = config::Math::TwoPi * n / N;
+        switch(type) {
+        case AnalysisUtils::WindowType::Rectangular: return 1.0;
+        case AnalysisUtils::WindowType::Hann: return cosineSum(Window::Hann, x);
+        case AnalysisUtils::WindowType::Hamming: return cosineSum(Window::Hamming, x);
+        case AnalysisUtils::WindowType::BlackmanHarris: return cosineSum(Window::BlackmanHarris, x);
+        case AnalysisUtils::WindowType::FlatTop: return cosineSum(Window::FlatTop, x);
+        case AnalysisUtils::WindowType::Kaiser: {
+            const double r = 2.0 * n / N - 1.0;
+            return besselI0(Window::KaiserBeta * std::sqrt(std::max(0.0, 1.0 - r * r))) / besselI0(Window::KaiserBeta);
         }
+        }
+        return 1.0;
+    }
 
-        summary.residualVoltageRms = acc.residualVoltageRmsSum / N;
-        summary.residualCurrentRms = acc.residualCurrentRmsSum / N;
-        summary.residualVoltageFundamental = acc.residualVoltageFundamentalSum / N;
-        summary.residualCurrentFundamental = acc.residualCurrentFundamentalSum / N;
-
-        summary.dominantHarmonicVoltageRms = std::sqrt(acc.dominantVoltageRmsSumSq / N);
-        summary.dominantHarmonicCurrentRms = std::sqrt(acc.dominantCurrentRmsSumSq / N);
+    // 한 차수의 3상 페이저 {실수, 허수}에서 영상/정상/역상 크기 (a = 1∠120°)
+    //  정상 = (A + a B + a² C) / 3, 역상 = (A + a² B + a C) / 3, 영상 = (A + B + C) / 3
+    void sequenceMagnitudes(const double* pa, const double* pb, const double* pc,
+                            double& zero, double& positive, double& negative)
+    {
+        constexpr double Third = 1.0 / 3.0;
+        constexpr double Ar = -0.5;                      // Re(a)
+        constexpr double Ai = 0.86602540378443864676;    // Im(a) = √3 / 2
+        const double sumRe = pb[0] + pc[0];
+        const double sumIm = pb[1] + pc[1];
+        const double diffRe = pb[0] - pc[0];
+        const double diffIm = pb[1] - pc[1];
+
+        const double zeroRe = pa[0] + sumRe;
+        const double zeroIm = pa[1] + sumIm;
+        const double rotatedRe = pa[0] + Ar * sumRe;
+        const double rotatedIm = pa[1] + Ar * sumIm;
+        const double positiveRe = rotatedRe - Ai * diffIm;
+        const double positiveIm = rotatedIm + Ai * diffRe;
+        const double negativeRe = rotatedRe + Ai * diffIm;
+        const double negativeIm = rotatedIm - Ai * diffRe;
+
+        zero = Third * std::sqrt(zeroRe * zeroRe + zeroIm * zeroIm);
+        positive = Third * std::sqrt(positiveRe * positiveRe + positiveIm * positiveIm);
+        negative = Third * std::sqrt(negativeRe * negativeRe + negativeIm * negativeIm);
     }
 
-    double calculateNemaUnbalance(const PhaseData& rms) {
-        const double avg = (rms.a + rms.b + rms.c) / 3.0;
-        if(avg < 1e-9) return 0.0;
-        const double max_dev = std::max({std::abs(rms.a - avg),
-                                         std::abs(rms.b - avg),
-                                         std::abs(rms.c - avg)});
-        return (max_dev / avg) * 100.0;
+    // sqrt(total² - part²). 창/반올림 차이로 음수가 되면 0
+    double quadratureRemainder(double total, double part)
+    {
+        return std::sqrt(std::max(total * total - part * part, 0.0));
     }
-    double calculateNemaUnbalance(const LineToLineData& rms) {
-        const double avg = (rms.ab + rms.bc + rms.ca) / 3.0;
-        if(avg < 1e-9) return 0.0;
-        const double max_dev = std::max({std::abs(rms.ab - avg),
-                                         std::abs(rms.bc - avg),
-                                         std::abs(rms.ca - avg)});
-        return (max_dev / avg) * 100.0;
+
+    // 총 RMS/유효 전력과 기본파 RMS로 비기본파 항 채우기 (p, p1, s, s1은 채워진 상태)
+    void decomposeNonFundamental(Ieee1459Power& power, double v1, double vh, double i1, double ih)
+    {
+        power.sn = quadratureRemainder(power.s, power.s1);
+        power.di = v1 * ih;
+        power.dv = vh * i1;
+        power.sh = vh * ih;
+        power.ph = power.p - power.p1;
+        power.dh = quadratureRemainder(power.sh, power.ph);
+        power.n = quadratureRemainder(power.s, power.p);
+        power.pf = (power.s > 1e-9) ? power.p / power.s : 0.0;
     }
 }
 
 std::mutex AnalysisUtils::m_cacheMutex;
 std::map<int, AnalysisUtils::KissFftrUniquePtr> AnalysisUtils::m_fftConfigCache;
 std::map<int, AnalysisUtils::KissFftUniquePtr> AnalysisUtils::m_complexFFTConfigCache;
+std::map<std::pair<AnalysisUtils::WindowType, size_t>, std::unique_ptr<const AnalysisUtils::WindowTable>> AnalysisUtils::m_windowTableCache;
 
 const HarmonicAnalysisResult* AnalysisUtils::getHarmonicComponent(const std::vector<HarmonicAnalysisResult>& harmonics, int order)
 {
@@ -212,7 +147,38 @@ const HarmonicAnalysisResult* AnalysisUtils::getDominantHarmonic(const std::vect
     return dominant;
 }
 
+const AnalysisUtils::WindowTable& AnalysisUtils::windowTable(WindowType type, size_t N)
+{
+    std::lock_guard<std::mutex> lock(m_cacheMutex);
+    auto& table = m_windowTableCache[{type, N}];
+    if(!table) {
+        auto created = std::make_unique<WindowTable>();
+        created->coefficients.resize(N);
+        double sum = 0.0;
+        double sumSq = 0.0;
+        for(size_t n = 0; n < N; ++n) {
+            const double w = windowValue(type, n, N);
+            created->coefficients[n] = w;
+            sum += w;
+            sumSq += w * w;
+        }
+        if(N > 0 && sum != 0.0) {
+            created->coherentGain = sum / N;
+            created->enbw = N * sumSq / (sum * sum);
+        }
+        table = std::move(created);
+    }
+    return *table;
+}
+
 std::expected<AnalysisUtils::Spectrum, AnalysisUtils::SpectrumError> AnalysisUtils::calculateSpectrum(const std::vector<DataPoint>& samples, DataType type, int phase, bool useWindow)
+{
+    SpectrumOptions options;
+    options.window = useWindow ? WindowType::Hann : WindowType::Rectangular;
+    return calculateSpectrum(samples, type, phase, options);
+}
+
+std::expected<AnalysisUtils::Spectrum, AnalysisUtils::SpectrumError> AnalysisUtils::calculateSpectrum(const std::vector<DataPoint>& samples, DataType type, int phase, const SpectrumOptions& options)
 {
     // 유효성 검사
     if(samples.size() == 0) {
@@ -224,21 +190,23 @@ std::expected<AnalysisUtils::Spectrum, AnalysisUtils::SpectrumError> AnalysisUti
         return std::unexpected(SpectrumError::InvalidInput);
     }
 
-    size_t N = samples.size();
+    const size_t samplesCount = samples.size();
+    const size_t N = std::max(samplesCount, options.fftLength); // FFT 길이 (제로 패딩 포함)
 
-    // 입력 데이터 준비 (Hann 윈도우 적용 포함)
-    std::vector<kiss_fft_scalar> fft_in(N);
-    const double window_factor_base = (useWindow && N > 1) ? (config::Math::TwoPi / (N - 1)) : 0.0;
+    // 창 계수 (사각 창은 표 없이 1)
+    const bool useWindow = options.window != WindowType::Rectangular && samplesCount > 1;
+    const WindowTable* window = useWindow ? &windowTable(options.window, samplesCount) : nullptr;
 
-    for(size_t i = 0; i < N; ++i) {
+    // 입력 데이터 준비 (창 적용, 나머지는 0)
+    std::vector<kiss_fft_scalar> fft_in(N, 0.0);
+    for(size_t i = 0; i < samplesCount; ++i) {
         // 타입에 따른 값 추출
         double value = (type == DataType::Voltage)
             ? AnalysisUtils::getPhaseComponent(phase, samples[i].voltage)
             : AnalysisUtils::getPhaseComponent(phase, samples[i].current);
 
-        // Window 적용
-        if(useWindow && N > 1) {
-            value *= 0.5 * (1.0 - std::cos(i * window_factor_base));
+        if(window) {
+            value *= window->coefficients[i];
         }
         fft_in[i] = value;
     }
@@ -254,9 +222,18 @@ std::expected<AnalysisUtils::Spectrum, AnalysisUtils::SpectrumError> AnalysisUti
         return fft_ptr.get();
     };
 
+    // 정규화: 창 합(= 샘플 수 * coherent gain)으로 나누고, 전력 스케일이면 ENBW로 한 번 더 보정
+    double windowSum = static_cast<double>(samplesCount);
+    if(window) {
+        windowSum *= window->coherentGain;
+        if(options.scaling == SpectrumScaling::Power) {
+            windowSum *= std::sqrt(window->enbw);
+        }
+    }
+
     const size_t num_freq_bins = N / 2 + 1;
-    const double oneOverN = 1.0 / static_cast<double>(N);
-    const double normFactor = std::sqrt(2.0) / static_cast<double>(N);
+    const double dcScale = 1.0 / windowSum;
+    const double normFactor = std::sqrt(2.0) / windowSum;
 
     Spectrum spectrum(num_freq_bins); // 최종 결과
 
@@ -269,11 +246,11 @@ std::expected<AnalysisUtils::Spectrum, AnalysisUtils::SpectrumError> AnalysisUti
         kiss_fftr(fft_cfg, fft_in.data(), fft_out.data());
 
         // 정규화
-        spectrum[0] = {fft_out[0].r * oneOverN, 0.0}; // DC는 sqrt(2)로 나누지 않음
+        spectrum[0] = {fft_out[0].r * dcScale, 0.0}; // DC는 sqrt(2)로 나누지 않음
         for(int k = 1; k < num_freq_bins; ++k) {
             // 짝수 N일 때 Nyquist 주파수 성분은 DC와 동일하게 1/N 스케일링 적용
             if(k == num_freq_bins - 1) {
-                spectrum[k] = {fft_out[k].r * oneOverN, 0.0};
+                spectrum[k] = {fft_out[k].r * dcScale, 0.0};
             } else {
                 spectrum[k] = {normFactor * fft_out[k].r, normFactor * fft_out[k].i};
             }
@@ -294,7 +271,7 @@ std::expected<AnalysisUtils::Spectrum, AnalysisUtils::SpectrumError> AnalysisUti
         kiss_fft(fft_cfg, complex_in.data(), complex_out.data());
 
         // 정규화
-        spectrum[0] = {complex_out[0].r * oneOverN, 0.0};
+        spectrum[0] = {complex_out[0].r * dcScale, 0.0};
         for(int k = 1; k < num_freq_bins; ++k) {
             spectrum[k] = {normFactor * complex_out[k].r, normFactor * complex_out[k].i};
         }
@@ -503,66 +480,12 @@ OneSecondSummaryData AnalysisUtils::buildOneSecondSummary(const std::vector<Meas
         return {};
     }
 
-    OneSecondSummaryData summary{};
-    const auto& lastCycleData = cycleBuffer.back();
-    const size_t N = cycleBuffer.size();
-
-    // 1. 기본 정보 설정
-    summary.dominantHarmonicVoltageOrder = lastCycleData.dominantVoltage.a.order;
-    summary.dominantHarmonicCurrentOrder = lastCycleData.dominantCurrent.a.order;
-    summary.dominantHarmonicVoltagePhase = utils::radiansToDegrees(lastCycleData.dominantVoltage.a.phase);
-    summary.dominantHarmonicCurrentPhase = utils::radiansToDegrees(lastCycleData.dominantCurrent.a.phase);
-    summary.fundamentalVoltage = lastCycleData.fundamentalVoltage;
-    summary.fundamentalVoltage_ll = lastCycleData.fundamentalVoltage_ll;
-    summary.fundamentalCurrent = lastCycleData.fundamentalCurrent;
-
-    // 2. 데이터 누적
-    CycleAccumulators acc = accumulateCycleData(cycleBuffer,
-                                                summary.dominantHarmonicVoltageOrder,
-                                                summary.dominantHarmonicCurrentOrder);
-
-    // 3. 위상별 계산 (RMS, Power, THD)
-    calculatePhaseMetrics(summary, acc, N);
-
-    // 4. 전체 지표 계산 (Total Power, Frequency, Residual)
-    calculateTotalMetrics(summary, cycleBuffer, acc, N);
-
-    // 5. 불평형률 계산 (NEMA)
-    summary.nemaVoltageUnbalance = calculateNemaUnbalance(summary.totalVoltageRms);
-    summary.nemaVoltageUnbalance_ll = calculateNemaUnbalance(summary.totalVoltageRms_ll);
-    summary.nemaCurrentUnbalance = calculateNemaUnbalance(summary.totalCurrentRms);
-
-    // 6. 대칭 성분 및 불평형률 (U0, U2)
-    const auto& LN_voltageData = lastCycleData.fundamentalVoltage;
-    const auto& LL_voltageData = lastCycleData.fundamentalVoltage_ll;
-    const auto& currentData = lastCycleData.fundamentalCurrent;
-
-    summary.voltageSymmetricalComponents = calculateSymmetricalComponents(LN_voltageData.a, LN_voltageData.b, LN_voltageData.c);
-    summary.currentSymmetricalComponents = calculateSymmetricalComponents(currentData.a, currentData.b, currentData.c);
-    auto sym_ll_temp = calculateSymmetricalComponents(LL_voltageData.ab, LL_voltageData.bc, LL_voltageData.ca);
-    summary.voltageSymmetricalComponents_ll.positive = sym_ll_temp.positive;
-    summary.voltageSymmetricalComponents_ll.negative = sym_ll_temp.negative;
-
-    auto calculateSymUnbalance = [](const SymmetricalComponents& sym, double& u0, double& u2) {
-        if(sym.positive.magnitude > 1e-9) {
-            u0 = (sym.zero.magnitude / sym.positive.magnitude) * 100.0;
-            u2 = (sym.negative.magnitude / sym.positive.magnitude) * 100.0;
-        } else {
-            u0 = (sym.zero.magnitude > 1e-9) ? std::numeric_limits<double>::infinity() : 0.0;
-            u2 = (sym.negative.magnitude > 1e-9) ? std::numeric_limits<double>::infinity() : 0.0;
-        }
-    };
-    calculateSymUnbalance(summary.voltageSymmetricalComponents, summary.voltageU0Unbalance, summary.voltageU2Unbalance);
-    calculateSymUnbalance(summary.currentSymmetricalComponents, summary.currentU0Unbalance, summary.currentU2Unbalance);
-
-    // 7. 마지막 사이클 고조파 정보 복사
-    summary.lastCycleVoltageHarmonics = lastCycleData.voltageHarmonics;
-    summary.lastCycleCurrentHarmonics = lastCycleData.currentHarmonics;
-
-    summary.lastCycleFullVoltageHarmonics = lastCycleData.fullVoltageHarmonics;
-    summary.lastCycleFullCurrentHarmonics = lastCycleData.fullCurrentHarmonics;
-
-    return summary;
+    // 엔진과 동일한 스트리밍 집계기를 사용 (배치 입력용 편의 함수)
+    OneSecondAccumulator accumulator;
+    for(const auto& data : cycleBuffer) {
+        accumulator.add(data);
+    }
+    return accumulator.finalize(cycleBuffer.back());
 }
 
 double AnalysisUtils::calculateResidualRms(const std::vector<DataPoint>& samples, AnalysisUtils::DataType type)
@@ -618,4 +541,124 @@ SymmetricalComponents AnalysisUtils::calculateSymmetricalComponents(const Harmon
     result.negative.magnitude = std::abs(V_negative);
     result.negative.phase_deg = utils::radiansToDegrees(std::arg(V_negative));
     return result;
-}
\ No newline at end of file
+}
+
+HarmonicOrderData AnalysisUtils::calculateHarmonicOrderData(const GenericPhaseData<Spectrum>& voltage, const GenericPhaseData<Spectrum>& current)
+{
+    HarmonicOrderData result;
+    const size_t orders = std::min({voltage.a.size(), voltage.b.size(), voltage.c.size(),
+                                    current.a.size(), current.b.size(), current.c.size()});
+    if(orders == 0) {
+        return result;
+    }
+
+    for(auto* column : {&result.activePower.a, &result.activePower.b, &result.activePower.c,
+                        &result.reactivePower.a, &result.reactivePower.b, &result.reactivePower.c,
+                        &result.voltageSequence.zero, &result.voltageSequence.positive, &result.voltageSequence.negative,
+                        &result.currentSequence.zero, &result.currentSequence.positive, &result.currentSequence.negative}) {
+        column->resize(orders);
+    }
+
+    // std::complex<double> 배열은 {실수, 허수} double 배열로 접근 가능. 차수마다 분기 없이 채널 6개를 한꺼번에 처리
+    const std::array<const double*, 3> v = {
+        reinterpret_cast<const double*>(voltage.a.data()),
+        reinterpret_cast<const double*>(voltage.b.data()),
+        reinterpret_cast<const double*>(voltage.c.data())
+    };
+    const std::array<const double*, 3> i = {
+        reinterpret_cast<const double*>(current.a.data()),
+        reinterpret_cast<const double*>(current.b.data()),
+        reinterpret_cast<const double*>(current.c.data())
+    };
+    const std::array<double*, 3> p = {result.activePower.a.data(), result.activePower.b.data(), result.activePower.c.data()};
+    const std::array<double*, 3> q = {result.reactivePower.a.data(), result.reactivePower.b.data(), result.reactivePower.c.data()};
+
+    for(size_t k = 0; k < orders; ++k) {
+        const size_t re = 2 * k;
+        const size_t im = re + 1;
+
+        // 상별 복소 전력 S = V I*
+        for(int phase{0}; phase < 3; ++phase) {
+            p[phase][k] = v[phase][re] * i[phase][re] + v[phase][im] * i[phase][im];
+            q[phase][k] = v[phase][im] * i[phase][re] - v[phase][re] * i[phase][im];
+        }
+
+        sequenceMagnitudes(v[0] + re, v[1] + re, v[2] + re,
+                           result.voltageSequence.zero[k], result.voltageSequence.positive[k], result.voltageSequence.negative[k]);
+        sequenceMagnitudes(i[0] + re, i[1] + re, i[2] + re,
+                           result.currentSequence.zero[k], result.currentSequence.positive[k], result.currentSequence.negative[k]);
+    }
+    return result;
+}
+
+Ieee1459Data AnalysisUtils::calculateIeee1459(const MeasuredData& cycle)
+{
+    Ieee1459Data result;
+
+    // 1. 상별 분해 (V1·I1* 로 P1/Q1, 총 RMS와의 직교 차이로 VH/IH)
+    double sumVoltageSq = 0.0;
+    double sumVoltage1Sq = 0.0;
+    double sumCurrentSq = 0.0;
+    double sumCurrent1Sq = 0.0;
+    for(int phase{0}; phase < 3; ++phase) {
+        const double v = getPhaseComponent(phase, cycle.voltageRms);
+        const double i = getPhaseComponent(phase, cycle.currentRms);
+        const std::complex<double> v1 = getPhaseComponent(phase, cycle.fundamentalVoltage).phasor;
+        const std::complex<double> i1 = getPhaseComponent(phase, cycle.fundamentalCurrent).phasor;
+        const double v1Rms = std::abs(v1);
+        const double i1Rms = std::abs(i1);
+        const std::complex<double> s1 = v1 * std::conj(i1);
+
+        Ieee1459Power& power = getPhaseComponent(phase, result.phase);
+        power.p = getPhaseComponent(phase, cycle.activePower);
+        power.p1 = s1.real();
+        power.q1 = s1.imag();
+        power.s = v * i;
+        power.s1 = v1Rms * i1Rms;
+        power.pf1 = (power.s1 > 1e-9) ? power.p1 / power.s1 : 0.0;
+        decomposeNonFundamental(power, v1Rms, quadratureRemainder(v, v1Rms), i1Rms, quadratureRemainder(i, i1Rms));
+
+        sumVoltageSq += v * v;
+        sumVoltage1Sq += v1Rms * v1Rms;
+        sumCurrentSq += i * i;
+        sumCurrent1Sq += i1Rms * i1Rms;
+    }
+
+    // 2. 유효 전압/전류 (4선식). 선간 전압과 중성선 전류까지 포함
+    const auto& vll = cycle.voltageRms_ll;
+    const auto& vll1 = cycle.fundamentalVoltage_ll;
+    const double sumLineSq = vll.ab * vll.ab + vll.bc * vll.bc + vll.ca * vll.ca;
+    const double sumLine1Sq = vll1.ab.rms * vll1.ab.rms + vll1.bc.rms * vll1.bc.rms + vll1.ca.rms * vll1.ca.rms;
+    const double neutral = cycle.residualCurrentRms;
+    const double neutral1 = std::abs(cycle.fundamentalCurrent.a.phasor + cycle.fundamentalCurrent.b.phasor + cycle.fundamentalCurrent.c.phasor);
+
+    Ieee1459SystemPower& system = result.system;
+    system.ve = std::sqrt((3.0 * sumVoltageSq + sumLineSq) / 18.0);
+    system.ve1 = std::sqrt((3.0 * sumVoltage1Sq + sumLine1Sq) / 18.0);
+    system.ie = std::sqrt((sumCurrentSq + neutral * neutral) / 3.0);
+    system.ie1 = std::sqrt((sumCurrent1Sq + neutral1 * neutral1) / 3.0);
+
+    // 3. 시스템 값. P, P1, Q1은 상별 합, 피상 전력은 유효값 기준
+    const auto& phases = result.phase;
+    system.p = phases.a.p + phases.b.p + phases.c.p;
+    system.p1 = phases.a.p1 + phases.b.p1 + phases.c.p1;
+    system.q1 = phases.a.q1 + phases.b.q1 + phases.c.q1;
+    system.s = 3.0 * system.ve * system.ie;
+    system.s1 = 3.0 * system.ve1 * system.ie1;
+    decomposeNonFundamental(system, 3.0 * system.ve1, 3.0 * quadratureRemainder(system.ve, system.ve1),
+                            system.ie1, quadratureRemainder(system.ie, system.ie1));
+
+    // 4. 정상분 기본파 전력과 기본파 역률 (a = 1∠120°)
+    const std::complex<double> a = std::polar(1.0, utils::degreesToRadians(120.0));
+    const auto positive = [&](const GenericPhaseData<HarmonicAnalysisResult>& p) {
+        return (p.a.phasor + a * p.b.phasor + a * a * p.c.phasor) / 3.0;
+    };
+    const std::complex<double> s1Positive = 3.0 * positive(cycle.fundamentalVoltage) * std::conj(positive(cycle.fundamentalCurrent));
+    system.p1Positive = s1Positive.real();
+    system.q1Positive = s1Positive.imag();
+    system.s1Positive = std::abs(s1Positive);
+    system.s1Unbalanced = quadratureRemainder(system.s1, system.s1Positive);
+    system.pf1 = (system.s1Positive > 1e-9) ? system.p1Positive / system.s1Positive : 0.0;
+
+    return result;
+}
@@ -42,6 +42,27 @@ public:
 
     enum class DataType { Voltage, Current };
 
+    // 스펙트럼 분석 창 함수 (periodic 정의: w[n] = f(2πn/N))
+    enum class WindowType { Rectangular, Hann, Hamming, BlackmanHarris, FlatTop, Kaiser };
+    // Amplitude: 빈 중심 정현파의 RMS가 맞도록 coherent gain 보정
+    // Power: 광대역 신호의 빈 전력 합이 RMS²가 되도록 ENBW까지 보정
+    enum class SpectrumScaling { Amplitude, Power };
+
+    // 창/스케일링/0 채움은 API로만 선택 (사후 분석, 테스트용). 엔진의 고조파 분석은 한 사이클에 동기된 버퍼라
+    // 사각 창 + 패딩 없음이 정확하고 (창은 이웃 차수로 새고, 패딩은 빈과 차수의 대응을 깨뜨림) 앱 설정으로 노출하지 않음
+    struct SpectrumOptions {
+        WindowType window = WindowType::Rectangular;
+        SpectrumScaling scaling = SpectrumScaling::Amplitude;
+        size_t fftLength = 0; // N보다 크면 뒤를 0으로 채움 (빈 간격 = fs / fftLength)
+    };
+
+    // (창 종류, N)별로 한 번만 계산해 캐시하는 계수 표
+    struct WindowTable {
+        std::vector<double> coefficients;
+        double coherentGain = 1.0; // sum(w) / N
+        double enbw = 1.0;         // 등가 잡음 대역폭 N * sum(w²) / sum(w)² (빈 단위)
+    };
+
     inline static QString toQString(SpectrumError error) {
         switch (error) {
         case SpectrumError::InvalidInput:
@@ -72,8 +93,13 @@ public:
     // 가장 지배적인 고조파 성분을 찾고 반환 (없으면 nullptr)
     static const HarmonicAnalysisResult* getDominantHarmonic(const std::vector<HarmonicAnalysisResult>& harmonics);
 
+    static std::expected<Spectrum, SpectrumError> calculateSpectrum(const std::vector<DataPoint>& samples, DataType type, int phase, const SpectrumOptions& options);
+    // useWindow면 Hann 창 (coherent gain 보정), 아니면 사각 창
     static std::expected<Spectrum, SpectrumError> calculateSpectrum(const std::vector<DataPoint>& samples, DataType type, int phase, bool useWindow);
 
+    // 캐시된 창 계수 표. 반환된 참조는 프로그램 종료까지 유효
+    static const WindowTable& windowTable(WindowType type, size_t N);
+
     static std::expected<std::vector<double>, WaveGenerateError> generateFundamentalWave(const std::vector<DataPoint>& samples);
 
     static std::vector<HarmonicAnalysisResult> findSignificantHarmonics(const Spectrum& spectrum);
@@ -93,6 +119,16 @@ public:
 
     static SymmetricalComponents calculateSymmetricalComponents(const HarmonicAnalysisResult& p1, const HarmonicAnalysisResult& p2, const HarmonicAnalysisResult& p3);
 
+    // 3상 전압/전류 스펙트럼(calculateSpectrum 결과)에서 모든 차수의 상별 P/Q와 대칭 성분 크기를 한 번의 루프로 계산.
+    // 차수 수는 가장 짧은 스펙트럼 기준 (하나라도 비어 있으면 빈 결과)
+    static HarmonicOrderData calculateHarmonicOrderData(const GenericPhaseData<Spectrum>& voltage, const GenericPhaseData<Spectrum>& current);
+
+    // 사이클에서 이미 계산된 RMS/유효 전력(시간 영역)과 기본파 페이저(스펙트럼)만으로 IEEE 1459 분해.
+    // 필요한 값: voltageRms, currentRms, activePower, voltageRms_ll, residualCurrentRms(중성선 전류),
+    //           fundamentalVoltage, fundamentalCurrent, fundamentalVoltage_ll
+    // 모든 값은 같은 샘플 레코드에서 구해야 함 (다른 레코드면 V와 V1이 어긋나 VH/IH가 생기거나 0으로 잘림)
+    static Ieee1459Data calculateIeee1459(const MeasuredData& cycle);
+
     template<typename T>
     static T& getPhaseComponent(int index, GenericPhaseData<T>& phaseData)
     {
@@ -127,6 +163,9 @@ private:
     // 복소수 FFT용 캐시 (홀수 N용)
     static std::map<int, KissFftUniquePtr> m_complexFFTConfigCache;
 
+    // 창 계수 표 캐시
+    static std::map<std::pair<WindowType, size_t>, std::unique_ptr<const WindowTable>> m_windowTableCache;
+
 };
 
 #endif // ANALYSIS_UTILS_H
@@ -267,7 +267,7 @@ void AnalysisWaveformPage::setupChart()
     }
 }
 
-void AnalysisWaveformPage::onOneSecondDataUpdated(const OneSecondSummaryData& data)
+void AnalysisWaveformPage::onOneSecondDataUpdated(const OneSecondSummarySnapshot& data)
 {
     m_lastData = data;
     if(m_isUpdating) {
@@ -277,13 +277,13 @@ void AnalysisWaveformPage::onOneSecondDataUpdated(const OneSecondSummaryData& da
 
 void AnalysisWaveformPage::updatePage()
 {
-    if(m_lastData.lastTwoCycleData.empty())
+    if(!m_lastData || m_lastData->lastTwoCycleData.empty())
         return;
 
     if(m_isAutoScaling) {
         double v_abs_max = 0.0, a_abs_max = 0.0;
 
-        for(const auto& point : m_lastData.lastTwoCycleData) {
+        for(const auto& point : m_lastData->lastTwoCycleData) {
             v_abs_max = std::max({v_abs_max, std::abs(point.voltage.a), std::abs(point.voltage.b), std::abs(point.voltage.c)});
             a_abs_max = std::max({a_abs_max, std::abs(point.current.a), std::abs(point.current.b), std::abs(point.current.c)});
         }
@@ -311,7 +311,7 @@ void AnalysisWaveformPage::updatePage()
         }
     }
 
-    const auto& waveData = m_lastData.lastTwoCycleData;
+    const auto& waveData = m_lastData->lastTwoCycleData;
 
     // 데이터 포인트들을 각 시리즈에 맞게 분리
 
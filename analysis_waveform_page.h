@@ -25,7 +25,7 @@ public:
     explicit AnalysisWaveformPage(QWidget *parent = nullptr);
 
 public slots:
-    void onOneSecondDataUpdated(const OneSecondSummaryData& data);
+    void onOneSecondDataUpdated(const OneSecondSummarySnapshot& data);
 
 private slots:
     void onStartStopToggled(bool checked);
@@ -76,7 +76,7 @@ private:
     int m_voltageScaleIndex = 0;
     int m_currentScaleIndex = 0;
 
-    OneSecondSummaryData m_lastData;
+    OneSecondSummarySnapshot m_lastData;
 };
 
 #endif // ANALYSIS_WAVEFORM_PAGE_H
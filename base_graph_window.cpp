@@ -1,12 +1,12 @@
 #include "base_graph_window.h"
 #include "custom_chart_view.h"
-#include "data_point.h"
+#include "sample_history.h"
 #include "measured_data.h"
 #include <QChart>
 #include <QValueAxis>
 #include <QGridLayout>
 
-template std::pair<double, double> BaseGraphWindow::getVisibleXRange<std::deque<DataPoint>>(const std::deque<DataPoint>&);
+template std::pair<double, double> BaseGraphWindow::getVisibleXRange<SampleHistory>(const SampleHistory&);
 template std::pair<double, double> BaseGraphWindow::getVisibleXRange<std::deque<MeasuredData>>(const std::deque<MeasuredData>&);
 
 
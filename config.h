@@ -1,6 +1,7 @@
 #ifndef CONFIG_H
 #define CONFIG_H
 
+#include <array>
 #include <cmath>
 #include <QString>
 #include <string_view>
@@ -20,9 +21,12 @@ namespace config {
         struct DataSize {
             static constexpr int DefaultDataSize = 1000;
             static constexpr int MinDataSize = 1;
-            static constexpr int MaxDataSize = 100000;
+            static constexpr int MaxDataSize = 1000000; // 정수 이력 형식이면 수 분 분량의 고속 파형도 보관 가능
         };
 
+        // 사이클 측정값(MeasuredData) 최대 보관 수. 레코드마다 고조파 벡터를 들고 있어 파형 이력 한도와 따로 제한
+        static constexpr int MeasuredDataSize = 100000;
+
         // 그래프 폭 관련 설정
         struct GraphWidth {
             static constexpr double Default = 1.0;
@@ -97,6 +101,123 @@ namespace config {
         static constexpr double DefaultPhase = 0.0;
     };
 
+    // IEC 61000-4-30 Class A 집계 구간 설정
+    struct Aggregation {
+        static constexpr int BaseCycles50Hz = 10;   // 50Hz 계통: 10사이클 (200ms)
+        static constexpr int BaseCycles60Hz = 12;   // 60Hz 계통: 12사이클 (200ms)
+        static constexpr double NominalFrequencyThreshold = 55.0; // 이 값 이상이면 60Hz 계통으로 판단
+        static constexpr int BaseWindowsPerShortInterval = 15; // 150/180사이클 = 기본 구간 15개
+        static constexpr std::chrono::seconds TenMinuteInterval{600};
+        static constexpr std::chrono::seconds TwoHourInterval{7200};
+    };
+
+    // 전압 이벤트(dip/swell/interruption) 검출 설정 (IEC 61000-4-30, 공칭 전압 대비 비율)
+    struct EventDetection {
+        static constexpr double DipThreshold = 0.90;
+        static constexpr double SwellThreshold = 1.10;
+        static constexpr double InterruptionThreshold = 0.05;
+        static constexpr double Hysteresis = 0.02;      // 종료 시 임계값에 더하는(빼는) 히스테리시스
+        static constexpr size_t MaxLogSize = 1000;      // 메모리에 보관하는 최근 이벤트 수
+    };
+
+    // 플리커미터 설정 (IEC 61000-4-15)
+    struct Flicker {
+        static constexpr double HighPassCutoffHz = 0.05;           // 직류 제거 1차 HPF
+        static constexpr double LowPassCutoff50HzHz = 35.0;        // 2배 전원 주파수 제거 6차 Butterworth (50Hz 계통)
+        static constexpr double LowPassCutoff60HzHz = 42.0;        // (60Hz 계통)
+        static constexpr double NormalizationTimeConstantSec = 60.0; // 입력 정규화용 평균 제곱 시정수
+        static constexpr double SmoothingTimeConstantSec = 0.3;    // 제곱 후 1차 LPF (눈-뇌 기억 효과)
+        static constexpr double ReferenceFrequencyHz = 8.8;        // 정현 변조 8.8Hz,
+        static constexpr double ReferenceModulation = 0.0025;      // ΔV/V 0.25%에서 Pinst = 1
+        static constexpr double MinSampleRateHz = 200.0;           // 이보다 낮은 샘플링에서는 동작 안 함
+        static constexpr double ClassifierRateHz = 100.0;          // 분류기에 넣는 Pinst 샘플링 속도
+        static constexpr size_t ClassCount = 1024;                 // 로그 간격 히스토그램 클래스 수
+        static constexpr double ClassMin = 1.0e-3;
+        static constexpr double ClassMax = 1.0e4;
+        static constexpr double ShortTermPeriodSec = 600.0;        // Pst 관측 구간 (10분)
+        static constexpr size_t LongTermCount = 12;                // Plt = Pst 12개 (2시간)
+    };
+
+    // 과도 현상 캡처 설정 (트리거 값은 공칭 전압 대비 비율)
+    struct Transient {
+        static constexpr int PreTriggerSamples = 512;
+        static constexpr int PostTriggerSamples = 1536;
+        static constexpr size_t PoolSize = 16;           // 동시에 존재할 수 있는 캡처 버퍼 수 (부족하면 버림)
+        static constexpr int HoldoffSamples = 256;       // 트리거 후 다음 트리거까지 최소 샘플 수
+        static constexpr double WaveshapeRatio = 0.10;   // |v - 한 주기 전 v| > 비율 * 공칭 피크
+        static constexpr double DvDtRatio = 0.5;         // |dv/dt - 한 주기 전 dv/dt| > 비율 * 공칭 기본파 최대 기울기(ω·피크)
+        static constexpr double RmsChangeRatio = 0.10;   // 연속한 Urms(1/2) 차이 > 비율 * 공칭 RMS
+        static constexpr std::string_view DirectoryName = "transients";
+        static constexpr size_t MaxFiles = 500;                       // 보관할 캡처 파일 수 (넘으면 오래된 것부터 삭제)
+        static constexpr long long MaxTotalBytes = 256LL * 1024 * 1024; // 보관할 캡처 파일 총 크기
+    };
+
+    // ADC 전단 모델 기본값 (정격 계측기 수준의 오차)
+    struct Adc {
+        static constexpr int DefaultBits = 16;
+        static constexpr double VoltageFullScale = 600.0;   // 입력 범위 ±피크 (V)
+        static constexpr double CurrentFullScale = 100.0;   // (A)
+        static constexpr double DefaultGainError = 0.0005;  // 채널별 이득 오차 기본 크기 (비율)
+        static constexpr double VoltageNoiseRms = 0.05;     // 백색 잡음 RMS (V)
+        static constexpr double CurrentNoiseRms = 0.005;    // (A)
+        static constexpr double PinkNoiseRatio = 0.5;       // 1/f 잡음 RMS = 백색 잡음 RMS * 비율
+        static constexpr size_t NoiseBlockSize = 1024;      // 잡음을 미리 만들어 두는 샘플 수
+        static constexpr unsigned long long DefaultSeed = 0x5eed'ad'c0ULL;
+    };
+
+    // 원시 파형 이력(SampleHistory) 설정
+    struct History {
+        static constexpr double VoltageFullScale = 1000.0; // 정수 저장 범위 ±피크 (V)
+        static constexpr double CurrentFullScale = 1000.0; // (A)
+        static constexpr size_t BlockSize = 4096;          // 블록당 최대 샘플 수 (앞쪽 해제 단위)
+    };
+
+    // 수요(Demand) 구간 설정
+    struct Demand {
+        static constexpr int DefaultIntervalMinutes = 15;
+        static constexpr int SubIntervalsPerInterval = 15; // 슬라이딩 수요의 서브 구간 개수
+        static constexpr std::array<int, 4> IntervalMinutes = {1, 5, 15, 30};
+    };
+
+    // 측정 데이터 기록(SQLite) 설정
+    struct Recorder {
+        static constexpr std::string_view DatabaseFileName = "measurements.db";
+        static constexpr size_t BatchSize = 60;              // 트랜잭션당 최대 행 수
+        static constexpr std::chrono::milliseconds FlushInterval{1000}; // 행이 적어도 이 주기로 기록
+        static constexpr size_t MaxPendingRows = 100'000;    // 초과 시 새 행은 버림 (호출 스레드는 대기하지 않음)
+    };
+
+    // 그래프 다운샘플링(LTTB) 설정
+    struct Downsampling {
+        static constexpr size_t ParallelThreshold = 65'536; // 이 이상의 점 수에서만 병렬 처리
+        static constexpr size_t MinPointsPerTask = 32'768;  // 작업 하나가 맡는 최소 점 수
+    };
+
+    // 화면 갱신(FramePresenter) 설정
+    struct Display {
+        static constexpr double DefaultFrameRate = 60.0; // 뷰 하나당 초당 최대 갱신 횟수
+        static constexpr double MinFrameRate = 1.0;
+        static constexpr double MaxFrameRate = 240.0;
+    };
+
+    // 스펙트럼 분석 창 함수 계수 (cos 급수 a0 - a1 cos x + a2 cos 2x - ...)
+    struct Window {
+        static constexpr std::array<double, 2> Hann = {0.5, 0.5};
+        static constexpr std::array<double, 2> Hamming = {0.54, 0.46};
+        static constexpr std::array<double, 4> BlackmanHarris = {0.35875, 0.48829, 0.14128, 0.01168}; // 4항, 최소 사이드로브
+        static constexpr std::array<double, 5> FlatTop = {0.21557895, 0.41663158, 0.277263158, 0.083578947, 0.006947368};
+        static constexpr double KaiserBeta = 8.6; // 사이드로브 약 -90dB
+    };
+
+    // 동기 재표본화(추적 주파수 한 주기 -> 2^k점) 설정
+    struct Resampling {
+        static constexpr int SincTaps = 16;             // Lanczos(a = 8) 커널 길이
+        static constexpr int SincPhases = 128;          // 다위상 표 행 수 (행 사이는 선형 보간)
+        static constexpr int MinSamplesPerCycle = 4;    // 이보다 적으면 재표본화 안 함
+        static constexpr double MaxPeriodRatio = 2.0;   // 허용 주기 범위: 사이클당 샘플 수의 1/비율 ~ 비율 배
+        static constexpr double CoherentTolerance = 0.01; // 주기와 사이클 버퍼 길이 차이가 이 이하(샘플)면 재표본화 생략
+    };
+
     // 수학 관련 상수
     struct Math {
         static constexpr double TwoPi = 2.0 * std::numbers::pi;
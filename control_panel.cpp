@@ -97,6 +97,8 @@ void ControlPanel::setupUi()
 
     m_autoScrollCheckBox = new QCheckBox("자동 스크롤");
     m_trackingButton = new QPushButton("자동 추적 시작", this);
+    m_streamingTrackingCheckBox = new QCheckBox("샘플 단위");
+    m_streamingTrackingCheckBox->setToolTip("SOGI-FLL로 매 샘플 주파수를 추적 (빠른 주파수 변화용)");
 
 
     // 스크롤 영역 생성
@@ -122,6 +124,7 @@ void ControlPanel::setupUi()
     buttonLayout->addWidget(m_startStopButton);
     buttonLayout->addWidget(m_settingButton);
     buttonLayout->addWidget(m_trackingButton);
+    buttonLayout->addWidget(m_streamingTrackingCheckBox);
     buttonLayout->addSpacerItem(new QSpacerItem(40, 20, QSizePolicy::Expanding, QSizePolicy::Minimum));
 
     // 기본 파라미터 그룹
@@ -295,6 +298,7 @@ void ControlPanel::createConnections()
             emit trackingToggled(true);
         }
     });
+    connect(m_streamingTrackingCheckBox, &QCheckBox::toggled, this, &ControlPanel::streamingTrackingToggled);
 
     // 파라미터 변경
     connect(m_voltageControlWidget, &ValueControlWidget::valueChanged, this, &ControlPanel::amplitudeChanged);
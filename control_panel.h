@@ -55,6 +55,7 @@ signals:
     void settingsClicked();
     void autoScrollToggled(bool enabled);
     void trackingToggled(bool enabled); // 자동 추적 토글 시그널
+    void streamingTrackingToggled(bool enabled); // 샘플 단위(SOGI-FLL) 추적 방식 선택
     void waveformVisibilityChanged(int type, bool isVisible);
     void analysisWaveformVisibilityChanged(int type, bool isVisible);
     void phasorVisibilityChanged(int type, bool isVisible);
@@ -98,6 +99,7 @@ private:
     // 자동 스크롤
     QCheckBox* m_autoScrollCheckBox;
     QPushButton* m_trackingButton;
+    QCheckBox* m_streamingTrackingCheckBox;
 
     // 화면 갱신
     QButtonGroup* m_updateModeGroup;
@@ -33,6 +33,7 @@ struct ControlPanelState {
         int samplesPerCycle = config::Sampling::DefaultSamplesPerCycle;
         UpdateMode updateMode = UpdateMode::PerCycle;
         int maxDataSize = config::Simulation::DataSize::DefaultDataSize;
+        int demandIntervalMinutes = config::Demand::DefaultIntervalMinutes;
     } simulation;
 
     // harmonics
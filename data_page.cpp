@@ -103,7 +103,7 @@ DataPage::DataPage(const QString& title,
     updateDisplay();
 }
 
-void DataPage::onDataUpdated(const OneSecondSummaryData& data)
+void DataPage::onDataUpdated(const OneSecondSummarySnapshot& data)
 {
     m_lastData = data;
     updateDisplay();
@@ -184,8 +184,8 @@ void DataPage::updateDisplay()
             } else if(showMin && i < currentSource.minExtractors.size()) {
                 auto valWithTime = currentSource.minExtractors[i](m_lastDemandData);
                 m_rowWidgets[i]->setValue(valWithTime.value, valWithTime.timestamp);
-            } else if(i < currentExtractors.size()) {
-                double value = currentExtractors[i](m_lastData);
+            } else if(m_lastData && i < currentExtractors.size()) {
+                double value = currentExtractors[i](*m_lastData);
                 m_rowWidgets[i]->setValue(value);
             }
         } else {
@@ -22,7 +22,7 @@ public:
                       QWidget* parent = nullptr);
 
 public slots:
-    void onDataUpdated(const OneSecondSummaryData& data);
+    void onDataUpdated(const OneSecondSummarySnapshot& data);
     void onDemandDataUpdated(const DemandData& data);
 
 private slots:
@@ -44,7 +44,7 @@ private:
     QButtonGroup* m_modeButtonGroup = nullptr;
     QButtonGroup* m_minMaxButtonGroup = nullptr;
 
-    OneSecondSummaryData m_lastData;
+    OneSecondSummarySnapshot m_lastData;
     DemandData m_lastDemandData;
 };
 
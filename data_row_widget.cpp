@@ -2,7 +2,7 @@
 
 #include <QLabel>
 #include <QVBoxLayout>
-#include <QDateTime>
+#include "UIutils.h"
 
 DataRowWidget::DataRowWidget(const QString& name, const QString& unit, bool hasLine, QWidget* parent)
     : QWidget{parent}
@@ -54,14 +54,14 @@ DataRowWidget::DataRowWidget(const QString& name, const QString& unit, bool hasL
 
 void DataRowWidget::setValue(double value)
 {
-    setValue(value, QDateTime());
+    setValue(value, ValueWithTimestamp<double>::NoTimestamp);
 }
 
-void DataRowWidget::setValue(double value, const QDateTime& timestamp)
+void DataRowWidget::setValue(double value, TrackerTimestamp timestamp)
 {
     m_valueLabel->setText(QString::number(value, 'f', 3));
-    if(timestamp.isValid()) {
-        m_timestampLabel->setText(timestamp.toString("yyyy-MM-dd HH:mm:ss"));
+    if(timestamp != ValueWithTimestamp<double>::NoTimestamp) {
+        m_timestampLabel->setText(UIutils::formatSimulationTime(timestamp));
         m_timestampLabel->show();
     } else {
         m_timestampLabel->hide();
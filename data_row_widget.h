@@ -2,6 +2,7 @@
 #define DATA_ROW_WIDGET_H
 
 #include <QWidget>
+#include "min_max_tracker.h"
 
 class QLabel;
 
@@ -13,7 +14,7 @@ public:
 
 public slots:
     void setValue(double value);
-    void setValue(double value, const QDateTime& timestamp);
+    void setValue(double value, TrackerTimestamp timestamp);
     void setLabel(const QString& label);
 
 private:
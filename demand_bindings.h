@@ -0,0 +1,138 @@
+#ifndef DEMAND_BINDINGS_H
+#define DEMAND_BINDINGS_H
+
+#include "demand_data.h"
+#include "measured_data.h"
+#include "demand_interval_tracker.h"
+
+// 수요 항목별 추적기 (DemandData의 수요 필드와 1:1)
+struct DemandTrackerSet {
+    DemandIntervalTracker totalActivePower;
+    DemandIntervalTracker totalReactivePower;
+    DemandIntervalTracker totalApparentPower;
+    GenericPhaseData<DemandIntervalTracker> current;
+    DemandIntervalTracker totalPowerFactor;
+
+    template <typename Func>
+    void forEach(Func&& func) {
+        func(totalActivePower);
+        func(totalReactivePower);
+        func(totalApparentPower);
+        func(current.a);
+        func(current.b);
+        func(current.c);
+        func(totalPowerFactor);
+    }
+};
+
+// DemandCalculator 바인딩 정의
+// 각 바인딩은 (DemandData 멤버 포인터, OneSecondSummaryData 멤버 포인터)를 템플릿 인자로 갖는 빈 타입.
+// constexpr tuple에 나열한 뒤 fold expression으로 펼치므로 힙 할당과 간접 호출이 없음.
+namespace DemandBinding {
+    using Timestamp = TrackerTimestamp;
+
+    // 원본 값에서 추적 대상 스칼라 추출
+    inline double valueOf(double v) { return v; }
+    inline double valueOf(const HarmonicAnalysisResult& h) { return h.rms; }
+    inline double valueOf(const SymmetricalComponent& s) { return s.magnitude; }
+
+    // 단일 항목 (MinMaxTracker / MaxTracker)
+    template <auto Target, auto Source>
+    struct Single {
+        static void apply(DemandData& d, const OneSecondSummaryData& s, const Timestamp& t, DemandTrackerSet&) {
+            (d.*Target).update(valueOf(s.*Source), t);
+        }
+    };
+
+    // 3상 그룹 (a, b, c)
+    template <auto Target, auto Source>
+    struct Phase {
+        static void apply(DemandData& d, const OneSecondSummaryData& s, const Timestamp& t, DemandTrackerSet&) {
+            auto& target = d.*Target;
+            const auto& source = s.*Source;
+            target.a.update(valueOf(source.a), t);
+            target.b.update(valueOf(source.b), t);
+            target.c.update(valueOf(source.c), t);
+        }
+    };
+
+    // 선간 그룹 (ab, bc, ca)
+    template <auto Target, auto Source>
+    struct LineToLine {
+        static void apply(DemandData& d, const OneSecondSummaryData& s, const Timestamp& t, DemandTrackerSet&) {
+            auto& target = d.*Target;
+            const auto& source = s.*Source;
+            target.ab.update(valueOf(source.ab), t);
+            target.bc.update(valueOf(source.bc), t);
+            target.ca.update(valueOf(source.ca), t);
+        }
+    };
+
+    // 3상 평균
+    template <auto Target, auto Source>
+    struct PhaseAverage {
+        static void apply(DemandData& d, const OneSecondSummaryData& s, const Timestamp& t, DemandTrackerSet&) {
+            const auto& source = s.*Source;
+            (d.*Target).update((valueOf(source.a) + valueOf(source.b) + valueOf(source.c)) / 3.0, t);
+        }
+    };
+
+    // 선간 평균
+    template <auto Target, auto Source>
+    struct LineToLineAverage {
+        static void apply(DemandData& d, const OneSecondSummaryData& s, const Timestamp& t, DemandTrackerSet&) {
+            const auto& source = s.*Source;
+            (d.*Target).update((valueOf(source.ab) + valueOf(source.bc) + valueOf(source.ca)) / 3.0, t);
+        }
+    };
+
+    // 대칭 성분 (선간은 영상분 없음)
+    template <auto Target, auto Source>
+    struct Symmetrical {
+        static void apply(DemandData& d, const OneSecondSummaryData& s, const Timestamp& t, DemandTrackerSet&) {
+            auto& target = d.*Target;
+            const auto& source = s.*Source;
+            if constexpr (requires { target.zero; }) {
+                target.zero.update(valueOf(source.zero), t);
+            }
+            target.positive.update(valueOf(source.positive), t);
+            target.negative.update(valueOf(source.negative), t);
+        }
+    };
+
+    // 단일 항목 수요
+    template <auto Target, auto Source, auto Tracker>
+    struct Demand {
+        static void apply(DemandData& d, const OneSecondSummaryData& s, const Timestamp& t, DemandTrackerSet& trackers) {
+            auto& tracker = trackers.*Tracker;
+            tracker.update(valueOf(s.*Source), t);
+            d.*Target = tracker.values();
+        }
+    };
+
+    // 3상 수요
+    template <auto Target, auto Source, auto Tracker>
+    struct PhaseDemand {
+        static void apply(DemandData& d, const OneSecondSummaryData& s, const Timestamp& t, DemandTrackerSet& trackers) {
+            auto& tracker = trackers.*Tracker;
+            auto& target = d.*Target;
+            const auto& source = s.*Source;
+            tracker.a.update(valueOf(source.a), t);
+            tracker.b.update(valueOf(source.b), t);
+            tracker.c.update(valueOf(source.c), t);
+            target.a = tracker.a.values();
+            target.b = tracker.b.values();
+            target.c = tracker.c.values();
+        }
+    };
+
+    // 바인딩 tuple 전체를 한 번에 적용
+    template <typename Tuple>
+    inline void applyAll(const Tuple& bindings, DemandData& d, const OneSecondSummaryData& s, const Timestamp& t, DemandTrackerSet& trackers) {
+        std::apply([&](const auto&... binding) {
+            (binding.apply(d, s, t, trackers), ...);
+        }, bindings);
+    }
+}
+
+#endif // DEMAND_BINDINGS_H
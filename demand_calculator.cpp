@@ -1,91 +1,117 @@
 #include "demand_calculator.h"
+#include "config.h"
+#include <QDebug>
+#include <algorithm>
+
+namespace {
+    using namespace DemandBinding;
+
+    // --- 바인딩 테이블 (DemandData 필드 <- OneSecondSummaryData 필드) ---
+    constexpr auto Bindings = std::tuple{
+        // --- Min Max 추적 항목 ---
+
+        // 전압 RMS
+        Phase<&DemandData::totalVoltageRms, &OneSecondSummaryData::totalVoltageRms>{},
+        PhaseAverage<&DemandData::averageTotalVoltageRms, &OneSecondSummaryData::totalVoltageRms>{},
+        LineToLine<&DemandData::totalVoltageRms_ll, &OneSecondSummaryData::totalVoltageRms_ll>{},
+        LineToLineAverage<&DemandData::averageTotalVoltageRms_ll, &OneSecondSummaryData::totalVoltageRms_ll>{},
+
+        // 전압 기본파
+        Phase<&DemandData::fundamentalVoltageRMS, &OneSecondSummaryData::fundamentalVoltage>{},
+        PhaseAverage<&DemandData::averageFundamentalVoltageRms, &OneSecondSummaryData::fundamentalVoltage>{},
+        LineToLine<&DemandData::fundamentalVoltageRMS_ll, &OneSecondSummaryData::fundamentalVoltage_ll>{},
+        LineToLineAverage<&DemandData::averageFundamentalVoltageRms_ll, &OneSecondSummaryData::fundamentalVoltage_ll>{},
+
+        // 전류 RMS
+        Phase<&DemandData::totalCurrentRms, &OneSecondSummaryData::totalCurrentRms>{},
+        PhaseAverage<&DemandData::averageTotalCurrentRms, &OneSecondSummaryData::totalCurrentRms>{},
+
+        // 전류 기본파
+        Phase<&DemandData::fundamentalCurrentRMS, &OneSecondSummaryData::fundamentalCurrent>{},
+        PhaseAverage<&DemandData::averageFundamentalCurrentRms, &OneSecondSummaryData::fundamentalCurrent>{},
+
+        // 주파수
+        Single<&DemandData::frequency, &OneSecondSummaryData::frequency>{},
+
+        // Residual
+        Single<&DemandData::voltageResidualRms, &OneSecondSummaryData::residualVoltageRms>{},
+        Single<&DemandData::voltageResidualFundamental, &OneSecondSummaryData::residualVoltageFundamental>{},
+        Single<&DemandData::currentResidualRms, &OneSecondSummaryData::residualCurrentRms>{},
+        Single<&DemandData::currentResidualFundamental, &OneSecondSummaryData::residualCurrentFundamental>{},
+
+        // 전력 및 역률
+        Phase<&DemandData::activePower, &OneSecondSummaryData::activePower>{},
+        Phase<&DemandData::reactivePower, &OneSecondSummaryData::reactivePower>{},
+        Phase<&DemandData::apparentPower, &OneSecondSummaryData::apparentPower>{},
+        Single<&DemandData::totalActivePower, &OneSecondSummaryData::totalActivePower>{},
+        Single<&DemandData::totalReactivePower, &OneSecondSummaryData::totalReactivePower>{},
+        Single<&DemandData::totalApparentPower, &OneSecondSummaryData::totalApparentPower>{},
+
+        Phase<&DemandData::powerFactor, &OneSecondSummaryData::powerFactor>{},
+        Single<&DemandData::totalPowerFactor, &OneSecondSummaryData::totalPowerFactor>{},
+
+        // --- max만 추적 항목 ---
+
+        // THD
+        Phase<&DemandData::voltageThd, &OneSecondSummaryData::voltageThd>{},
+        LineToLine<&DemandData::voltageThd_ll, &OneSecondSummaryData::voltageThd_ll>{},
+        Phase<&DemandData::currentThd, &OneSecondSummaryData::currentThd>{},
+
+        // 대칭 성분
+        Symmetrical<&DemandData::voltageSymmetricalComponents, &OneSecondSummaryData::voltageSymmetricalComponents>{},
+        Symmetrical<&DemandData::voltageSymmetricalComponents_ll, &OneSecondSummaryData::voltageSymmetricalComponents_ll>{},
+        Symmetrical<&DemandData::currentSymmetricalComponents, &OneSecondSummaryData::currentSymmetricalComponents>{},
+
+        // 불평형률
+        Single<&DemandData::nemaVoltageUnbalance_ll, &OneSecondSummaryData::nemaVoltageUnbalance_ll>{},
+        Single<&DemandData::nemaVoltageUnbalance, &OneSecondSummaryData::nemaVoltageUnbalance>{},
+        Single<&DemandData::voltageU2Unbalance, &OneSecondSummaryData::voltageU2Unbalance>{},
+        Single<&DemandData::voltageU0Unbalance, &OneSecondSummaryData::voltageU0Unbalance>{},
+        Single<&DemandData::nemaCurrentUnbalance, &OneSecondSummaryData::nemaCurrentUnbalance>{},
+        Single<&DemandData::currentU2Unbalance, &OneSecondSummaryData::currentU2Unbalance>{},
+        Single<&DemandData::currentU0Unbalance, &OneSecondSummaryData::currentU0Unbalance>{},
+
+        // --- 수요(Demand) 항목 ---
+        Demand<&DemandData::totalActivePowerDemand, &OneSecondSummaryData::totalActivePower, &DemandTrackerSet::totalActivePower>{},
+        Demand<&DemandData::totalReactivePowerDemand, &OneSecondSummaryData::totalReactivePower, &DemandTrackerSet::totalReactivePower>{},
+        Demand<&DemandData::totalApparentPowerDemand, &OneSecondSummaryData::totalApparentPower, &DemandTrackerSet::totalApparentPower>{},
+        PhaseDemand<&DemandData::currentDemand, &OneSecondSummaryData::totalCurrentRms, &DemandTrackerSet::current>{},
+        Demand<&DemandData::totalPowerFactorDemand, &OneSecondSummaryData::totalPowerFactor, &DemandTrackerSet::totalPowerFactor>{}
+    };
+}
 
 DemandCalculator::DemandCalculator(QObject *parent)
     : QObject{parent}
-{
-    initializeMapping();
-}
+    , m_demandIntervalMinutes(config::Demand::DefaultIntervalMinutes)
+{}
 
-void DemandCalculator::processOneSecondData(const OneSecondSummaryData& summary)
+int DemandCalculator::demandIntervalMinutes() const { return m_demandIntervalMinutes; }
+
+void DemandCalculator::processOneSecondData(const OneSecondSummarySnapshot& snapshot)
 {
-    const QDateTime now = QDateTime::currentDateTime();
+    if(!snapshot) return;
+    const OneSecondSummaryData& summary = *snapshot;
 
-    // 등록된 모든 매핑에 대해 업데이트 실시
-    for(const auto& updater : m_mappings) {
-        updater(m_demandData, summary, now);
-    }
+    // 벽시계가 아닌 엔진의 시뮬레이션 시간을 타임스탬프로 사용
+    const TrackerTimestamp timestamp = summary.timestamp;
+    m_demandData.timestamp = timestamp;
+
+    // 등록된 모든 바인딩을 컴파일 타임에 펼쳐서 적용
+    DemandBinding::applyAll(Bindings, m_demandData, summary, timestamp, m_demandTrackers);
 
     emit demandDataUpdated(m_demandData);
 }
 
-void DemandCalculator::initializeMapping()
+void DemandCalculator::setDemandInterval(int minutes)
 {
-    // --- Min Max 추적 항목 ---
-
-    // 전압 RMS
-    bindPhaseGroup(&DemandData::totalVoltageRms, &OneSecondSummaryData::totalVoltageRms);
-    bindPhaseAverage(&DemandData::averageTotalVoltageRms, &OneSecondSummaryData::totalVoltageRms);
-
-    bindLinetoLineGroup(&DemandData::totalVoltageRms_ll, &OneSecondSummaryData::totalVoltageRms_ll);
-    bindLinetoLineAverage(&DemandData::averageTotalVoltageRms_ll, &OneSecondSummaryData::totalVoltageRms_ll);
-
-    // 전압 기본파
-    auto extractRms = [](const HarmonicAnalysisResult& h) { return h.rms; };
-
-    bindPhaseGroup(&DemandData::fundamentalVoltageRMS, &OneSecondSummaryData::fundamentalVoltage, extractRms);
-    bindPhaseAverage(&DemandData::averageFundamentalVoltageRms, &OneSecondSummaryData::fundamentalVoltage, extractRms);
-
-    bindLinetoLineGroup(&DemandData::fundamentalVoltageRMS_ll, &OneSecondSummaryData::fundamentalVoltage_ll, extractRms);
-    bindLinetoLineAverage(&DemandData::averageFundamentalVoltageRms_ll, &OneSecondSummaryData::fundamentalVoltage_ll, extractRms);
-
-    // 전류 RMS
-    bindPhaseGroup(&DemandData::totalCurrentRms, &OneSecondSummaryData::totalCurrentRms);
-    bindPhaseAverage(&DemandData::averageTotalCurrentRms, &OneSecondSummaryData::totalCurrentRms);
-
-    // 전류 기본파
-    bindPhaseGroup(&DemandData::fundamentalCurrentRMS, &OneSecondSummaryData::fundamentalCurrent, extractRms);
-    bindPhaseAverage(&DemandData::averageFundamentalCurrentRms, &OneSecondSummaryData::fundamentalCurrent, extractRms);
-
-    // 주파수
-    bindMinMax(&DemandData::frequency, &OneSecondSummaryData::frequency);
-
-    // Residual
-    bindMinMax(&DemandData::voltageResidualRms, &OneSecondSummaryData::residualVoltageRms);
-    bindMinMax(&DemandData::voltageResidualFundamental, &OneSecondSummaryData::residualVoltageFundamental);
-    bindMinMax(&DemandData::currentResidualRms, &OneSecondSummaryData::residualCurrentRms);
-    bindMinMax(&DemandData::currentResidualFundamental, &OneSecondSummaryData::residualCurrentFundamental);
-
-    // 전력 및 역률
-    bindPhaseGroup(&DemandData::activePower, &OneSecondSummaryData::activePower);
-    bindPhaseGroup(&DemandData::reactivePower, &OneSecondSummaryData::reactivePower);
-    bindPhaseGroup(&DemandData::apparentPower, &OneSecondSummaryData::apparentPower);
-    bindMinMax(&DemandData::totalActivePower, &OneSecondSummaryData::totalActivePower);
-    bindMinMax(&DemandData::totalReactivePower, &OneSecondSummaryData::totalReactivePower);
-    bindMinMax(&DemandData::totalApparentPower, &OneSecondSummaryData::totalApparentPower);
-
-    bindPhaseGroup(&DemandData::powerFactor, &OneSecondSummaryData::powerFactor);
-    bindMinMax(&DemandData::totalPowerFactor, &OneSecondSummaryData::totalPowerFactor);
-
-    // --- max만 추적 항목 ---
-
-    // THD
-    bindPhaseGroupMaxOnly(&DemandData::voltageThd, &OneSecondSummaryData::voltageThd);
-    bindLinetoLineGroupMaxOnly(&DemandData::voltageThd_ll, &OneSecondSummaryData::voltageThd_ll);
-    bindPhaseGroupMaxOnly(&DemandData::currentThd, &OneSecondSummaryData::currentThd);
-
-    // 대칭 성분
-    bindPhaseSymmetricalGroup(&DemandData::voltageSymmetricalComponents, &OneSecondSummaryData::voltageSymmetricalComponents);
-    bindLineToLineSymmetricalGroup(&DemandData::voltageSymmetricalComponents_ll, &OneSecondSummaryData::voltageSymmetricalComponents_ll);
-
-    bindPhaseSymmetricalGroup(&DemandData::currentSymmetricalComponents, &OneSecondSummaryData::currentSymmetricalComponents);
-
+    const auto& allowed = config::Demand::IntervalMinutes;
+    if(std::find(allowed.begin(), allowed.end(), minutes) == allowed.end()) {
+        qWarning() << "DemandCalculator: Unsupported demand interval" << minutes << "min";
+        return;
+    }
 
-    // 불평형률
-    bindMaxOnly(&DemandData::nemaVoltageUnbalance_ll, &OneSecondSummaryData::nemaVoltageUnbalance_ll);
-    bindMaxOnly(&DemandData::nemaVoltageUnbalance, &OneSecondSummaryData::nemaVoltageUnbalance);
-    bindMaxOnly(&DemandData::voltageU2Unbalance, &OneSecondSummaryData::voltageU2Unbalance);
-    bindMaxOnly(&DemandData::voltageU0Unbalance, &OneSecondSummaryData::voltageU0Unbalance);
-    bindMaxOnly(&DemandData::nemaCurrentUnbalance, &OneSecondSummaryData::nemaCurrentUnbalance);
-    bindMaxOnly(&DemandData::currentU2Unbalance, &OneSecondSummaryData::currentU2Unbalance);
-    bindMaxOnly(&DemandData::currentU0Unbalance, &OneSecondSummaryData::currentU0Unbalance);
+    m_demandIntervalMinutes = minutes;
+    m_demandTrackers.forEach([minutes](DemandIntervalTracker& tracker) {
+        tracker.configure(minutes * 60, config::Demand::SubIntervalsPerInterval);
+    });
 }
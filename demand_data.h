@@ -2,11 +2,14 @@
 #define DEMAND_DATA_H
 
 #include "min_max_tracker.h"
+#include "demand_interval_tracker.h"
 #include "shared_data_types.h"
 
 // Max/Min 추적 대상이 되는 모든 계측 항목들
 struct DemandData
 {
+    std::chrono::nanoseconds timestamp{0}; // 마지막 갱신 시각 (시뮬레이션 시간)
+
     // RMS
     GenericPhaseData<MinMaxTracker<double>> totalVoltageRms;
     GenericLinetoLineData<MinMaxTracker<double>> totalVoltageRms_ll;
@@ -64,6 +67,13 @@ struct DemandData
     MaxTracker<double> nemaCurrentUnbalance;
     MaxTracker<double> currentU2Unbalance; // Negative-Sequence
     MaxTracker<double> currentU0Unbalance; // Zero-Sequence
+
+    // --- 수요(Demand): 구간 평균 및 최대 수요 ---
+    DemandValues totalActivePowerDemand;
+    DemandValues totalReactivePowerDemand;
+    DemandValues totalApparentPowerDemand;
+    GenericPhaseData<DemandValues> currentDemand;
+    DemandValues totalPowerFactorDemand;
 };
 
 #endif // DEMAND_DATA_H
@@ -0,0 +1,91 @@
+#include "demand_interval_tracker.h"
+#include <algorithm>
+#include <cmath>
+#include <numbers>
+
+DemandIntervalTracker::DemandIntervalTracker(int intervalSeconds, int subIntervalCount)
+{
+    configure(intervalSeconds, subIntervalCount);
+}
+
+void DemandIntervalTracker::configure(int intervalSeconds, int subIntervalCount)
+{
+    m_intervalSeconds = std::max(1, intervalSeconds);
+    subIntervalCount = std::clamp(subIntervalCount, 1, m_intervalSeconds);
+    m_subIntervalSeconds = m_intervalSeconds / subIntervalCount;
+
+    m_subIntervalAverages.assign(subIntervalCount, 0.0);
+
+    const double tau = m_intervalSeconds / std::numbers::ln10;
+    m_thermalAlpha = 1.0 - std::exp(-1.0 / tau);
+
+    reset();
+}
+
+void DemandIntervalTracker::update(double value, TrackerTimestamp timestamp)
+{
+    if(std::isnan(value)) return;
+
+    ++m_elapsedSeconds;
+
+    // 1. 열적 수요
+    m_values.thermal += (value - m_values.thermal) * m_thermalAlpha;
+    m_values.peakThermal.update(m_values.thermal, timestamp);
+
+    // 2. 윈도우 최대값 (단조 덱)
+    while(!m_windowMaxDeque.empty() && m_windowMaxDeque.back().second <= value) {
+        m_windowMaxDeque.pop_back();
+    }
+    m_windowMaxDeque.emplace_back(m_elapsedSeconds, value);
+    while(m_windowMaxDeque.front().first <= m_elapsedSeconds - m_intervalSeconds) {
+        m_windowMaxDeque.pop_front();
+    }
+    m_values.windowMax = m_windowMaxDeque.front().second;
+
+    // 3. 블록 수요
+    m_blockSum += value;
+    if(++m_blockCount >= m_intervalSeconds) {
+        m_values.block = m_blockSum / m_blockCount;
+        m_values.peakBlock.update(m_values.block, timestamp);
+        m_blockSum = 0.0;
+        m_blockCount = 0;
+    }
+
+    // 4. 슬라이딩 수요 (서브 구간 종료 시마다 갱신)
+    m_subIntervalSum += value;
+    if(++m_subIntervalSampleCount >= m_subIntervalSeconds) {
+        const double average = m_subIntervalSum / m_subIntervalSampleCount;
+        m_subIntervalSum = 0.0;
+        m_subIntervalSampleCount = 0;
+
+        // 가장 오래된 서브 구간을 누적 합에서 빼고 새 값으로 교체
+        m_subIntervalAverageSum -= m_subIntervalAverages[m_subIntervalHead];
+        m_subIntervalAverages[m_subIntervalHead] = average;
+        m_subIntervalAverageSum += average;
+        m_subIntervalHead = (m_subIntervalHead + 1) % m_subIntervalAverages.size();
+        m_subIntervalFilled = std::min(m_subIntervalFilled + 1, m_subIntervalAverages.size());
+
+        // 윈도우가 다 채워지기 전에는 채워진 서브 구간만 평균
+        m_values.sliding = m_subIntervalAverageSum / static_cast<double>(m_subIntervalFilled);
+        m_values.peakSliding.update(m_values.sliding, timestamp);
+    }
+}
+
+const DemandValues& DemandIntervalTracker::values() const { return m_values; }
+
+void DemandIntervalTracker::reset()
+{
+    m_elapsedSeconds = 0;
+    m_blockSum = 0.0;
+    m_blockCount = 0;
+    m_subIntervalSum = 0.0;
+    m_subIntervalSampleCount = 0;
+    std::fill(m_subIntervalAverages.begin(), m_subIntervalAverages.end(), 0.0);
+    m_subIntervalHead = 0;
+    m_subIntervalFilled = 0;
+    m_subIntervalAverageSum = 0.0;
+    m_windowMaxDeque.clear();
+
+    m_values = DemandValues{};
+    m_values.thermal = 0.0; // 열적 수요는 0에서 시작
+}
@@ -0,0 +1,66 @@
+#ifndef DEMAND_INTERVAL_TRACKER_H
+#define DEMAND_INTERVAL_TRACKER_H
+
+#include "min_max_tracker.h"
+#include "config.h"
+#include <deque>
+#include <vector>
+
+// 한 항목의 수요(Demand) 값과 최대 수요 레지스터
+struct DemandValues {
+    double block = std::numeric_limits<double>::quiet_NaN();     // 마지막으로 완료된 블록 구간 평균
+    double sliding = std::numeric_limits<double>::quiet_NaN();   // 슬라이딩 수요 (서브 구간 평균의 이동 평균)
+    double thermal = std::numeric_limits<double>::quiet_NaN();   // 열적 수요 (1차 지수 응답)
+    double windowMax = std::numeric_limits<double>::quiet_NaN(); // 슬라이딩 윈도우 내 1초 값 최대
+
+    MaxTracker<double> peakBlock;
+    MaxTracker<double> peakSliding;
+    MaxTracker<double> peakThermal;
+};
+
+// DemandIntervalTracker 클래스
+// 1초 값을 입력받아 블록/슬라이딩/열적 수요를 계산.
+// 슬라이딩 수요는 서브 구간 평균의 링 버퍼와 누적 합,
+// 윈도우 최대값은 단조 덱(monotonic deque)을 사용하므로 구간 길이와 무관하게 입력당 O(1).
+class DemandIntervalTracker
+{
+public:
+    explicit DemandIntervalTracker(int intervalSeconds = config::Demand::DefaultIntervalMinutes * 60,
+                                   int subIntervalCount = config::Demand::SubIntervalsPerInterval);
+
+    // 구간 재설정 (누적 상태와 최대 수요 레지스터 초기화)
+    void configure(int intervalSeconds, int subIntervalCount);
+
+    // 1초 값 입력 (NaN은 무시)
+    void update(double value, TrackerTimestamp timestamp);
+
+    const DemandValues& values() const;
+    void reset();
+
+private:
+    int m_intervalSeconds;
+    int m_subIntervalSeconds;
+    long long m_elapsedSeconds;
+
+    // 블록 수요
+    double m_blockSum;
+    int m_blockCount;
+
+    // 슬라이딩 수요: 서브 구간 평균 링 버퍼
+    double m_subIntervalSum;
+    int m_subIntervalSampleCount;
+    std::vector<double> m_subIntervalAverages;
+    size_t m_subIntervalHead;
+    size_t m_subIntervalFilled;
+    double m_subIntervalAverageSum;
+
+    // 윈도우 최대값: (경과 초, 값) 단조 감소 덱
+    std::deque<std::pair<long long, double>> m_windowMaxDeque;
+
+    // 열적 수요: 구간 길이 동안 90% 응답 (tau = interval / ln10)
+    double m_thermalAlpha;
+
+    DemandValues m_values;
+};
+
+#endif // DEMAND_INTERVAL_TRACKER_H
@@ -0,0 +1,314 @@
+#include "flickermeter.h"
+#include "config.h"
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <numbers>
+
+namespace {
+    constexpr double NaN = std::numeric_limits<double>::quiet_NaN();
+    constexpr double TwoPi = 2.0 * std::numbers::pi;
+
+    // 230V 60W 백열등 램프-눈 가중 필터 (IEC 61000-4-15 표준 파라미터)
+    // K·ω1·s / (s² + 2λs + ω1²) · (1 + s/ω2) / ((1 + s/ω3)(1 + s/ω4))
+    struct LampWeighting {
+        static constexpr double K = 1.74802;
+        static constexpr double Lambda = TwoPi * 4.05981;
+        static constexpr double Omega1 = TwoPi * 9.15494;
+        static constexpr double Omega2 = TwoPi * 2.27979;
+        static constexpr double Omega3 = TwoPi * 1.22535;
+        static constexpr double Omega4 = TwoPi * 21.9;
+    };
+
+    // 단기 플리커 식의 (가중치, 평활에 쓰는 백분위수들)
+    struct PstTerm {
+        double weight;
+        std::array<double, 5> percents;
+        int count;
+    };
+    constexpr std::array<PstTerm, 5> PstTerms = {{
+        {0.0314, {0.1}, 1},
+        {0.0525, {0.7, 1.0, 1.5}, 3},
+        {0.0657, {2.2, 3.0, 4.0}, 3},
+        {0.28, {6.0, 8.0, 10.0, 13.0, 17.0}, 5},
+        {0.08, {30.0, 50.0, 80.0}, 3},
+    }};
+
+    double alphaFor(double timeConstantSec, double sampleRateHz)
+    {
+        return 1.0 - std::exp(-1.0 / (timeConstantSec * sampleRateHz));
+    }
+}
+
+// ---- FlickerClassifier ----
+
+FlickerClassifier::FlickerClassifier()
+    : m_counts(config::Flicker::ClassCount, 0)
+{
+    using C = config::Flicker;
+    m_inverseLogRatio = C::ClassCount / std::log(C::ClassMax / C::ClassMin);
+}
+
+void FlickerClassifier::add(double pinst)
+{
+    ++m_counts[classIndex(pinst)];
+    ++m_total;
+}
+
+void FlickerClassifier::clear()
+{
+    std::ranges::fill(m_counts, 0);
+    m_total = 0;
+}
+
+double FlickerClassifier::percentile(double percent) const
+{
+    if(m_total == 0) {
+        return NaN;
+    }
+    // 위 클래스부터 누적해 초과 샘플 수가 목표에 닿는 클래스 안에서 보간
+    const double target = m_total * percent / 100.0;
+    double above = 0.0;
+    for(size_t i = m_counts.size(); i-- > 0;) {
+        const double count = static_cast<double>(m_counts[i]);
+        if(count > 0.0 && above + count >= target) {
+            const double lower = classLower(i);
+            const double upper = classUpper(i);
+            return upper - (target - above) / count * (upper - lower);
+        }
+        above += count;
+    }
+    return 0.0;
+}
+
+double FlickerClassifier::pst() const
+{
+    if(m_total == 0) {
+        return NaN;
+    }
+    double sum = 0.0;
+    for(const auto& term : PstTerms) {
+        double smoothed = 0.0;
+        for(int i = 0; i < term.count; ++i) {
+            smoothed += percentile(term.percents[i]);
+        }
+        sum += term.weight * smoothed / term.count;
+    }
+    return std::sqrt(sum);
+}
+
+size_t FlickerClassifier::classIndex(double value) const
+{
+    using C = config::Flicker;
+    if(!(value > C::ClassMin)) {
+        return 0; // 하한 미만(0, NaN 포함)은 첫 클래스
+    }
+    const auto index = static_cast<size_t>(std::log(value / C::ClassMin) * m_inverseLogRatio);
+    return std::min(index, m_counts.size() - 1);
+}
+
+double FlickerClassifier::classLower(size_t index) const
+{
+    // 첫 클래스는 0부터 (정상 상태의 Pinst ≈ 0을 하한값으로 올려 잡지 않도록)
+    return (index == 0) ? 0.0 : config::Flicker::ClassMin * std::exp(index / m_inverseLogRatio);
+}
+
+double FlickerClassifier::classUpper(size_t index) const
+{
+    return config::Flicker::ClassMin * std::exp((index + 1) / m_inverseLogRatio);
+}
+
+// ---- Flickermeter::Biquad ----
+
+void Flickermeter::Biquad::design(const std::array<double, 3>& num, const std::array<double, 3>& den, double sampleRateHz)
+{
+    // s = c (1 - z⁻¹) / (1 + z⁻¹)
+    const double c = 2.0 * sampleRateHz;
+    const double c2 = c * c;
+    const double a0 = den[2] * c2 + den[1] * c + den[0];
+    b0 = (num[2] * c2 + num[1] * c + num[0]) / a0;
+    b1 = 2.0 * (num[0] - num[2] * c2) / a0;
+    b2 = (num[2] * c2 - num[1] * c + num[0]) / a0;
+    a1 = 2.0 * (den[0] - den[2] * c2) / a0;
+    a2 = (den[2] * c2 - den[1] * c + den[0]) / a0;
+}
+
+void Flickermeter::Biquad::process(Lanes& x)
+{
+    for(size_t i = 0; i < x.size(); ++i) {
+        const double in = x[i];
+        const double out = b0 * in + z1[i];
+        z1[i] = b1 * in - a1 * out + z2[i];
+        z2[i] = b2 * in - a2 * out;
+        x[i] = out;
+    }
+}
+
+void Flickermeter::Biquad::prime(double dc)
+{
+    const double out = dc * (b0 + b1 + b2) / (1.0 + a1 + a2);
+    const double s2 = b2 * dc - a2 * out;
+    const double s1 = b1 * dc - a1 * out + s2;
+    z1.fill(s1);
+    z2.fill(s2);
+}
+
+std::complex<double> Flickermeter::Biquad::response(double normalizedOmega) const
+{
+    const std::complex<double> z1Inv = std::polar(1.0, -normalizedOmega);
+    const std::complex<double> z2Inv = z1Inv * z1Inv;
+    return (b0 + b1 * z1Inv + b2 * z2Inv) / (1.0 + a1 * z1Inv + a2 * z2Inv);
+}
+
+// ---- Flickermeter ----
+
+Flickermeter::Flickermeter()
+    : m_chain(6)
+{
+    m_pst.fill(NaN);
+    m_plt.fill(NaN);
+}
+
+void Flickermeter::configure(double sampleRateHz, double nominalFrequencyHz)
+{
+    using C = config::Flicker;
+    if(sampleRateHz == m_sampleRate && nominalFrequencyHz == m_nominalFrequency) {
+        return;
+    }
+    m_sampleRate = sampleRateHz;
+    m_nominalFrequency = nominalFrequencyHz;
+    m_enabled = sampleRateHz >= C::MinSampleRateHz;
+    if(!m_enabled) {
+        return;
+    }
+    m_samplePeriod = 1.0 / sampleRateHz;
+
+    // HPF: s / (s + ωh)
+    const double omegaHigh = TwoPi * C::HighPassCutoffHz;
+    m_chain[0].design({0.0, 1.0, 0.0}, {omegaHigh, 1.0, 0.0}, sampleRateHz);
+
+    // 6차 Butterworth LPF: 극점 쌍마다 ωc² / (s² + 2 sin((2k-1)π/12) ωc s + ωc²)
+    const double cutoff = (nominalFrequencyHz > 55.0) ? C::LowPassCutoff60HzHz : C::LowPassCutoff50HzHz;
+    const double omegaLow = TwoPi * cutoff;
+    for(int k = 1; k <= 3; ++k) {
+        const double damping = 2.0 * std::sin((2 * k - 1) * std::numbers::pi / 12.0);
+        m_chain[k].design({omegaLow * omegaLow, 0.0, 0.0}, {omegaLow * omegaLow, damping * omegaLow, 1.0}, sampleRateHz);
+    }
+
+    // 램프-눈 가중 필터 (2차 + 2차)
+    using W = LampWeighting;
+    m_chain[4].design({0.0, W::K * W::Omega1, 0.0}, {W::Omega1 * W::Omega1, 2.0 * W::Lambda, 1.0}, sampleRateHz);
+    m_chain[5].design({1.0, 1.0 / W::Omega2, 0.0},
+                      {1.0, 1.0 / W::Omega3 + 1.0 / W::Omega4, 1.0 / (W::Omega3 * W::Omega4)}, sampleRateHz);
+
+    // 기준 변조(ΔV/V)는 정규화·제곱 후 진폭 ΔV/V의 정현파가 되므로,
+    // 체인 이득 |H|를 지난 제곱 평균 (ΔV/V·|H|)²/2가 1이 되도록 교정
+    const double omegaRef = TwoPi * C::ReferenceFrequencyHz / sampleRateHz;
+    double gain = 1.0;
+    for(const auto& stage : m_chain) {
+        gain *= std::abs(stage.response(omegaRef));
+    }
+    const double reference = C::ReferenceModulation * gain;
+    m_scale = 2.0 / (reference * reference);
+
+    m_normalizationAlpha = alphaFor(C::NormalizationTimeConstantSec, sampleRateHz);
+    m_smoothingAlpha = alphaFor(C::SmoothingTimeConstantSec, sampleRateHz);
+    m_decimation = std::max(1, static_cast<int>(std::lround(sampleRateHz / C::ClassifierRateHz)));
+}
+
+void Flickermeter::setNominalVoltages(const Lanes& rms)
+{
+    m_nominalRms = rms;
+}
+
+void Flickermeter::reset()
+{
+    m_primed = false;
+    m_pinst.fill(0.0);
+    m_pst.fill(NaN);
+    m_plt.fill(NaN);
+    m_decimationCount = 0;
+    m_elapsedSec = 0.0;
+    for(auto& classifier : m_classifiers) {
+        classifier.clear();
+    }
+    for(auto& history : m_pstHistory) {
+        history.clear();
+    }
+}
+
+void Flickermeter::process(const Lanes& voltage)
+{
+    if(!m_enabled) {
+        return;
+    }
+
+    Lanes x;
+    for(size_t i = 0; i < x.size(); ++i) {
+        x[i] = voltage[i] * voltage[i];
+    }
+
+    if(!m_primed) {
+        // 정규화 입력의 직류(1)에 대해 정상 상태로 시작해 HPF의 긴 과도 응답을 피함
+        for(size_t i = 0; i < x.size(); ++i) {
+            m_meanSquare[i] = (m_nominalRms[i] > 0.0) ? m_nominalRms[i] * m_nominalRms[i] : x[i];
+        }
+        m_chain[0].prime(1.0);
+        for(size_t k = 1; k < m_chain.size(); ++k) {
+            m_chain[k].prime(0.0);
+        }
+        m_primed = true;
+    }
+
+    // 1~2. 정규화된 제곱 전압
+    for(size_t i = 0; i < x.size(); ++i) {
+        m_meanSquare[i] += m_normalizationAlpha * (x[i] - m_meanSquare[i]);
+        x[i] = (m_meanSquare[i] > 0.0) ? x[i] / m_meanSquare[i] : 0.0;
+    }
+
+    // 3. 대역 제한 및 가중
+    for(auto& stage : m_chain) {
+        stage.process(x);
+    }
+
+    // 4. 제곱 + 평활
+    for(size_t i = 0; i < x.size(); ++i) {
+        m_pinst[i] += m_smoothingAlpha * (m_scale * x[i] * x[i] - m_pinst[i]);
+    }
+
+    // 5. 분류
+    if(++m_decimationCount >= m_decimation) {
+        m_decimationCount = 0;
+        for(size_t i = 0; i < m_classifiers.size(); ++i) {
+            m_classifiers[i].add(m_pinst[i]);
+        }
+    }
+
+    m_elapsedSec += m_samplePeriod;
+    if(m_elapsedSec >= config::Flicker::ShortTermPeriodSec) {
+        m_elapsedSec -= config::Flicker::ShortTermPeriodSec;
+        finishShortTerm();
+    }
+}
+
+void Flickermeter::finishShortTerm()
+{
+    const size_t longTermCount = config::Flicker::LongTermCount;
+    for(size_t i = 0; i < m_classifiers.size(); ++i) {
+        m_pst[i] = m_classifiers[i].pst();
+        m_classifiers[i].clear();
+
+        auto& history = m_pstHistory[i];
+        history.push_back(m_pst[i]);
+        if(history.size() > longTermCount) {
+            history.pop_front();
+        }
+        if(history.size() == longTermCount) {
+            double sumCubes = 0.0;
+            for(double pst : history) {
+                sumCubes += pst * pst * pst;
+            }
+            m_plt[i] = std::cbrt(sumCubes / longTermCount);
+        }
+    }
+}
@@ -0,0 +1,105 @@
+#ifndef FLICKERMETER_H
+#define FLICKERMETER_H
+
+#include <array>
+#include <complex>
+#include <deque>
+#include <vector>
+
+// FlickerClassifier 클래스
+// IEC 61000-4-15 블록 5의 누적 확률 함수(CPF)를 고정 크기 히스토그램으로 구현.
+// 샘플을 저장하지 않고 로그 간격 클래스의 개수만 세므로 관측 구간 길이와 무관하게 메모리 일정.
+// 백분위수는 해당 클래스 안에서 선형 보간.
+class FlickerClassifier
+{
+public:
+    FlickerClassifier();
+
+    void add(double pinst);
+    void clear();
+    size_t count() const { return m_total; }
+
+    // 관측 시간의 percent%를 초과하는 Pinst 레벨
+    double percentile(double percent) const;
+    // 평활 백분위수로 계산한 단기 플리커 심각도 (샘플이 없으면 NaN)
+    double pst() const;
+
+private:
+    size_t classIndex(double value) const;
+    double classLower(size_t index) const;
+    double classUpper(size_t index) const;
+
+    std::vector<size_t> m_counts;
+    size_t m_total = 0;
+    double m_inverseLogRatio; // 1 / log(클래스 간 비율)
+};
+
+// Flickermeter 클래스
+// IEC 61000-4-15 플리커미터를 샘플 단위 스트리밍 필터 체인으로 구현.
+//  1. 입력 정규화: 제곱 전압을 평균 제곱(시정수 60초)으로 나눔
+//  2~3. 제곱 복조 후 HPF(0.05Hz) + 6차 Butterworth LPF + 램프-눈 가중 필터 (쌍선형 변환 biquad)
+//  4. 제곱 + 1차 LPF(0.3초) → Pinst (8.8Hz, 0.25% 변조에서 1이 되도록 교정)
+//  5. 약 100Hz로 솎아 히스토그램 분류기에 넣고 10분마다 Pst, Pst 12개로 Plt
+// 세 상은 같은 계수를 공유하므로 각 단의 상태를 상별 배열로 두어 한 루프에서 함께 처리.
+class Flickermeter
+{
+public:
+    using Lanes = std::array<double, 3>;
+
+    Flickermeter();
+
+    // 샘플링 주파수와 계통 주파수 설정. 필터 계수만 다시 계산하고 상태는 유지
+    void configure(double sampleRateHz, double nominalFrequencyHz);
+    // 상별 공칭 RMS (다음 reset() 후 정규화 평균 제곱의 초기값)
+    void setNominalVoltages(const Lanes& rms);
+    // 필터/분류기/Pst 이력 초기화
+    void reset();
+
+    // 상별 순시 전압 한 샘플 입력
+    void process(const Lanes& voltage);
+
+    bool isEnabled() const { return m_enabled; }
+    const Lanes& pinst() const { return m_pinst; }
+    const Lanes& pst() const { return m_pst; }   // 첫 10분 전에는 NaN
+    const Lanes& plt() const { return m_plt; }   // Pst 12개가 모이기 전에는 NaN
+    const FlickerClassifier& classifier(int phase) const { return m_classifiers[phase]; }
+
+private:
+    // 전치 직접형 II biquad. 상태만 상별로 두고 계수는 공유
+    struct Biquad {
+        double b0 = 1.0, b1 = 0.0, b2 = 0.0, a1 = 0.0, a2 = 0.0;
+        Lanes z1{}, z2{};
+
+        // 아날로그 (n2 s² + n1 s + n0) / (d2 s² + d1 s + d0)를 쌍선형 변환
+        void design(const std::array<double, 3>& num, const std::array<double, 3>& den, double sampleRateHz);
+        void process(Lanes& x);
+        void prime(double dc); // 직류 입력 dc에 대한 정상 상태로 설정
+        std::complex<double> response(double normalizedOmega) const;
+    };
+
+    void finishShortTerm();
+
+    std::vector<Biquad> m_chain; // HPF, LPF 3단, 가중 필터 2단
+    double m_sampleRate = 0.0;
+    double m_nominalFrequency = 0.0;
+    double m_samplePeriod = 0.0;
+    bool m_enabled = false;
+    bool m_primed = false;
+
+    double m_normalizationAlpha = 0.0;
+    double m_smoothingAlpha = 0.0;
+    double m_scale = 0.0; // 기준 변조에서 Pinst = 1이 되는 배율
+    int m_decimation = 1;
+    int m_decimationCount = 0;
+    double m_elapsedSec = 0.0; // 현재 Pst 관측 구간 경과 시간
+
+    Lanes m_nominalRms{};
+    Lanes m_meanSquare{};
+    Lanes m_pinst{};
+    Lanes m_pst;
+    Lanes m_plt;
+    std::array<FlickerClassifier, 3> m_classifiers;
+    std::array<std::deque<double>, 3> m_pstHistory;
+};
+
+#endif // FLICKERMETER_H
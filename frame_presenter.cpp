@@ -0,0 +1,172 @@
+#include "frame_presenter.h"
+#include "config.h"
+#include <algorithm>
+
+FramePresenter::FramePresenter(QObject* parent)
+    : QObject{parent}
+    , m_frameTimer(new QChronoTimer(this))
+    , m_shared(std::make_shared<SharedState>())
+{
+    setFrameRate(config::Display::DefaultFrameRate);
+
+    m_frameTimer->setTimerType(Qt::PreciseTimer);
+    m_frameTimer->setSingleShot(true);
+    connect(m_frameTimer, &QChronoTimer::timeout, this, &FramePresenter::onFrameTimer);
+}
+
+void FramePresenter::setFrameRate(double hz)
+{
+    hz = std::clamp(hz, config::Display::MinFrameRate, config::Display::MaxFrameRate);
+    m_frameInterval = std::chrono::duration_cast<Clock::duration>(std::chrono::duration<double>(1.0 / hz));
+}
+
+double FramePresenter::frameRate() const
+{
+    return 1.0 / std::chrono::duration<double>(m_frameInterval).count();
+}
+
+void FramePresenter::setReceiverContext(QObject* context)
+{
+    m_receiverContext = context;
+}
+
+quint64 FramePresenter::droppedCount(Channel channel) const
+{
+    return m_shared->dropped[static_cast<size_t>(channel)].load(std::memory_order_relaxed);
+}
+
+quint64 FramePresenter::totalDroppedCount() const
+{
+    quint64 total = 0;
+    for(const auto& dropped : m_shared->dropped) {
+        total += dropped.load(std::memory_order_relaxed);
+    }
+    return total;
+}
+
+void FramePresenter::submitWaveform(const SampleHistory& data)
+{
+    m_waveform = &data;
+    markPending(Channel::Waveform);
+}
+
+void FramePresenter::submitMeasured(const std::deque<MeasuredData>& data)
+{
+    m_measured = &data;
+    markPending(Channel::Measured);
+}
+
+void FramePresenter::submitPhasor(const GenericPhaseData<HarmonicAnalysisResult>& fundamentalVoltage,
+                                  const GenericPhaseData<HarmonicAnalysisResult>& fundamentalCurrent,
+                                  const std::vector<HarmonicAnalysisResult>& voltageHarmonics,
+                                  const std::vector<HarmonicAnalysisResult>& currentHarmonics)
+{
+    // 페이저는 임시 객체로 넘어오므로 복사해 둠 (벡터 용량은 재사용)
+    m_phasor.fundamentalVoltage = fundamentalVoltage;
+    m_phasor.fundamentalCurrent = fundamentalCurrent;
+    m_phasor.voltageHarmonics.assign(voltageHarmonics.begin(), voltageHarmonics.end());
+    m_phasor.currentHarmonics.assign(currentHarmonics.begin(), currentHarmonics.end());
+    markPending(Channel::Phasor);
+}
+
+void FramePresenter::onFrameTimer()
+{
+    const auto now = Clock::now();
+    std::optional<Clock::duration> nextDelay;
+
+    for(size_t i = 0; i < m_channels.size(); ++i) {
+        if(const auto delay = tryDeliver(static_cast<Channel>(i), now)) {
+            nextDelay = nextDelay ? std::min(*nextDelay, *delay) : *delay;
+        }
+    }
+
+    if(nextDelay) {
+        scheduleTimer(*nextDelay);
+    }
+}
+
+void FramePresenter::markPending(Channel channel)
+{
+    auto& state = m_channels[static_cast<size_t>(channel)];
+
+    // 아직 전달되지 않은 스냅샷을 덮어씀
+    if(state.pending) {
+        m_shared->dropped[static_cast<size_t>(channel)].fetch_add(1, std::memory_order_relaxed);
+    }
+    state.pending = true;
+
+    // 마지막 전달 후 한 프레임이 지났으면 바로 전달 (leading edge), 아니면 다음 프레임에
+    if(const auto delay = tryDeliver(channel, Clock::now())) {
+        scheduleTimer(*delay);
+    }
+}
+
+std::optional<FramePresenter::Clock::duration> FramePresenter::tryDeliver(Channel channel, Clock::time_point now)
+{
+    const size_t index = static_cast<size_t>(channel);
+    auto& state = m_channels[index];
+    if(!state.pending) {
+        return std::nullopt;
+    }
+
+    // 뷰가 이전 프레임을 아직 처리하지 못함 -> 다음 프레임에 다시 확인
+    if(m_shared->inFlight[index].load(std::memory_order_acquire)) {
+        return m_frameInterval;
+    }
+
+    const auto elapsed = now - state.lastDelivery;
+    if(elapsed < m_frameInterval) {
+        return m_frameInterval - elapsed;
+    }
+
+    state.pending = false;
+    state.lastDelivery = now;
+    deliver(channel);
+    return std::nullopt;
+}
+
+void FramePresenter::deliver(Channel channel)
+{
+    const size_t index = static_cast<size_t>(channel);
+    if(m_receiverContext) {
+        m_shared->inFlight[index].store(true, std::memory_order_release);
+    }
+
+    switch(channel) {
+    case Channel::Waveform:
+        if(m_waveform) emit waveformReady(std::make_shared<const SampleHistory>(*m_waveform));
+        break;
+    case Channel::Measured:
+        if(m_measured) emit measuredReady(std::make_shared<const std::deque<MeasuredData>>(*m_measured));
+        break;
+    case Channel::Phasor:
+        emit phasorReady(m_phasor.fundamentalVoltage, m_phasor.fundamentalCurrent,
+                         m_phasor.voltageHarmonics, m_phasor.currentHarmonics);
+        break;
+    case Channel::Count:
+        break;
+    }
+
+    if(m_receiverContext) {
+        // 같은 스레드에 먼저 쌓인 *Ready 이벤트가 모두 처리된 뒤 실행되어 전달 완료를 알림
+        QMetaObject::invokeMethod(m_receiverContext, [shared = m_shared, index]() {
+            shared->inFlight[index].store(false, std::memory_order_release);
+        }, Qt::QueuedConnection);
+    }
+
+    const quint64 total = totalDroppedCount();
+    if(total != m_lastReportedDropped) {
+        m_lastReportedDropped = total;
+        emit droppedCountChanged(total);
+    }
+}
+
+void FramePresenter::scheduleTimer(Clock::duration delay)
+{
+    // 이미 예약된 타이머가 있으면 그 시점에 모든 채널을 다시 확인함
+    if(m_frameTimer->isActive()) {
+        return;
+    }
+    m_frameTimer->setInterval(std::max<std::chrono::nanoseconds>(delay, std::chrono::milliseconds(1)));
+    m_frameTimer->start();
+}
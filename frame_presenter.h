@@ -0,0 +1,114 @@
+#ifndef FRAME_PRESENTER_H
+#define FRAME_PRESENTER_H
+
+#include <QObject>
+#include <QChronoTimer>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <deque>
+#include <memory>
+#include <optional>
+#include <vector>
+#include "sample_history.h"
+#include "measured_data.h"
+#include "shared_data_types.h"
+
+// FramePresenter 클래스
+// 엔진과 뷰 사이에서 화면 갱신을 프레임 단위로 합침.
+// 엔진 스레드에서 submit*을 직접(DirectConnection) 호출하면 최신 스냅샷만 남기고,
+// 채널(뷰)마다 한 프레임에 최대 한 번만 *Ready 시그널을 내보냄.
+// 수신 컨텍스트를 지정하면 뷰가 이전 프레임을 처리하기 전까지 다음 프레임을 보내지 않음 (백프레셔).
+// 전달되지 못하고 덮어쓰인 스냅샷 수는 droppedCount로 확인.
+// 원시 파형은 전달할 때만 SampleHistorySnapshot(블록 공유 복사)으로 고정해 보내므로 큐 연결에서 샘플을 복사하지 않음.
+// 측정 데이터도 전달할 때 MeasuredDataSnapshot으로 한 번만 복사해 모든 수신 뷰가 공유함.
+class FramePresenter : public QObject
+{
+    Q_OBJECT
+public:
+    enum class Channel {
+        Waveform,   // 원시 파형 (GraphWindow)
+        Measured,   // 측정 데이터 (분석 그래프들)
+        Phasor,     // 페이저 (PhasorView)
+        Count
+    };
+
+    explicit FramePresenter(QObject* parent = nullptr);
+
+    // 최대 프레임 속도 (Hz). config::Display 범위로 제한됨
+    void setFrameRate(double hz);
+    double frameRate() const;
+
+    // 뷰가 사는 스레드의 객체. 지정하면 프레임 처리 완료를 확인한 뒤 다음 프레임을 보냄
+    // (스레드로 옮기기 전에 설정)
+    void setReceiverContext(QObject* context);
+
+    // 덮어쓰여 버려진 스냅샷 수 (어느 스레드에서든 호출 가능)
+    quint64 droppedCount(Channel channel) const;
+    quint64 totalDroppedCount() const;
+
+public slots:
+    // 파형/측정 데이터는 참조만 보관하므로 presenter와 같은 스레드의 컨테이너를 넘겨야 함
+    void submitWaveform(const SampleHistory& data);
+    void submitMeasured(const std::deque<MeasuredData>& data);
+    void submitPhasor(const GenericPhaseData<HarmonicAnalysisResult>& fundamentalVoltage,
+                      const GenericPhaseData<HarmonicAnalysisResult>& fundamentalCurrent,
+                      const std::vector<HarmonicAnalysisResult>& voltageHarmonics,
+                      const std::vector<HarmonicAnalysisResult>& currentHarmonics);
+
+signals:
+    void waveformReady(const SampleHistorySnapshot& data);
+    void measuredReady(const MeasuredDataSnapshot& data);
+    void phasorReady(const GenericPhaseData<HarmonicAnalysisResult>& fundamentalVoltage,
+                     const GenericPhaseData<HarmonicAnalysisResult>& fundamentalCurrent,
+                     const std::vector<HarmonicAnalysisResult>& voltageHarmonics,
+                     const std::vector<HarmonicAnalysisResult>& currentHarmonics);
+
+    // 버려진 스냅샷 누적 수가 바뀌었을 때 (프레임 전달 시점에만 발생)
+    void droppedCountChanged(quint64 total);
+
+private slots:
+    void onFrameTimer();
+
+private:
+    using Clock = std::chrono::steady_clock;
+
+    // 수신 스레드와 공유하는 상태. 수신 측 확인 람다가 presenter보다 오래 살 수 있으므로 shared_ptr로 보관
+    struct SharedState {
+        std::array<std::atomic<bool>, static_cast<size_t>(Channel::Count)> inFlight{};
+        std::array<std::atomic<quint64>, static_cast<size_t>(Channel::Count)> dropped{};
+    };
+
+    struct ChannelState {
+        bool pending = false;
+        Clock::time_point lastDelivery{};
+    };
+
+    struct PhasorFrame {
+        GenericPhaseData<HarmonicAnalysisResult> fundamentalVoltage;
+        GenericPhaseData<HarmonicAnalysisResult> fundamentalCurrent;
+        std::vector<HarmonicAnalysisResult> voltageHarmonics;
+        std::vector<HarmonicAnalysisResult> currentHarmonics;
+    };
+
+    void markPending(Channel channel);
+    // 전달 가능하면 즉시 전달. 아직 대기 중이면 다시 확인할 때까지 남은 시간 반환
+    std::optional<Clock::duration> tryDeliver(Channel channel, Clock::time_point now);
+    void deliver(Channel channel);
+    void scheduleTimer(Clock::duration delay);
+
+    Clock::duration m_frameInterval;
+    QObject* m_receiverContext = nullptr;
+    QChronoTimer* m_frameTimer;
+
+    std::array<ChannelState, static_cast<size_t>(Channel::Count)> m_channels;
+    std::shared_ptr<SharedState> m_shared;
+    quint64 m_lastReportedDropped = 0;
+
+    // 최신 스냅샷
+    const SampleHistory* m_waveform = nullptr;
+    const std::deque<MeasuredData>* m_measured = nullptr;
+    PhasorFrame m_phasor;
+};
+
+#endif // FRAME_PRESENTER_H
@@ -43,8 +43,10 @@ FrequencyTracker::FrequencyTracker(SimulationEngine* engine, QObject *parent)
     : QObject{parent}
     , m_engine(engine)
     , m_trackingState(TrackingState::Idle)
+    , m_trackingMethod(TrackingMethod::CycleFft)
     , m_coarseSearchSamplesNeeded(0)
     , m_isVerifying(false)
+    , m_restartCount(0)
     , m_fll_failCounter(0)
     , m_fll_lockCounter(0)
     , m_fll_previousLfOutput(0.0)
@@ -52,6 +54,8 @@ FrequencyTracker::FrequencyTracker(SimulationEngine* engine, QObject *parent)
     , m_pll_previousVoltagePhase(0.0)
     , m_pll_failCounter(0)
     , m_pll_cycleCounter(0)
+    , m_lastSampleTimestamp(-1)
+    , m_streamingSampleCounter(0)
 {
     // FLL 컨트롤러 설정
     m_fllController.setCoefficients({ .Kp = FllConstants::Kp, .Ki = FllConstants::Ki, .Kd = FllConstants::Kd});
@@ -69,7 +73,12 @@ void FrequencyTracker::startTracking()
 {
     qDebug() << "-- 추적 시작 --";
     resetAllStates();
-    startCoarseSearch();
+    if(m_trackingMethod == TrackingMethod::StreamingSogi) {
+        startStreaming();
+    } else {
+        startCoarseSearch();
+    }
+    m_restartCount = 0;
 }
 
 void FrequencyTracker::stopTracking()
@@ -83,6 +92,39 @@ FrequencyTracker::TrackingState FrequencyTracker::currentState() const
     return m_trackingState;
 }
 
+int FrequencyTracker::restartCount() const
+{
+    return m_restartCount;
+}
+
+void FrequencyTracker::setTrackingMethod(TrackingMethod method)
+{
+    if(m_trackingMethod == method) {
+        return;
+    }
+    m_trackingMethod = method;
+
+    // 추적 중이었다면 새 방식으로 다시 시작
+    if(m_trackingState != TrackingState::Idle) {
+        startTracking();
+    }
+}
+
+FrequencyTracker::TrackingMethod FrequencyTracker::trackingMethod() const
+{
+    return m_trackingMethod;
+}
+
+double FrequencyTracker::trackedFrequency() const
+{
+    return m_trackingState == TrackingState::Streaming ? m_sogi.frequency() : 0.0;
+}
+
+double FrequencyTracker::rocof() const
+{
+    return m_trackingState == TrackingState::Streaming ? m_sogi.rocof() : 0.0;
+}
+
 void FrequencyTracker::process(const DataPoint& latestDataPoint, const MeasuredData& latestMeasuredData, const std::vector<DataPoint>& cycleBuffer)
 {
     // 백그라운드 검증 데이터 수집
@@ -107,6 +149,9 @@ void FrequencyTracker::process(const DataPoint& latestDataPoint, const MeasuredD
             processFineTune(latestMeasuredData);
         }
         break;
+    case TrackingState::Streaming:
+        processStreaming(latestDataPoint);
+        break;
     case TrackingState::Idle:
         break;
     }
@@ -330,11 +375,37 @@ void FrequencyTracker::processVerification(const DataPoint& latestDataPoint)
     m_isVerifying = false;
     m_pll_cycleCounter = 0;
 }
+
+void FrequencyTracker::processStreaming(const DataPoint& latestDataPoint)
+{
+    // 1. 샘플 간격은 타임스탬프에서 계산 (추적 중 샘플링 주파수가 바뀌어도 그대로 동작)
+    if(m_lastSampleTimestamp.count() >= 0) {
+        const double dtSeconds = std::chrono::duration_cast<utils::FpSeconds>(latestDataPoint.timestamp - m_lastSampleTimestamp).count();
+        m_sogi.process(latestDataPoint.voltage.a, dtSeconds);
+    }
+    m_lastSampleTimestamp = latestDataPoint.timestamp;
+
+    // 2. 한 사이클마다 추정 주파수를 샘플링 주파수에 반영
+    if(++m_streamingSampleCounter < m_engine->m_samplesPerCycle.value()) {
+        return;
+    }
+    m_streamingSampleCounter = 0;
+
+    if(!m_sogi.isLocked()) {
+        return;
+    }
+
+    double newSamplingCycles = std::clamp(m_sogi.frequency(), static_cast<double>(config::Sampling::MinValue), static_cast<double>(config::Sampling::maxValue));
+    if(std::abs(m_engine->m_samplingCycles.value() - newSamplingCycles) > 1e-9) {
+        emit samplingCyclesUpdated(newSamplingCycles);
+    }
+}
 // -------------------
 
 // --- 헬퍼 함수 --------
 void FrequencyTracker::startCoarseSearch()
 {
+    ++m_restartCount; // startTracking에서 0으로 되돌림
     resetAllStates(); // 모든 상태를 초기화하고 시작
     m_coarseSearchBuffer.clear();
     m_trackingState = TrackingState::Coarse;
@@ -355,6 +426,16 @@ void FrequencyTracker::startCoarseSearch()
     m_coarseSearchBuffer.reserve(m_coarseSearchSamplesNeeded);
 }
 
+void FrequencyTracker::startStreaming()
+{
+    resetAllStates();
+    m_trackingState = TrackingState::Streaming;
+
+    // 현재 샘플링 주파수(= 마지막으로 맞춘 신호 주파수)에서 추적 시작
+    m_sogi.reset(m_engine->m_samplingCycles.value());
+    qDebug() << " --- SOGI-FLL 추적 시작 ---";
+}
+
 void FrequencyTracker::resetAllStates()
 {
     m_trackingState = TrackingState::Idle;
@@ -372,6 +453,9 @@ void FrequencyTracker::resetAllStates()
     m_pll_failCounter = 0;
     m_pll_cycleCounter = 0;
 
+    m_lastSampleTimestamp = std::chrono::nanoseconds(-1);
+    m_streamingSampleCounter = 0;
+
     m_fllController.reset();
     m_zcController.reset();
 }
@@ -6,6 +6,7 @@
 #include "data_point.h"
 #include "measured_data.h"
 #include "pid_controller.h"
+#include "sogi_fll.h"
 
 // SimulationEngine 전방선언
 struct SimulationEngine;
@@ -20,6 +21,13 @@ public:
         Coarse, // 대략적인 주파수 탐색 (Zero-Crossing)
         FLL_Acquisition, // FLL 상태
         FineTune,    // 정밀한 주파수 추적 (PPL)
+        Streaming,   // 샘플 단위 SOGI-FLL 추적
+    };
+
+    // 추적 방식
+    enum class TrackingMethod {
+        CycleFft,       // 거친 탐색(FFT + ZC) 후 사이클 단위 FFT 위상으로 FLL/PLL
+        StreamingSogi,  // 샘플마다 SOGI-FLL 갱신 (버퍼 없음, 빠른 주파수 변화 대응)
     };
 
     using PidCoefficients = PIDController::Coefficients;
@@ -31,6 +39,17 @@ public:
     void stopTracking();
     TrackingState currentState() const;
 
+    // startTracking 이후 실패로 거친 탐색부터 다시 시작한 횟수
+    int restartCount() const;
+
+    // 추적 방식 변경. 추적 중이면 새 방식으로 다시 시작
+    void setTrackingMethod(TrackingMethod method);
+    TrackingMethod trackingMethod() const;
+
+    // 샘플 단위 추정 주파수(Hz)와 ROCOF(Hz/s). StreamingSogi 추적 중이 아니면 0
+    double trackedFrequency() const;
+    double rocof() const;
+
     // PID 계수를 외부에서 설정하고 가져오는 함수들
     void setFllCoefficients(const PidCoefficients& coeffs);
     void setZcCoefficients(const PidCoefficients& coeffs);
@@ -63,9 +82,11 @@ private:
     void processFll(const MeasuredData& latestMeasuredData);
     void processFineTune(const MeasuredData& latestMeasuredData); // PLL 로직 처리 함수
     void processVerification(const DataPoint& latestDataPoint); // 검증 처리 함수
+    void processStreaming(const DataPoint& latestDataPoint); // SOGI-FLL 샘플 처리
 
     // --- 헬퍼 함수 ---
     void startCoarseSearch(); // 거친 탐색을 시작하는 헬퍼 함수
+    void startStreaming();
     void resetAllStates();
     double estimateFrequencyByZeroCrossing(const std::vector<double>& wave); // zero-crossing 주파수 계산 함수
     void checkFllLock(double frequencyError);
@@ -74,11 +95,13 @@ private:
     // --- 멤버 변수 ---
     SimulationEngine* m_engine; // 엔진에 대한 포인터 (소유권 없음)
     TrackingState m_trackingState;
+    TrackingMethod m_trackingMethod;
 
     // CoarseSearch 관련 변수
     std::vector<DataPoint> m_coarseSearchBuffer; // 데이터 수집용 버퍼
     int m_coarseSearchSamplesNeeded; // 필요한 샘플 개수
     bool m_isVerifying;
+    int m_restartCount;
 
     // PID 계수
     PIDController m_fllController;
@@ -94,6 +117,10 @@ private:
     int m_pll_failCounter;
     int m_pll_cycleCounter;
 
+    // Streaming 관련 변수
+    SogiFll m_sogi;
+    std::chrono::nanoseconds m_lastSampleTimestamp;
+    int m_streamingSampleCounter; // 샘플링 주파수 갱신 주기(1사이클) 카운터
 };
 
 #endif // FREQUENCY_TRACKER_H
@@ -86,8 +86,10 @@ void FundamentalAnalysisGraphWindow::setupSeries()
     m_activePowerSeries->attachAxis(m_axisY_power);
 }
 
-void FundamentalAnalysisGraphWindow::updateGraph(const std::deque<MeasuredData>& data)
+void FundamentalAnalysisGraphWindow::updateGraph(const MeasuredDataSnapshot& snapshot)
 {
+    if(!snapshot) return;
+    const std::deque<MeasuredData>& data = *snapshot;
     if(data.empty()) {
         m_voltageRmsSeries->clear();
         m_currentRmsSeries->clear();
@@ -113,21 +115,18 @@ void FundamentalAnalysisGraphWindow::updateVisiblePoints(const std::deque<Measur
     auto [first, last] = getVisibleRangeIterators(data, minX_ns, maxX_ns);
 
     // LTTB 다운샘플링을 위한 데이터 추출기 정의
-    std::vector<std::function<double(const MeasuredData&)>> extractors {
-        [](const MeasuredData& d) {
-            const auto& v = d.fundamentalVoltage.a;
-            return (v.order > 0) ? v.rms : 0.0;
-        },
-        [](const MeasuredData& d) {
-            const auto& i = d.fundamentalCurrent.a;
-            return (i.order > 0) ? i.rms : 0.0;
-        },
-        [](const MeasuredData& d) {
-            const auto& v = d.fundamentalVoltage.a;
-            const auto& i = d.fundamentalCurrent.a;
-            return AnalysisUtils::calculateActivePower(&v, &i);
-        }
-
+    const auto voltageExtractor = [](const MeasuredData& d) {
+        const auto& v = d.fundamentalVoltage.a;
+        return (v.order > 0) ? v.rms : 0.0;
+    };
+    const auto currentExtractor = [](const MeasuredData& d) {
+        const auto& i = d.fundamentalCurrent.a;
+        return (i.order > 0) ? i.rms : 0.0;
+    };
+    const auto powerExtractor = [](const MeasuredData& d) {
+        const auto& v = d.fundamentalVoltage.a;
+        const auto& i = d.fundamentalCurrent.a;
+        return AnalysisUtils::calculateActivePower(&v, &i);
     };
 
     const int pointCount = std::distance(first, last);
@@ -138,7 +137,8 @@ void FundamentalAnalysisGraphWindow::updateVisiblePoints(const std::deque<Measur
     m_powerPoints.clear();
 
     if(pointCount > threshold && threshold > 0) {
-        auto sample_data = downsampleLTTB(first, last, threshold, extractors);
+        auto sample_data = downsampleLTTB(first, last, threshold, LttbDownsampler::AllSeries,
+                                          voltageExtractor, currentExtractor, powerExtractor);
         for(const auto& d : sample_data) {
             const double timeSec = FpSeconds(d.timestamp).count();
             const auto& v_fund = d.fundamentalVoltage.a;
@@ -17,7 +17,7 @@ signals:
     void redrawNeeded(); // 재요청
 
 public slots:
-    void updateGraph(const std::deque<MeasuredData>& data);
+    void updateGraph(const MeasuredDataSnapshot& snapshot);
 
 private:
     void setupSeries() override;
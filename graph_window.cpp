@@ -131,15 +131,20 @@ void GraphWindow::stretchGraph(double factor)
     emit graphWidthChanged(newWidth);
 }
 
-void GraphWindow::updateGraph(const std::deque<DataPoint> &data)
+void GraphWindow::updateGraph(const SampleHistorySnapshot& snapshot)
 {
+    if(!snapshot) return;
+    const SampleHistory& data = *snapshot;
     if (data.empty()) {
         for(const auto& info : m_seriesInfoList) {
             info.series->clear();
         }
+        m_pyramid.clear();
+        m_pyramidLastTimestamp = Nanoseconds{-1};
         return;
     }
 
+    syncPyramid(data); // 새로 들어온 샘플만 피라미드에 반영
     updateVisiblePoints(data); // 현재 화면에 보일 데이터 포인터들만 필터링하여 멤버 변수에 저장
     updateSeriesData(); // 필터링된 데이터를 사용하여 그래프 시리즈의 내용을 교체
     updateAxes(data); // 자동 스크롤 모드일 경우, 축의 범위를 최신 데이터에 맞게 업데이트
@@ -212,7 +217,30 @@ void GraphWindow::onWaveformVisibilityChanged(int type, bool isVisible)
 // -----------------------
 
 // ---- private -----
-void GraphWindow::updateVisiblePoints(const std::deque<DataPoint>& data)
+void GraphWindow::syncPyramid(const SampleHistory& data)
+{
+    // 이전에 반영한 마지막 샘플이 현재 이력에 없으면 (리셋 또는 전부 교체) 처음부터 다시 구성
+    const bool isContinuous = m_pyramid.endIndex() > 0
+                              && data.timestamp(0) <= m_pyramidLastTimestamp
+                              && data.timestamp(data.size() - 1) >= m_pyramidLastTimestamp;
+
+    auto newBegin = data.begin();
+    if(isContinuous) {
+        newBegin = data.upperBound(m_pyramidLastTimestamp);
+    } else {
+        m_pyramid.clear();
+    }
+
+    for(auto it = newBegin; it != data.end(); ++it) {
+        m_pyramid.append(*it);
+    }
+    m_pyramidLastTimestamp = data.timestamp(data.size() - 1);
+
+    // 이력 앞쪽에서 버려진 샘플 반영
+    m_pyramid.trimFront(m_pyramid.endIndex() - data.size());
+}
+
+void GraphWindow::updateVisiblePoints(const SampleHistory& data)
 {
     // 축에서 초단위 시간 범위를 가져옴
     auto [minX_sec, maxX_sec] = getVisibleXRange(data);
@@ -227,27 +255,26 @@ void GraphWindow::updateVisiblePoints(const std::deque<DataPoint>& data)
     const int pointCount = std::distance(first, last);
     const int threshold = m_chartView->width(); // 픽셀 너비만큼 점을 뽑음
 
-    if(pointCount > threshold) {
-        std::vector<std::function<double(const DataPoint&)>> extractors;
-        extractors.reserve(m_seriesInfoList.size());
-        \
-            for(const auto& info : m_seriesInfoList) {
-            if(info.isVisible) {
-                // QVariant를 받는 info.extractor를 DataPoint를 받는 람다로 감싸서 추가
-                extractors.push_back([&info](const DataPoint& p) {
-                    return info.extractor(QVariant::fromValue(p));
-                });
-            }
-        }
-
-        // 보이는 시리즈가 없으면 다운샘플링 없이 그냥 복사
-        if(extractors.empty()) {
-            m_visibleDataPoints.assign(first, last);
-        } else {
-            m_visibleDataPoints = downsampleLTTB(first, last, threshold, extractors);
-        }
-    } else {
+    m_isEnvelopeActive = pointCount > threshold && threshold > 2;
+    if(!m_isEnvelopeActive) {
         m_visibleDataPoints.assign(first, last);
+        return;
+    }
+
+    // 버킷 하나당 min/max 두 점을 그리므로 픽셀 너비의 절반만큼 버킷을 읽음 -> O(pixels)
+    // 피라미드의 가장 세밀한 레벨보다 확대된 구간은 원본 샘플에서 직접 요약
+    const uint64_t baseIndex = m_pyramid.endIndex() - data.size();
+    const uint64_t firstIndex = baseIndex + std::distance(data.begin(), first);
+    const uint64_t lastIndex = baseIndex + std::distance(data.begin(), last);
+    m_pyramid.envelope(firstIndex, lastIndex, threshold / 2, m_envelope, [&](uint64_t index) {
+        return data[index - baseIndex];
+    });
+
+    // 호버 검색용: 각 버킷의 첫 원본 샘플
+    m_visibleDataPoints.clear();
+    m_visibleDataPoints.reserve(m_envelope.size());
+    for(const auto& bucket : m_envelope) {
+        m_visibleDataPoints.push_back(data[bucket.firstIndex - baseIndex]);
     }
 }
 
@@ -255,14 +282,26 @@ void GraphWindow::updateSeriesData()
 {
     for(auto& info : m_seriesInfoList) {
         info.points.clear();
-        info.points.reserve(m_visibleDataPoints.size());
+        info.points.reserve(m_isEnvelopeActive ? m_envelope.size() * 2 : m_visibleDataPoints.size());
     }
 
-    // 멤버 변수들을 채움
-    for(const auto& p : std::as_const(m_visibleDataPoints)) {
-        const double timeSec = FpSeconds(p.timestamp).count();
-        for(auto& info : m_seriesInfoList) {
-            info.points.emplace_back(timeSec, info.extractor(QVariant::fromValue(p)));
+    if(m_isEnvelopeActive) {
+        // 엔벨로프: 버킷마다 (시작 시각, min) -> (시작 시각, max) 세로선
+        for(size_t i = 0; i < m_envelope.size(); ++i) {
+            const double timeSec = FpSeconds(m_visibleDataPoints[i].timestamp).count();
+            for(size_t s = 0; s < m_seriesInfoList.size(); ++s) {
+                const size_t ch = SeriesChannels[s];
+                m_seriesInfoList[s].points.emplace_back(timeSec, m_envelope[i].min[ch]);
+                m_seriesInfoList[s].points.emplace_back(timeSec, m_envelope[i].max[ch]);
+            }
+        }
+    } else {
+        // 멤버 변수들을 채움
+        for(const auto& p : std::as_const(m_visibleDataPoints)) {
+            const double timeSec = FpSeconds(p.timestamp).count();
+            for(auto& info : m_seriesInfoList) {
+                info.points.emplace_back(timeSec, info.extractor(QVariant::fromValue(p)));
+            }
         }
     }
 
@@ -272,7 +311,7 @@ void GraphWindow::updateSeriesData()
     }
 }
 
-void GraphWindow::updateAxes(const std::deque<DataPoint> &data)
+void GraphWindow::updateAxes(const SampleHistory& data)
 {
     if(m_isAutoScrollEnabled) {
         if(m_visibleDataPoints.empty()) return;
@@ -282,9 +321,19 @@ void GraphWindow::updateAxes(const std::deque<DataPoint> &data)
         double maxY = std::numeric_limits<double>::lowest();
 
         // m_seriesInfoList 순회
-        for(const auto& info : m_seriesInfoList) {
+        for(size_t s = 0; s < m_seriesInfoList.size(); ++s) {
+            const auto& info = m_seriesInfoList[s];
             // 현재 화면에 보이는 시리즈에 대해서만 min/max 계산
-            if(info.isVisible) {
+            if(!info.isVisible) continue;
+
+            if(m_isEnvelopeActive) {
+                // 엔벨로프 모드: 피라미드 버킷의 min/max 사용 (O(pixels))
+                const size_t ch = SeriesChannels[s];
+                for(const auto& bucket : m_envelope) {
+                    minY = std::min(minY, bucket.min[ch]);
+                    maxY = std::max(maxY, bucket.max[ch]);
+                }
+            } else {
                 // 해당 시리즈의 데이터를 순회
                 for(const auto& point : info.points) {
                     minY = std::min(minY, point.y());
@@ -1,9 +1,9 @@
 #ifndef GRAPH_WINDOW_H
 #define GRAPH_WINDOW_H
 
-#include <deque>
-#include "data_point.h"
+#include "sample_history.h"
 #include "base_graph_window.h"
+#include "min_max_pyramid.h"
 
 class QLineSeries;
 class QValueAxis;
@@ -24,7 +24,7 @@ signals:
     void framePainted();
 
 public slots:
-    void updateGraph(const std::deque<DataPoint>& data);
+    void updateGraph(const SampleHistorySnapshot& snapshot);
     void stretchGraph(double factor);
     void findNearestPoint(const QPointF& chartPos);
     void onWaveformVisibilityChanged(int type, bool isVisible);
@@ -37,13 +37,23 @@ private:
     void updateYAxisRange(double minY, double maxY);
 
     // 데이터 처리 관련 함수들
-    void updateVisiblePoints(const std::deque<DataPoint>& data);
+    void syncPyramid(const SampleHistory& data);
+    void updateVisiblePoints(const SampleHistory& data);
     void updateSeriesData();
-    void updateAxes(const std::deque<DataPoint>& data);
+    void updateAxes(const SampleHistory& data);
 
     // 차트 관련 객체 소유
     QValueAxis *m_axisY;
     std::vector<DataPoint> m_visibleDataPoints;
+
+    // 줌 아웃 시 엔벨로프 렌더링용 min/max 피라미드 (샘플 이력과 동기화)
+    MinMaxPyramid m_pyramid;
+    Nanoseconds m_pyramidLastTimestamp{-1};
+    std::vector<MinMaxPyramid::EnvelopeBucket> m_envelope;
+    bool m_isEnvelopeActive = false;
+
+    // m_seriesInfoList 순서(Va, Ia, Vb, Ib, Vc, Ic) -> 피라미드 채널(Va, Vb, Vc, Ia, Ib, Ic)
+    static constexpr std::array<size_t, 6> SeriesChannels = {0, 3, 1, 4, 2, 5};
 };
 
 #endif // GRAPH_WINDOW_H
@@ -87,8 +87,10 @@ void HarmonicAnalysisGraphWindow::setupSeries()
 
 }
 
-void HarmonicAnalysisGraphWindow::updateGraph(const std::deque<MeasuredData>& data)
+void HarmonicAnalysisGraphWindow::updateGraph(const MeasuredDataSnapshot& snapshot)
 {
+    if(!snapshot) return;
+    const std::deque<MeasuredData>& data = *snapshot;
     if(data.empty()) {
         m_voltageRmsSeries->clear();
         m_currentRmsSeries->clear();
@@ -115,20 +117,21 @@ void HarmonicAnalysisGraphWindow::updateVisiblePoints(const std::deque<MeasuredD
 
 
     // LTTB 다운샘플링을 위한 데이터 추출기 정의
-    std::vector<std::function<double(const MeasuredData&)>> extractors {
-        [](const MeasuredData& d) {
-            const auto* v = AnalysisUtils::getDominantHarmonic(d.voltageHarmonics.a);
-            return v ? v->rms : 0.0;
-        },
-        [](const MeasuredData& d) {
-            const auto* i = AnalysisUtils::getDominantHarmonic(d.currentHarmonics.a);
-            return i ? i->rms : 0.0;
-        },
-        [](const MeasuredData& d) {
-            const auto* v = AnalysisUtils::getDominantHarmonic(d.voltageHarmonics.a);
-            const auto* i = AnalysisUtils::getDominantHarmonic(d.currentHarmonics.a);
-            return AnalysisUtils::calculateActivePower(v, i);
-        }
+    const auto voltageExtractor = [](const MeasuredData& d) {
+        const auto* v = AnalysisUtils::getDominantHarmonic(d.voltageHarmonics.a);
+        return v ? v->rms : 0.0;
+    };
+    const auto currentExtractor = [](const MeasuredData& d) {
+        const auto* i = AnalysisUtils::getDominantHarmonic(d.currentHarmonics.a);
+        return i ? i->rms : 0.0;
+    };
+    // 지배 전압 고조파 차수의 A상 유효 전력 (사이클마다 계산된 차수별 배열에서)
+    const auto dominantPower = [](const MeasuredData& d, const HarmonicAnalysisResult* v) {
+        const auto& power = d.harmonicOrders.activePower.a;
+        return (v && static_cast<size_t>(v->order) < power.size()) ? power[v->order] : 0.0;
+    };
+    const auto powerExtractor = [&](const MeasuredData& d) {
+        return dominantPower(d, AnalysisUtils::getDominantHarmonic(d.voltageHarmonics.a));
     };
 
     const int pointCount = std::distance(first, last);
@@ -139,7 +142,8 @@ void HarmonicAnalysisGraphWindow::updateVisiblePoints(const std::deque<MeasuredD
     m_powerPoints.clear();
 
     if(pointCount > threshold && threshold > 0) {
-        auto sample_data = downsampleLTTB(first, last, threshold, extractors);
+        auto sample_data = downsampleLTTB(first, last, threshold, LttbDownsampler::AllSeries,
+                                          voltageExtractor, currentExtractor, powerExtractor);
         for(const auto& d : sample_data) {
             const double timeSec = FpSeconds(d.timestamp).count();
             const auto* v_harm = AnalysisUtils::getDominantHarmonic(d.voltageHarmonics.a);
@@ -147,7 +151,7 @@ void HarmonicAnalysisGraphWindow::updateVisiblePoints(const std::deque<MeasuredD
 
             m_voltagePoints.append(QPointF(timeSec, v_harm ? v_harm->rms : 0.0));
             m_currentPoints.append(QPointF(timeSec, i_harm ? i_harm->rms : 0.0));
-            m_powerPoints.append(QPointF(timeSec, AnalysisUtils::calculateActivePower(v_harm, i_harm)));
+            m_powerPoints.append(QPointF(timeSec, dominantPower(d, v_harm)));
         }
     } else {
         // 다운샘플링 안할 때도 동일한 로직으로 데이터 추출
@@ -158,7 +162,7 @@ void HarmonicAnalysisGraphWindow::updateVisiblePoints(const std::deque<MeasuredD
 
             m_voltagePoints.append(QPointF(timeSec, v_harm ? v_harm->rms : 0.0));
             m_currentPoints.append(QPointF(timeSec, i_harm ? i_harm->rms : 0.0));
-            m_powerPoints.append(QPointF(timeSec, AnalysisUtils::calculateActivePower(v_harm, i_harm)));
+            m_powerPoints.append(QPointF(timeSec, dominantPower(*it, v_harm)));
         }
     }
 }
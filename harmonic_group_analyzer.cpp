@@ -0,0 +1,149 @@
+#include "harmonic_group_analyzer.h"
+#include <algorithm>
+#include <cmath>
+#include <QDebug>
+
+HarmonicGroupAnalyzer::HarmonicGroupAnalyzer(QObject* parent)
+    : QObject{parent}
+    , m_samplesPerCycle(0)
+    , m_cyclesPerWindow(0)
+    , m_cyclesCollected(0)
+    , m_windowSize(0)
+    , m_lastTimestamp(0)
+{
+    qRegisterMetaType<HarmonicGroupResult>();
+}
+
+void HarmonicGroupAnalyzer::processCycle(const std::vector<DataPoint>& cycleSamples, int cyclesPerWindow)
+{
+    if(cycleSamples.empty() || cyclesPerWindow <= 0) return;
+
+    const int samplesPerCycle = static_cast<int>(cycleSamples.size());
+
+    // 윈도우 시작 시점에만 크기 결정. 중간에 사이클 길이가 바뀌면 윈도우를 새로 시작
+    if(m_cyclesCollected == 0) {
+        prepareWindow(samplesPerCycle, cyclesPerWindow);
+    } else if(samplesPerCycle != m_samplesPerCycle) {
+        prepareWindow(samplesPerCycle, m_cyclesPerWindow);
+    }
+
+    const size_t offset = static_cast<size_t>(m_cyclesCollected) * m_samplesPerCycle;
+    for(size_t n = 0; n < cycleSamples.size(); ++n) {
+        const auto& p = cycleSamples[n];
+        m_samples[HarmonicGroupResult::VoltageA][offset + n] = p.voltage.a;
+        m_samples[HarmonicGroupResult::VoltageB][offset + n] = p.voltage.b;
+        m_samples[HarmonicGroupResult::VoltageC][offset + n] = p.voltage.c;
+        m_samples[HarmonicGroupResult::CurrentA][offset + n] = p.current.a;
+        m_samples[HarmonicGroupResult::CurrentB][offset + n] = p.current.b;
+        m_samples[HarmonicGroupResult::CurrentC][offset + n] = p.current.c;
+    }
+    m_lastTimestamp = cycleSamples.back().timestamp;
+
+    if(++m_cyclesCollected < m_cyclesPerWindow) return;
+
+    // 윈도우 완성: 채널당 FFT 1회
+    m_cyclesCollected = 0;
+    if(analyzeWindow()) {
+        emit harmonicGroupsUpdated(m_result);
+    }
+}
+
+void HarmonicGroupAnalyzer::reset()
+{
+    m_cyclesCollected = 0;
+}
+
+const HarmonicGroupResult& HarmonicGroupAnalyzer::lastResult() const { return m_result; }
+
+void HarmonicGroupAnalyzer::prepareWindow(int samplesPerCycle, int cyclesPerWindow)
+{
+    m_cyclesCollected = 0;
+    m_samplesPerCycle = samplesPerCycle;
+    m_cyclesPerWindow = cyclesPerWindow;
+
+    const size_t windowSize = static_cast<size_t>(samplesPerCycle) * cyclesPerWindow;
+    if(windowSize == m_windowSize) return;
+
+    // 크기가 바뀐 경우에만 재할당
+    m_windowSize = windowSize;
+    for(auto& buffer : m_samples) {
+        buffer.assign(windowSize, 0.0);
+    }
+    m_fftOut.assign(windowSize / 2 + 1, kiss_fft_cpx{});
+    m_binPowers.assign(windowSize / 2 + 1, 0.0);
+
+    // 10/12 사이클이므로 N은 항상 짝수 -> 실수 FFT 사용
+    m_fftConfig.reset(kiss_fftr_alloc(static_cast<int>(windowSize), 0, nullptr, nullptr));
+    if(!m_fftConfig) {
+        qWarning() << "HarmonicGroupAnalyzer: FFT Allocation Failed (N =" << windowSize << ")";
+    }
+}
+
+bool HarmonicGroupAnalyzer::analyzeWindow()
+{
+    if(!m_fftConfig || m_windowSize % 2 != 0) return false;
+
+    const int C = m_cyclesPerWindow;
+    // 그룹 계산에 h*C + C/2 빈까지 필요하므로 Nyquist 한계 적용
+    const int maxOrder = std::min(MaxHarmonicOrder, (m_samplesPerCycle - 1) / 2);
+    if(maxOrder < 1) return false;
+
+    m_result.timestamp = m_lastTimestamp;
+    m_result.cyclesPerWindow = C;
+    m_result.maxOrder = maxOrder;
+
+    const double N = static_cast<double>(m_windowSize);
+    const double oneOverNSq = 1.0 / (N * N);
+    const double twoOverNSq = 2.0 / (N * N);
+    const size_t numBins = m_binPowers.size();
+
+    for(int ch{0}; ch < HarmonicGroupResult::ChannelCount; ++ch) {
+        kiss_fftr(m_fftConfig.get(), m_samples[ch].data(), m_fftOut.data());
+
+        // 빈별 RMS 제곱 (DC, Nyquist는 1/N, 나머지는 sqrt(2)/N 스케일)
+        for(size_t k = 0; k < numBins; ++k) {
+            const double magSq = m_fftOut[k].r * m_fftOut[k].r + m_fftOut[k].i * m_fftOut[k].i;
+            m_binPowers[k] = magSq * ((k == 0 || k == numBins - 1) ? oneOverNSq : twoOverNSq);
+        }
+
+        groupSpectrum(m_result.channels[ch]);
+    }
+    return true;
+}
+
+void HarmonicGroupAnalyzer::groupSpectrum(HarmonicGroupChannel& channel)
+{
+    const int C = m_cyclesPerWindow;
+    const int half = C / 2;
+    const int maxOrder = m_result.maxOrder;
+    const int lastBin = static_cast<int>(m_binPowers.size()) - 1;
+
+    channel.groups.assign(maxOrder + 1, 0.0);
+    channel.subgroups.assign(maxOrder + 1, 0.0);
+    channel.interharmonicCentredSubgroups.assign(maxOrder + 1, 0.0);
+
+    for(int h{0}; h <= maxOrder; ++h) {
+        const int k = h * C;
+
+        if(h >= 1) {
+            // 고조파 그룹: 양끝 빈은 절반 가중, 나머지는 전체 합산
+            double groupSq = 0.5 * (m_binPowers[k - half] + m_binPowers[k + half]);
+            for(int i{-half + 1}; i <= half - 1; ++i) {
+                groupSq += m_binPowers[k + i];
+            }
+            channel.groups[h] = std::sqrt(groupSq);
+
+            // 고조파 서브그룹: 중심 빈과 인접 빈 2개
+            channel.subgroups[h] = std::sqrt(m_binPowers[k - 1] + m_binPowers[k] + m_binPowers[k + 1]);
+        }
+
+        // 간고조파 중심 서브그룹: 고조파 인접 빈을 제외한 h ~ h+1 사이 빈
+        if(k + C - 2 <= lastBin) {
+            double isgSq = 0.0;
+            for(int i{2}; i <= C - 2; ++i) {
+                isgSq += m_binPowers[k + i];
+            }
+            channel.interharmonicCentredSubgroups[h] = std::sqrt(isgSq);
+        }
+    }
+}
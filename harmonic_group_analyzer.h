@@ -0,0 +1,71 @@
+#ifndef HARMONIC_GROUP_ANALYZER_H
+#define HARMONIC_GROUP_ANALYZER_H
+
+#include <QObject>
+#include <array>
+#include <chrono>
+#include <vector>
+#include "analysis_utils.h"
+#include "data_point.h"
+
+// IEC 61000-4-7 그룹화 결과 (채널 하나)
+// 인덱스 = 고조파 차수 h. 간고조파 값은 h차와 h+1차 사이 구간
+struct HarmonicGroupChannel {
+    std::vector<double> groups;                         // 고조파 그룹 G_g,h
+    std::vector<double> subgroups;                      // 고조파 서브그룹 G_sg,h
+    std::vector<double> interharmonicCentredSubgroups;  // 간고조파 중심 서브그룹 C_isg,h
+};
+
+struct HarmonicGroupResult {
+    enum Channel { VoltageA, VoltageB, VoltageC, CurrentA, CurrentB, CurrentC, ChannelCount };
+
+    std::chrono::nanoseconds timestamp{0}; // 윈도우 종료 시각
+    int cyclesPerWindow = 0;               // 10 또는 12
+    int maxOrder = 0;                      // 계산된 최대 차수 (50 또는 Nyquist 한계)
+    std::array<HarmonicGroupChannel, ChannelCount> channels;
+};
+Q_DECLARE_METATYPE(HarmonicGroupResult)
+
+// HarmonicGroupAnalyzer 클래스
+// 10/12 사이클(200ms) 윈도우의 샘플을 모아 윈도우당 한 번 FFT를 수행하고
+// 5Hz 해상도 스펙트럼으로부터 고조파 그룹/서브그룹, 간고조파 중심 서브그룹을 계산.
+// 샘플 버퍼, FFT 입출력, 결과 벡터는 모두 재사용되며 윈도우 크기가 바뀔 때만 재할당됨.
+class HarmonicGroupAnalyzer : public QObject
+{
+    Q_OBJECT
+public:
+    static constexpr int MaxHarmonicOrder = 50;
+
+    explicit HarmonicGroupAnalyzer(QObject* parent = nullptr);
+
+    // 1사이클 분량의 샘플 입력. cyclesPerWindow는 윈도우 시작 시점에 고정됨
+    void processCycle(const std::vector<DataPoint>& cycleSamples, int cyclesPerWindow);
+
+    // 진행 중인 윈도우 폐기
+    void reset();
+
+    const HarmonicGroupResult& lastResult() const;
+
+signals:
+    void harmonicGroupsUpdated(const HarmonicGroupResult& result);
+
+private:
+    void prepareWindow(int samplesPerCycle, int cyclesPerWindow);
+    bool analyzeWindow();
+    void groupSpectrum(HarmonicGroupChannel& channel);
+
+    int m_samplesPerCycle;
+    int m_cyclesPerWindow;
+    int m_cyclesCollected;
+    size_t m_windowSize;
+
+    std::array<std::vector<kiss_fft_scalar>, HarmonicGroupResult::ChannelCount> m_samples;
+    std::vector<kiss_fft_cpx> m_fftOut;
+    std::vector<double> m_binPowers; // 빈별 RMS 제곱 (재사용)
+    AnalysisUtils::KissFftrUniquePtr m_fftConfig;
+
+    std::chrono::nanoseconds m_lastTimestamp;
+    HarmonicGroupResult m_result;
+};
+
+#endif // HARMONIC_GROUP_ANALYZER_H
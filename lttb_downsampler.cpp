@@ -0,0 +1,121 @@
+#include "lttb_downsampler.h"
+#include <algorithm>
+#include <cmath>
+#include <future>
+#include <numeric>
+#include <thread>
+
+std::vector<size_t> LttbDownsampler::selectIndices(std::span<const double> x, std::span<const double> ys,
+                                                   size_t seriesCount, int threshold)
+{
+    const size_t n = x.size();
+    std::vector<size_t> selected;
+
+    // threshold가 전체 데이터 크기보다 크거나 너무 작으면 다운 샘플링 불필요
+    if(threshold <= 2 || n <= static_cast<size_t>(threshold) || seriesCount == 0 || ys.size() < n * seriesCount) {
+        selected.resize(n);
+        std::iota(selected.begin(), selected.end(), size_t{0});
+        return selected;
+    }
+
+    const size_t bucketCount = static_cast<size_t>(threshold) - 2;
+    // 버킷 크기 = (전체 데이터 수 - 양 끝점) / (샘플링할 중간점 개수)
+    const double bucketSize = static_cast<double>(n - 2) / static_cast<double>(bucketCount);
+
+    const auto bucketStart = [&](size_t b) { return static_cast<size_t>(std::floor(b * bucketSize)) + 1; };
+    const auto bucketEnd = [&](size_t b) { return std::min(n - 1, static_cast<size_t>(std::floor((b + 1) * bucketSize)) + 1); };
+
+    selected.resize(static_cast<size_t>(threshold));
+    selected.front() = 0;       // 첫 점 보존
+    selected.back() = n - 1;    // 끝 점 보존
+
+    // 버킷 [bBegin, bEnd) 구간 처리
+    const auto selectRange = [&](size_t bBegin, size_t bEnd) {
+        std::vector<double> avgY(seriesCount);
+        std::vector<double> areas;
+        // 첫 구간은 첫 점, 그 외 구간은 구간 직전의 원본 점을 기준점으로 사용
+        size_t prevIndex = (bBegin == 0) ? 0 : bucketStart(bBegin) - 1;
+
+        for(size_t b = bBegin; b < bEnd; ++b) {
+            const size_t start = bucketStart(b);
+            const size_t end = bucketEnd(b);
+
+            // 다음 버킷의 평균 좌표 (마지막 버킷은 끝 점)
+            const size_t nextStart = end;
+            const size_t nextEnd = std::min(n, static_cast<size_t>(std::floor((b + 2) * bucketSize)) + 1);
+            const size_t nextCount = nextEnd > nextStart ? nextEnd - nextStart : 0;
+
+            double avgX = 0.0;
+            std::fill(avgY.begin(), avgY.end(), 0.0);
+            if(nextCount > 0) {
+                for(size_t j = nextStart; j < nextEnd; ++j) avgX += x[j];
+                avgX /= nextCount;
+                for(size_t k = 0; k < seriesCount; ++k) {
+                    const double* column = ys.data() + k * n;
+                    double sum = 0.0;
+                    for(size_t j = nextStart; j < nextEnd; ++j) sum += column[j];
+                    avgY[k] = sum / nextCount;
+                }
+            }
+
+            // 계열마다 열을 연속으로 훑으며 점별 최대 삼각형 넓이 갱신 (벡터화 가능한 내부 루프)
+            // 넓이*2 = |(currX - prevX)(avgY - prevY) - (avgX - prevX)(currY - prevY)|
+            const size_t count = end - start;
+            areas.assign(count, 0.0);
+            const double prevX = x[prevIndex];
+            const double spanX = avgX - prevX;
+            const double* xs = x.data() + start;
+            for(size_t k = 0; k < seriesCount; ++k) {
+                const double* column = ys.data() + k * n;
+                const double prevY = column[prevIndex];
+                const double spanY = avgY[k] - prevY;
+                const double* cs = column + start;
+                for(size_t j = 0; j < count; ++j) {
+                    const double area = std::abs((xs[j] - prevX) * spanY - spanX * (cs[j] - prevY));
+                    areas[j] = std::max(areas[j], area);
+                }
+            }
+
+            const size_t bestIndex = start + static_cast<size_t>(std::max_element(areas.begin(), areas.end()) - areas.begin());
+            selected[b + 1] = bestIndex;
+            prevIndex = bestIndex;
+        }
+    };
+
+    // 버킷 구간을 나눠 병렬 선택
+    parallelFor(bucketCount, n, selectRange);
+    return selected;
+}
+
+void LttbDownsampler::parallelFor(size_t itemCount, size_t pointCount, const std::function<void(size_t, size_t)>& body)
+{
+    if(itemCount == 0) return;
+
+    // 작업 수 결정
+    size_t taskCount = 1;
+    if(pointCount >= config::Downsampling::ParallelThreshold) {
+        const size_t hardware = std::max(1u, std::thread::hardware_concurrency());
+        taskCount = std::clamp<size_t>(pointCount / config::Downsampling::MinPointsPerTask, 1, hardware);
+        taskCount = std::min(taskCount, itemCount);
+    }
+
+    if(taskCount == 1) {
+        body(0, itemCount);
+        return;
+    }
+
+    // 현재 스레드도 마지막 구간을 처리
+    std::vector<std::future<void>> tasks;
+    tasks.reserve(taskCount - 1);
+    const size_t itemsPerTask = (itemCount + taskCount - 1) / taskCount;
+    size_t begin = 0;
+    while(begin + itemsPerTask < itemCount) {
+        tasks.push_back(std::async(std::launch::async, body, begin, begin + itemsPerTask));
+        begin += itemsPerTask;
+    }
+    body(begin, itemCount);
+
+    for(auto& task : tasks) {
+        task.get();
+    }
+}
@@ -0,0 +1,85 @@
+#ifndef LTTB_DOWNSAMPLER_H
+#define LTTB_DOWNSAMPLER_H
+
+#include <cstdint>
+#include <functional>
+#include <iterator>
+#include <span>
+#include <tuple>
+#include <vector>
+#include "config.h"
+
+// LttbDownsampler 클래스
+// Largest-Triangle-Three-Buckets 다운샘플링.
+// 입력을 x 열과 계열별 y 열(연속 메모리)로 한 번만 추출한 뒤 커널이 열 단위로 처리함.
+// 추출기는 템플릿 인자(람다)로 받으므로 인라인되며 std::function/QVariant 경유가 없음.
+// 점이 많으면 버킷 구간을 나눠 병렬로 선택 (구간 경계에서는 직전 원본 점을 기준점으로 사용).
+class LttbDownsampler
+{
+public:
+    static constexpr uint32_t AllSeries = ~0u;
+
+    // 열 데이터에서 대표 점 인덱스 선택
+    // ys는 계열 k의 i번째 값이 ys[k * x.size() + i]인 열 우선 배열
+    static std::vector<size_t> selectIndices(std::span<const double> x, std::span<const double> ys,
+                                             size_t seriesCount, int threshold);
+
+    // [0, itemCount)를 구간으로 나눠 body(begin, end)를 병렬 실행.
+    // pointCount가 config::Downsampling::ParallelThreshold 미만이면 현재 스레드에서 한 번에 실행
+    static void parallelFor(size_t itemCount, size_t pointCount, const std::function<void(size_t, size_t)>& body);
+
+    // [first, last)에서 threshold개의 점을 선택.
+    // seriesMask의 i번째 비트가 켜진 추출기만 중요도 계산에 사용
+    template<typename Iterator, typename... Extractors>
+    static auto downsample(Iterator first, Iterator last, int threshold, uint32_t seriesMask, Extractors&&... extractors)
+    {
+        using Point = typename std::iterator_traits<Iterator>::value_type;
+
+        std::vector<Point> sampled;
+        const size_t n = static_cast<size_t>(std::distance(first, last));
+        if(threshold <= 2 || n <= static_cast<size_t>(threshold)) {
+            sampled.assign(first, last);
+            return sampled;
+        }
+
+        // 사용할 계열 수
+        size_t seriesCount = 0;
+        for(size_t k = 0; k < sizeof...(Extractors); ++k) {
+            if((seriesMask >> k) & 1u) ++seriesCount;
+        }
+
+        // 1. 열 추출 (입력 한 번 순회, 구간별 병렬)
+        std::vector<double> x(n);
+        std::vector<double> ys(n * seriesCount);
+        parallelFor(n, n, [&](size_t begin, size_t end) {
+            auto it = std::next(first, begin);
+            for(size_t i = begin; i < end; ++i, ++it) {
+                x[i] = utils::FpSeconds(it->timestamp).count();
+                size_t index = 0;
+                size_t column = 0;
+                (([&] {
+                    if((seriesMask >> index++) & 1u) {
+                        ys[(column++) * n + i] = extractors(*it);
+                    }
+                }()), ...);
+            }
+        });
+
+        // 계열이 없으면 시간 축만으로 선택
+        if(seriesCount == 0) {
+            ys.assign(n, 0.0);
+            seriesCount = 1;
+        }
+
+        // 2. 커널
+        const auto indices = selectIndices(x, ys, seriesCount, threshold);
+
+        sampled.reserve(indices.size());
+        for(size_t index : indices) {
+            sampled.push_back(*std::next(first, index));
+        }
+        return sampled;
+    }
+};
+
+#endif // LTTB_DOWNSAMPLER_H
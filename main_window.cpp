@@ -13,6 +13,7 @@
 #include "demand_calculator.h"
 #include "simulation_engine.h"
 
+#include <QActionGroup>
 #include <QDockWidget>
 #include <QStatusBar>
 #include <QMenuBar>
@@ -70,6 +71,34 @@ void MainWindow::createMenus()
 
     m_actionA3700 = new QAction("A3700 Display(&D)", this);
     toolsMenu->addAction(m_actionA3700);
+
+    // ADC 전단 모델 (양자화/오차/잡음) 켜기/끄기
+    m_actionAdcFrontEnd = new QAction("ADC 전단 모델(&A)", this);
+    m_actionAdcFrontEnd->setCheckable(true);
+    toolsMenu->addAction(m_actionAdcFrontEnd);
+
+    // 파형 이력 저장 형식 (정수 형식은 같은 메모리로 더 긴 이력을 보관)
+    QMenu* historyMenu = toolsMenu->addMenu("파형 이력 저장 형식(&H)");
+    m_historyStorageGroup = new QActionGroup(this);
+    const std::array<std::pair<const char*, SampleHistory::Storage>, 3> storages = {{
+        {"double (손실 없음)", SampleHistory::Storage::Double},
+        {"int32", SampleHistory::Storage::Int32},
+        {"int16 (최소 메모리)", SampleHistory::Storage::Int16},
+    }};
+    for(const auto& [label, storage] : storages) {
+        QAction* action = historyMenu->addAction(label);
+        action->setCheckable(true);
+        action->setChecked(storage == SampleHistory::Storage::Double);
+        action->setData(static_cast<int>(storage));
+        m_historyStorageGroup->addAction(action);
+    }
+
+    // 외란 시나리오 실행/중지
+    toolsMenu->addSeparator();
+    m_actionRunScenario = new QAction("시나리오 실행(&R)...", this);
+    toolsMenu->addAction(m_actionRunScenario);
+    m_actionStopScenario = new QAction("시나리오 중지", this);
+    toolsMenu->addAction(m_actionStopScenario);
 }
 
 void MainWindow::setupUiComponents()
@@ -220,11 +249,19 @@ void MainWindow::updatePlaceholderVisibility()
 
 void MainWindow::updateFpsLabel()
 {
-    // 1초간 누적도니 프레임 카운트를 라벨에 표시
-    m_fpsLabel->setText(QString("FPS: %1").arg(m_frameCount));
+    // 1초간 누적도니 프레임 카운트와 합쳐진(버려진) 갱신 수를 라벨에 표시
+    m_fpsLabel->setText(QString("FPS: %1 | Dropped: %2/s")
+                            .arg(m_frameCount)
+                            .arg(m_droppedUpdateTotal - m_droppedUpdateReported));
 
     // 다음 1초를 위해 카운터 리셋
     m_frameCount = 0;
+    m_droppedUpdateReported = m_droppedUpdateTotal;
+}
+
+void MainWindow::setDroppedUpdateCount(quint64 total)
+{
+    m_droppedUpdateTotal = total;
 }
 
 void MainWindow::onPresetLoaded(const ControlPanelState& state)
@@ -18,6 +18,7 @@ class AdditionalMetricsWindow;
 class ThreePhaseDialog;
 class PidTuningDialog;
 class A3700N_Window;
+class QActionGroup;
 class DemandCalculator;
 
 class QLabel;
@@ -52,12 +53,17 @@ public:
     QAction* getActionPidTuning() const { return m_actionPidTuning; }
     QAction* getActionThreePhase() const { return m_actionThreePhaseSettings; }
     QAction* getActionA3700() const { return m_actionA3700; }
+    QAction* getActionAdcFrontEnd() const { return m_actionAdcFrontEnd; }
+    QActionGroup* getHistoryStorageGroup() const { return m_historyStorageGroup; } // action data = SampleHistory::Storage
+    QAction* getActionRunScenario() const { return m_actionRunScenario; }
+    QAction* getActionStopScenario() const { return m_actionStopScenario; }
 
 public slots:
     void onPresetLoaded(const ControlPanelState& state);
     void showThreePhaseDialog();
     void showPidTuningDialog();
     void showA3700Window();
+    void setDroppedUpdateCount(quint64 total); // FramePresenter가 합쳐서 버린 누적 갱신 수
 
 private slots:
     void updatePlaceholderVisibility();
@@ -93,12 +99,18 @@ private:
     QLabel* m_fpsLabel;
     QTimer* m_fpsTimer;
     uint64_t m_frameCount;
+    quint64 m_droppedUpdateTotal = 0;
+    quint64 m_droppedUpdateReported = 0;   // 마지막 FPS 표시 시점의 누적값
 
     // 메뉴 엑션
     QAction* m_actionSettings;
     QAction* m_actionPidTuning;
     QAction* m_actionThreePhaseSettings;
     QAction* m_actionA3700;
+    QAction* m_actionAdcFrontEnd;
+    QActionGroup* m_historyStorageGroup;
+    QAction* m_actionRunScenario;
+    QAction* m_actionStopScenario;
 
     // void createSignalSlotConnections();
 };
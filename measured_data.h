@@ -6,6 +6,8 @@
 #include <QMetaType>
 #include <chrono>
 #include <complex>
+#include <deque>
+#include <memory>
 
 // 단일 고조파 성분의 분석 결과를 담는 구조체
 struct HarmonicAnalysisResult {
@@ -15,6 +17,53 @@ struct HarmonicAnalysisResult {
     std::complex<double> phasor; // cos(실수) + j*sin(허수) 성분
 };
 
+// 차수별 고조파 전력과 대칭 성분 크기 (벡터 인덱스 = 차수, 0: DC ~ N/2)
+// 사이클 스펙트럼에서 모든 차수를 한 번에 계산 (AnalysisUtils::calculateHarmonicOrderData)
+struct HarmonicOrderData {
+    GenericPhaseData<std::vector<double>> activePower;   // P_h = Re(V_h I_h*)
+    GenericPhaseData<std::vector<double>> reactivePower; // Q_h = Im(V_h I_h*) (전류가 뒤지면 +)
+    GenericPhaseSymmetricalComponents<std::vector<double>> voltageSequence;
+    GenericPhaseSymmetricalComponents<std::vector<double>> currentSequence;
+
+    size_t orderCount() const { return activePower.a.size(); }
+};
+
+// IEEE 1459-2010 전력 분해 (한 상, 또는 3상 유효값 Ve/Ie 기준)
+//  S² = S1² + SN²,  SN² = DI² + DV² + SH²,  SH² = PH² + DH²
+struct Ieee1459Power {
+    double p = 0.0;   // 유효 전력
+    double p1 = 0.0;  // 기본파 유효 전력
+    double q1 = 0.0;  // 기본파 무효 전력 (전류가 뒤지면 +)
+    double s = 0.0;   // 피상 전력 V·I (3상: Se = 3·Ve·Ie)
+    double s1 = 0.0;  // 기본파 피상 전력 V1·I1 (3상: Se1)
+    double sn = 0.0;  // 비기본파 피상 전력
+    double di = 0.0;  // 전류 왜곡 전력 V1·IH
+    double dv = 0.0;  // 전압 왜곡 전력 VH·I1
+    double sh = 0.0;  // 고조파 피상 전력 VH·IH
+    double ph = 0.0;  // 고조파 유효 전력 P - P1
+    double dh = 0.0;  // 고조파 왜곡 전력
+    double n = 0.0;   // 비유효 전력 sqrt(S² - P²)
+    double pf = 0.0;  // 역률 P / S
+    double pf1 = 0.0; // 기본파 역률 P1 / S1 (3상: 정상분 P1+ / S1+)
+};
+
+// 3상 4선식 시스템 값 (Ieee1459Power 항목은 유효값 기준)
+struct Ieee1459SystemPower : public Ieee1459Power {
+    double ve = 0.0;  // 유효 전압 sqrt((3·ΣV² + ΣVll²) / 18)
+    double ve1 = 0.0;
+    double ie = 0.0;  // 유효 전류 sqrt((ΣI² + In²) / 3)
+    double ie1 = 0.0;
+    double p1Positive = 0.0; // 정상분 기본파 전력
+    double q1Positive = 0.0;
+    double s1Positive = 0.0;
+    double s1Unbalanced = 0.0; // 기본파 불평형 전력 sqrt(Se1² - S1+²)
+};
+
+struct Ieee1459Data {
+    GenericPhaseData<Ieee1459Power> phase;
+    Ieee1459SystemPower system;
+};
+
 // 한 사이클 동안 연산 결과를 담는 구조체
 struct MeasuredData {
     std::chrono::nanoseconds timestamp; // 사이클이 끝나는 시점의 타임스탬프
@@ -43,10 +92,19 @@ struct MeasuredData {
     GenericPhaseData<std::vector<HarmonicAnalysisResult>> fullVoltageHarmonics;
     GenericPhaseData<std::vector<HarmonicAnalysisResult>> fullCurrentHarmonics;
 
+    // 차수별 고조파 유효/무효 전력, 영상/정상/역상 크기
+    HarmonicOrderData harmonicOrders;
+
+    // IEEE 1459 기본파/비기본파 전력 분해 (상별, 시스템)
+    Ieee1459Data power;
+
     // 잔류 RMS 멤버
     double residualVoltageRms = 0.0;
     double residualCurrentRms = 0.0;
 
+    // 샘플 단위 주파수 추적(SOGI-FLL) 결과. 해당 추적 방식이 아니면 0
+    double trackedFrequency = 0.0; // Hz
+    double rocof = 0.0;            // Hz/s
 };
 
 // 단일 시퀀스 성분
@@ -60,6 +118,7 @@ struct SymmetricalComponents_ll  : public GenericLinetoLineSymmetricalComponents
 
 // 1초 단위로 가공된 분석 데이터를 담는 구조체
 struct OneSecondSummaryData {
+    std::chrono::nanoseconds timestamp{0}; // 1초 구간이 끝나는 시점 (시뮬레이션 시간)
 
     PhaseData totalVoltageRms;
     PhaseData totalCurrentRms;
@@ -111,6 +170,11 @@ struct OneSecondSummaryData {
     double currentU0Unbalance = 0.0;
     double currentU2Unbalance = 0.0;
 
+    // 플리커 (IEC 61000-4-15). Pst는 10분, Plt는 2시간이 지나야 값이 생기며 그 전에는 NaN
+    PhaseData flickerPinst;
+    PhaseData flickerPst;
+    PhaseData flickerPlt;
+
     // 마지막 사이클의 전체 고조파 정보
     GenericPhaseData<std::vector<HarmonicAnalysisResult>> lastCycleVoltageHarmonics;
     GenericPhaseData<std::vector<HarmonicAnalysisResult>> lastCycleCurrentHarmonics;
@@ -122,4 +186,13 @@ struct OneSecondSummaryData {
     std::vector<DataPoint> lastTwoCycleData;
 };
 
+// 1초 요약 데이터의 불변 스냅샷
+// 여러 소비자(스레드 포함)에 전달해도 구조체 복사 없이 참조 카운트만 증가
+using OneSecondSummarySnapshot = std::shared_ptr<const OneSecondSummaryData>;
+Q_DECLARE_METATYPE(OneSecondSummarySnapshot)
+
+// 사이클 측정값 이력의 불변 스냅샷 (분석 그래프 여러 개에 큐 연결로 보내도 deque는 한 번만 복사)
+using MeasuredDataSnapshot = std::shared_ptr<const std::deque<MeasuredData>>;
+Q_DECLARE_METATYPE(MeasuredDataSnapshot)
+
 #endif // MEASURED_DATA_H
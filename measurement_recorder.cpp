@@ -0,0 +1,568 @@
+#include "measurement_recorder.h"
+#include "config.h"
+#include <QDebug>
+#include <array>
+#include <cmath>
+
+namespace {
+    // PRAGMA user_version (스키마를 바꾸면 증가)
+    // 1: sessions 테이블과 (session, t_ns) 인덱스, 수요는 항목별 행
+    constexpr int SchemaVersion = 1;
+
+    constexpr const char* CreateSessionsTable =
+        "CREATE TABLE IF NOT EXISTS sessions ("
+        " id INTEGER PRIMARY KEY AUTOINCREMENT,"
+        " started_ms INTEGER NOT NULL"
+        ");";
+
+    constexpr const char* CreateSummariesTable =
+        "CREATE TABLE IF NOT EXISTS summaries ("
+        " session INTEGER NOT NULL,"
+        " t_ns INTEGER NOT NULL,"
+        " v_a REAL, v_b REAL, v_c REAL,"
+        " i_a REAL, i_b REAL, i_c REAL,"
+        " thd_v_a REAL, thd_v_b REAL, thd_v_c REAL,"
+        " thd_i_a REAL, thd_i_b REAL, thd_i_c REAL,"
+        " p_total REAL, q_total REAL, s_total REAL, pf_total REAL,"
+        " freq REAL"
+        ");";
+
+    // 시각마다 항목(quantity)별 한 행: 블록/슬라이딩/열적 수요와 각 최대 수요 레지스터(값, 시각)
+    constexpr const char* CreateDemandTable =
+        "CREATE TABLE IF NOT EXISTS demand ("
+        " session INTEGER NOT NULL,"
+        " t_ns INTEGER NOT NULL,"
+        " quantity TEXT NOT NULL,"
+        " block REAL, sliding REAL, thermal REAL,"
+        " peak_block REAL, peak_block_t_ns INTEGER,"
+        " peak_sliding REAL, peak_sliding_t_ns INTEGER,"
+        " peak_thermal REAL, peak_thermal_t_ns INTEGER"
+        ");";
+
+    // demand.quantity 값과 DemandRecord 항목의 대응
+    template <typename Record>
+    auto demandQuantities(Record& r) {
+        return std::array{
+            std::pair{"p", &r.activePower},
+            std::pair{"q", &r.reactivePower},
+            std::pair{"s", &r.apparentPower},
+            std::pair{"i_a", &r.current.a},
+            std::pair{"i_b", &r.current.b},
+            std::pair{"i_c", &r.current.c},
+            std::pair{"pf", &r.powerFactor}
+        };
+    }
+
+    // 집계 단계(tier)는 AggregationTier 값
+    constexpr const char* CreateAggregatesTable =
+        "CREATE TABLE IF NOT EXISTS aggregates ("
+        " session INTEGER NOT NULL,"
+        " tier INTEGER NOT NULL,"
+        " start_ns INTEGER NOT NULL,"
+        " end_ns INTEGER NOT NULL,"
+        " cycles INTEGER NOT NULL,"
+        " v_a REAL, v_b REAL, v_c REAL,"
+        " v_ab REAL, v_bc REAL, v_ca REAL,"
+        " i_a REAL, i_b REAL, i_c REAL,"
+        " p_a REAL, p_b REAL, p_c REAL,"
+        " freq REAL,"
+        " flagged INTEGER NOT NULL"
+        ");";
+
+    constexpr const char* CreateEventsTable =
+        "CREATE TABLE IF NOT EXISTS events ("
+        " id INTEGER PRIMARY KEY AUTOINCREMENT,"
+        " session INTEGER NOT NULL,"
+        " start_ns INTEGER NOT NULL,"
+        " duration_ns INTEGER NOT NULL,"
+        " type TEXT NOT NULL,"
+        " phase INTEGER NOT NULL,"
+        " extreme_value REAL"
+        ");";
+
+    // 범위 조회는 (세션, 시각) B-tree 범위 탐색
+    constexpr const char* CreateIndexes[] = {
+        "CREATE INDEX IF NOT EXISTS idx_summaries_session_t ON summaries(session, t_ns);",
+        "CREATE INDEX IF NOT EXISTS idx_demand_session_t ON demand(session, t_ns);",
+        "CREATE INDEX IF NOT EXISTS idx_aggregates_session_tier_start ON aggregates(session, tier, start_ns);",
+        "CREATE INDEX IF NOT EXISTS idx_events_session_start ON events(session, start_ns);"
+    };
+
+    // SQLite는 NaN을 NULL로 저장하므로 읽을 때 다시 NaN으로 변환
+    double fromNullable(const std::optional<double>& v) {
+        return v.value_or(std::numeric_limits<double>::quiet_NaN());
+    }
+
+    std::optional<double> toNullable(double v) {
+        return std::isnan(v) ? std::nullopt : std::optional<double>(v);
+    }
+
+    // 최대 수요 레지스터가 한 번도 갱신되지 않았으면 NULL
+    std::optional<long long> peakTime(const MaxTracker<double>& peak) {
+        return peak.hasTimestamp() ? std::optional<long long>(peak.timestamp.count()) : std::nullopt;
+    }
+
+    std::optional<double> peakValue(const MaxTracker<double>& peak) {
+        return peak.hasTimestamp() ? std::optional<double>(peak.value) : std::nullopt;
+    }
+
+    void restorePeak(MaxTracker<double>& peak, const std::optional<double>& value, const std::optional<long long>& time) {
+        if(value && time) {
+            peak.update(*value, std::chrono::nanoseconds(*time));
+        }
+    }
+}
+
+MeasurementRecorder::MeasurementRecorder(std::string_view dbPath, QObject* parent)
+    : QObject{parent}
+    , m_dbPath(dbPath)
+    , m_writeDb(m_dbPath)
+    , m_sessionId(0)
+    , m_inFlight(0)
+    , m_droppedCount(0)
+    , m_flushRequested(false)
+    , m_stopRequested(false)
+{
+    try {
+        createSchema();
+        beginSession();
+    } catch(const std::exception& e) {
+        throw std::runtime_error("측정 데이터베이스 초기화 실패: " + std::string(e.what()));
+    }
+
+    m_pending.reserve(config::Recorder::BatchSize);
+    m_writerThread = std::thread(&MeasurementRecorder::writerLoop, this);
+}
+
+MeasurementRecorder::~MeasurementRecorder()
+{
+    {
+        std::lock_guard lock(m_queueMutex);
+        m_stopRequested = true;
+    }
+    m_queueCondition.notify_one();
+    if(m_writerThread.joinable()) {
+        m_writerThread.join();
+    }
+}
+
+void MeasurementRecorder::createSchema()
+{
+    // WAL: 기록 중에도 읽기 연결이 막히지 않음. synchronous=NORMAL이면 커밋당 fsync 없음
+    std::string journalMode;
+    m_writeDb << "PRAGMA journal_mode=WAL;" >> journalMode;
+    if(journalMode != "wal") {
+        qWarning() << "MeasurementRecorder: WAL mode unavailable, journal_mode =" << QString::fromStdString(journalMode);
+    }
+    m_writeDb << "PRAGMA synchronous=NORMAL;";
+
+    // 테이블과 인덱스, 버전을 한 트랜잭션으로 생성 (이미 있으면 유지)
+    m_writeDb << "BEGIN;";
+    try {
+        m_writeDb << CreateSessionsTable;
+        m_writeDb << CreateSummariesTable;
+        m_writeDb << CreateDemandTable;
+        m_writeDb << CreateAggregatesTable;
+        m_writeDb << CreateEventsTable;
+        for(const char* index : CreateIndexes) {
+            m_writeDb << index;
+        }
+        m_writeDb << "PRAGMA user_version = " + std::to_string(SchemaVersion) + ";";
+        m_writeDb << "COMMIT;";
+    } catch(...) {
+        m_writeDb << "ROLLBACK;";
+        throw;
+    }
+}
+
+void MeasurementRecorder::beginSession()
+{
+    const auto now = std::chrono::system_clock::now();
+    const long long startedMs = std::chrono::duration_cast<std::chrono::milliseconds>(now.time_since_epoch()).count();
+    m_writeDb << "INSERT INTO sessions (started_ms) VALUES (?);" << startedMs;
+    m_sessionId = m_writeDb.last_insert_rowid();
+}
+
+MeasurementRecorder::SessionId MeasurementRecorder::sessionId() const { return m_sessionId; }
+
+// --- 기록 (호출 스레드) ---
+
+void MeasurementRecorder::recordSummary(const OneSecondSummarySnapshot& snapshot)
+{
+    if(!snapshot) return;
+    // 스냅샷은 불변 공유 객체이므로 포인터만 큐에 넣음
+    enqueue(snapshot);
+}
+
+void MeasurementRecorder::recordDemand(const DemandData& data)
+{
+    enqueue(DemandRecord{data.timestamp, data.totalActivePowerDemand, data.totalReactivePowerDemand, data.totalApparentPowerDemand,
+                         data.currentDemand, data.totalPowerFactorDemand});
+}
+
+void MeasurementRecorder::recordAggregate(const AggregatedData& data)
+{
+    if(data.tier == AggregationTier::BaseWindow) return;
+    enqueue(data);
+}
+
+void MeasurementRecorder::recordEvent(const EventRecord& event)
+{
+    enqueue(event);
+}
+
+void MeasurementRecorder::enqueue(PendingRow&& row)
+{
+    bool notify = false;
+    {
+        std::lock_guard lock(m_queueMutex);
+        if(m_pending.size() >= config::Recorder::MaxPendingRows) {
+            // 디스크가 따라오지 못하는 경우에도 호출 스레드는 대기하지 않음
+            ++m_droppedCount;
+            return;
+        }
+        m_pending.push_back(std::move(row));
+        notify = m_pending.size() >= config::Recorder::BatchSize;
+    }
+    if(notify) {
+        m_queueCondition.notify_one();
+    }
+}
+
+void MeasurementRecorder::flush()
+{
+    std::unique_lock lock(m_queueMutex);
+    m_flushRequested = true;
+    m_queueCondition.notify_one();
+    m_flushedCondition.wait(lock, [this] { return m_pending.empty() && m_inFlight == 0; });
+}
+
+size_t MeasurementRecorder::droppedCount() const
+{
+    std::lock_guard lock(m_queueMutex);
+    return m_droppedCount;
+}
+
+// --- 기록 스레드 ---
+
+// 구문은 처음 기록할 때 한 번만 준비하고, 행마다 바인딩/실행만 반복
+struct MeasurementRecorder::PreparedStatements {
+    sqlite::database_binder insertSummary;
+    sqlite::database_binder insertDemand;
+    sqlite::database_binder insertAggregate;
+    sqlite::database_binder insertEvent;
+};
+
+MeasurementRecorder::PreparedStatements& MeasurementRecorder::statements()
+{
+    if(!m_statements) {
+        m_statements = std::make_unique<PreparedStatements>(PreparedStatements{
+            m_writeDb << "INSERT INTO summaries VALUES (?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?);",
+            m_writeDb << "INSERT INTO demand VALUES (?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?);",
+            m_writeDb << "INSERT INTO aggregates VALUES (?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?);",
+            m_writeDb << "INSERT INTO events (session, start_ns, duration_ns, type, phase, extreme_value) VALUES (?, ?, ?, ?, ?, ?);"
+        });
+        // 실행하지 않은 구문이 소멸 시 실행되지 않도록 표시
+        m_statements->insertSummary.used(true);
+        m_statements->insertDemand.used(true);
+        m_statements->insertAggregate.used(true);
+        m_statements->insertEvent.used(true);
+    }
+    return *m_statements;
+}
+
+// 예외로 중단된 구문은 바인딩 위치와 실행 상태가 남아 다음 배치의 바인딩이 어긋나므로 버리고 다시 준비
+void MeasurementRecorder::discardStatements()
+{
+    if(!m_statements) {
+        return;
+    }
+    // 남은 바인딩으로 소멸 시 실행되지 않도록 표시
+    m_statements->insertSummary.used(true);
+    m_statements->insertDemand.used(true);
+    m_statements->insertAggregate.used(true);
+    m_statements->insertEvent.used(true);
+    m_statements.reset();
+}
+
+void MeasurementRecorder::writerLoop()
+{
+    std::vector<PendingRow> batch;
+    batch.reserve(config::Recorder::BatchSize);
+
+    while(true) {
+        {
+            std::unique_lock lock(m_queueMutex);
+            // 배치가 찼거나, flush 주기가 지났거나, flush/종료 요청 시 깨어남
+            m_queueCondition.wait_for(lock, config::Recorder::FlushInterval, [this] {
+                return m_stopRequested || m_flushRequested || m_pending.size() >= config::Recorder::BatchSize;
+            });
+            m_flushRequested = false;
+
+            if(m_pending.empty()) {
+                m_flushedCondition.notify_all();
+                if(m_stopRequested) break;
+                continue;
+            }
+
+            // 큐 교체 (잠금 구간은 swap 뿐)
+            batch.swap(m_pending);
+            m_inFlight = batch.size();
+        }
+
+        writeBatch(batch);
+        batch.clear();
+
+        {
+            std::lock_guard lock(m_queueMutex);
+            m_inFlight = 0;
+        }
+        m_flushedCondition.notify_all();
+    }
+    discardStatements();
+}
+
+void MeasurementRecorder::writeBatch(std::vector<PendingRow>& batch)
+{
+    try {
+        auto& [insertSummary, insertDemand, insertAggregate, insertEvent] = statements();
+
+        const auto bindDemand = [](auto& statement, const DemandValues& v) {
+            statement << toNullable(v.block) << toNullable(v.sliding) << toNullable(v.thermal)
+                      << peakValue(v.peakBlock) << peakTime(v.peakBlock)
+                      << peakValue(v.peakSliding) << peakTime(v.peakSliding)
+                      << peakValue(v.peakThermal) << peakTime(v.peakThermal);
+        };
+
+        // BatchSize 행마다 트랜잭션 1개
+        for(size_t begin = 0; begin < batch.size(); begin += config::Recorder::BatchSize) {
+            const size_t end = std::min(batch.size(), begin + config::Recorder::BatchSize);
+
+            m_writeDb << "BEGIN;";
+            try {
+                for(size_t i = begin; i < end; ++i) {
+                    std::visit([&](const auto& row) {
+                        using T = std::decay_t<decltype(row)>;
+                        if constexpr (std::is_same_v<T, OneSecondSummarySnapshot>) {
+                            const auto& s = *row;
+                            insertSummary << m_sessionId << static_cast<long long>(s.timestamp.count())
+                                          << s.totalVoltageRms.a << s.totalVoltageRms.b << s.totalVoltageRms.c
+                                          << s.totalCurrentRms.a << s.totalCurrentRms.b << s.totalCurrentRms.c
+                                          << s.voltageThd.a << s.voltageThd.b << s.voltageThd.c
+                                          << s.currentThd.a << s.currentThd.b << s.currentThd.c
+                                          << s.totalActivePower << s.totalReactivePower << s.totalApparentPower
+                                          << s.totalPowerFactor << s.frequency;
+                            insertSummary++;
+                        } else if constexpr (std::is_same_v<T, DemandRecord>) {
+                            for(const auto& [quantity, values] : demandQuantities(row)) {
+                                insertDemand << m_sessionId << static_cast<long long>(row.timestamp.count()) << std::string(quantity);
+                                bindDemand(insertDemand, *values);
+                                insertDemand++;
+                            }
+                        } else if constexpr (std::is_same_v<T, AggregatedData>) {
+                            insertAggregate << m_sessionId << static_cast<int>(row.tier)
+                                            << static_cast<long long>(row.startTime.count()) << static_cast<long long>(row.endTime.count())
+                                            << row.cycleCount
+                                            << row.voltageRms.a << row.voltageRms.b << row.voltageRms.c
+                                            << row.voltageRms_ll.ab << row.voltageRms_ll.bc << row.voltageRms_ll.ca
+                                            << row.currentRms.a << row.currentRms.b << row.currentRms.c
+                                            << row.activePower.a << row.activePower.b << row.activePower.c
+                                            << row.frequency << static_cast<int>(row.flagged);
+                            insertAggregate++;
+                        } else {
+                            insertEvent << m_sessionId << static_cast<long long>(row.startTime.count())
+                                        << static_cast<long long>(row.duration.count())
+                                        << row.type << row.phase << row.extremeValue;
+                            insertEvent++;
+                        }
+                    }, batch[i]);
+                }
+                m_writeDb << "COMMIT;";
+            } catch(...) {
+                m_writeDb << "ROLLBACK;";
+                throw;
+            }
+        }
+    } catch(const std::exception& e) {
+        discardStatements();
+        qWarning() << "MeasurementRecorder: Write failed -" << e.what();
+        emit errorOccurred(QString("측정 데이터 기록 실패: %1").arg(e.what()));
+    }
+}
+
+// --- 조회 ---
+
+std::expected<std::vector<SessionRecord>, MeasurementRecorder::Error> MeasurementRecorder::querySessions()
+{
+    try {
+        std::lock_guard lock(m_readMutex);
+        if(!m_readDb) m_readDb.emplace(m_dbPath);
+
+        std::vector<SessionRecord> records;
+        *m_readDb << "SELECT id, started_ms FROM sessions ORDER BY id;"
+            >> [&](long long id, long long startedMs) {
+                  records.push_back({id, std::chrono::system_clock::time_point(std::chrono::milliseconds(startedMs))});
+              };
+        return records;
+    } catch(const std::exception& e) {
+        return std::unexpected("세션 조회 실패: " + std::string(e.what()));
+    }
+}
+
+std::expected<std::vector<SummaryRecord>, MeasurementRecorder::Error>
+MeasurementRecorder::querySummaries(std::chrono::nanoseconds from, std::chrono::nanoseconds to)
+{
+    return querySummaries(m_sessionId, from, to);
+}
+
+std::expected<std::vector<SummaryRecord>, MeasurementRecorder::Error>
+MeasurementRecorder::querySummaries(SessionId session, std::chrono::nanoseconds from, std::chrono::nanoseconds to)
+{
+    try {
+        std::lock_guard lock(m_readMutex);
+        if(!m_readDb) m_readDb.emplace(m_dbPath);
+
+        std::vector<SummaryRecord> records;
+        *m_readDb << "SELECT t_ns, v_a, v_b, v_c, i_a, i_b, i_c,"
+                     " thd_v_a, thd_v_b, thd_v_c, thd_i_a, thd_i_b, thd_i_c,"
+                     " p_total, q_total, s_total, pf_total, freq"
+                     " FROM summaries WHERE session = ? AND t_ns BETWEEN ? AND ? ORDER BY t_ns;"
+                  << session << static_cast<long long>(from.count()) << static_cast<long long>(to.count())
+            >> [&](long long t,
+                   double va, double vb, double vc,
+                   double ia, double ib, double ic,
+                   double thdVa, double thdVb, double thdVc,
+                   double thdIa, double thdIb, double thdIc,
+                   double p, double q, double s, double pf, double freq) {
+                  SummaryRecord r;
+                  r.timestamp = std::chrono::nanoseconds(t);
+                  r.voltageRms = {va, vb, vc};
+                  r.currentRms = {ia, ib, ic};
+                  r.voltageThd = {thdVa, thdVb, thdVc};
+                  r.currentThd = {thdIa, thdIb, thdIc};
+                  r.totalActivePower = p;
+                  r.totalReactivePower = q;
+                  r.totalApparentPower = s;
+                  r.totalPowerFactor = pf;
+                  r.frequency = freq;
+                  records.push_back(r);
+              };
+        return records;
+    } catch(const std::exception& e) {
+        return std::unexpected("1초 요약 조회 실패: " + std::string(e.what()));
+    }
+}
+
+std::expected<std::vector<DemandRecord>, MeasurementRecorder::Error>
+MeasurementRecorder::queryDemand(std::chrono::nanoseconds from, std::chrono::nanoseconds to)
+{
+    return queryDemand(m_sessionId, from, to);
+}
+
+std::expected<std::vector<DemandRecord>, MeasurementRecorder::Error>
+MeasurementRecorder::queryDemand(SessionId session, std::chrono::nanoseconds from, std::chrono::nanoseconds to)
+{
+    try {
+        std::lock_guard lock(m_readMutex);
+        if(!m_readDb) m_readDb.emplace(m_dbPath);
+
+        using OptD = std::optional<double>;
+        using OptT = std::optional<long long>;
+
+        // 같은 시각의 항목별 행을 레코드 하나로 모음
+        std::vector<DemandRecord> records;
+        *m_readDb << "SELECT t_ns, quantity, block, sliding, thermal,"
+                     " peak_block, peak_block_t_ns, peak_sliding, peak_sliding_t_ns, peak_thermal, peak_thermal_t_ns"
+                     " FROM demand WHERE session = ? AND t_ns BETWEEN ? AND ? ORDER BY t_ns;"
+                  << session << static_cast<long long>(from.count()) << static_cast<long long>(to.count())
+            >> [&](long long t, std::string quantity, OptD block, OptD sliding, OptD thermal,
+                   OptD peakBlock, OptT peakBlockT, OptD peakSliding, OptT peakSlidingT, OptD peakThermal, OptT peakThermalT) {
+                  if(records.empty() || records.back().timestamp != std::chrono::nanoseconds(t)) {
+                      DemandRecord r;
+                      r.timestamp = std::chrono::nanoseconds(t);
+                      records.push_back(r);
+                  }
+                  for(auto& [name, values] : demandQuantities(records.back())) {
+                      if(quantity != name) continue;
+                      values->block = fromNullable(block);
+                      values->sliding = fromNullable(sliding);
+                      values->thermal = fromNullable(thermal);
+                      restorePeak(values->peakBlock, peakBlock, peakBlockT);
+                      restorePeak(values->peakSliding, peakSliding, peakSlidingT);
+                      restorePeak(values->peakThermal, peakThermal, peakThermalT);
+                  }
+              };
+        return records;
+    } catch(const std::exception& e) {
+        return std::unexpected("수요 조회 실패: " + std::string(e.what()));
+    }
+}
+
+std::expected<std::vector<AggregatedData>, MeasurementRecorder::Error>
+MeasurementRecorder::queryAggregates(AggregationTier tier, std::chrono::nanoseconds from, std::chrono::nanoseconds to)
+{
+    return queryAggregates(m_sessionId, tier, from, to);
+}
+
+std::expected<std::vector<AggregatedData>, MeasurementRecorder::Error>
+MeasurementRecorder::queryAggregates(SessionId session, AggregationTier tier, std::chrono::nanoseconds from, std::chrono::nanoseconds to)
+{
+    try {
+        std::lock_guard lock(m_readMutex);
+        if(!m_readDb) m_readDb.emplace(m_dbPath);
+
+        std::vector<AggregatedData> records;
+        *m_readDb << "SELECT start_ns, end_ns, cycles, v_a, v_b, v_c, v_ab, v_bc, v_ca,"
+                     " i_a, i_b, i_c, p_a, p_b, p_c, freq, flagged"
+                     " FROM aggregates WHERE session = ? AND tier = ? AND start_ns BETWEEN ? AND ? ORDER BY start_ns;"
+                  << session << static_cast<int>(tier) << static_cast<long long>(from.count()) << static_cast<long long>(to.count())
+            >> [&](long long start, long long end, int cycles,
+                   double va, double vb, double vc,
+                   double vab, double vbc, double vca,
+                   double ia, double ib, double ic,
+                   double pa, double pb, double pc,
+                   double freq, int flagged) {
+                  AggregatedData r;
+                  r.tier = tier;
+                  r.startTime = std::chrono::nanoseconds(start);
+                  r.endTime = std::chrono::nanoseconds(end);
+                  r.cycleCount = cycles;
+                  r.voltageRms = {va, vb, vc};
+                  r.voltageRms_ll = {vab, vbc, vca};
+                  r.currentRms = {ia, ib, ic};
+                  r.activePower = {pa, pb, pc};
+                  r.frequency = freq;
+                  r.flagged = flagged != 0;
+                  records.push_back(r);
+              };
+        return records;
+    } catch(const std::exception& e) {
+        return std::unexpected("집계 구간 조회 실패: " + std::string(e.what()));
+    }
+}
+
+std::expected<std::vector<EventRecord>, MeasurementRecorder::Error>
+MeasurementRecorder::queryEvents(std::chrono::nanoseconds from, std::chrono::nanoseconds to)
+{
+    return queryEvents(m_sessionId, from, to);
+}
+
+std::expected<std::vector<EventRecord>, MeasurementRecorder::Error>
+MeasurementRecorder::queryEvents(SessionId session, std::chrono::nanoseconds from, std::chrono::nanoseconds to)
+{
+    try {
+        std::lock_guard lock(m_readMutex);
+        if(!m_readDb) m_readDb.emplace(m_dbPath);
+
+        std::vector<EventRecord> records;
+        *m_readDb << "SELECT start_ns, duration_ns, type, phase, extreme_value FROM events"
+                     " WHERE session = ? AND start_ns BETWEEN ? AND ? ORDER BY start_ns;"
+                  << session << static_cast<long long>(from.count()) << static_cast<long long>(to.count())
+            >> [&](long long start, long long duration, std::string type, int phase, double extremeValue) {
+                  records.push_back({std::chrono::nanoseconds(start), std::chrono::nanoseconds(duration), std::move(type), phase, extremeValue});
+              };
+        return records;
+    } catch(const std::exception& e) {
+        return std::unexpected("이벤트 조회 실패: " + std::string(e.what()));
+    }
+}
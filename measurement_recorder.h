@@ -0,0 +1,140 @@
+#ifndef MEASUREMENT_RECORDER_H
+#define MEASUREMENT_RECORDER_H
+
+#include <QObject>
+#include <sqlite_modern_cpp.h>
+#include <chrono>
+#include <condition_variable>
+#include <expected>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <thread>
+#include <variant>
+#include <vector>
+#include "measured_data.h"
+#include "demand_data.h"
+#include "aggregation_engine.h"
+
+// 기록 세션 (기록기 생성 시 하나 추가). 시뮬레이션 시간은 실행마다 0부터 시작하므로
+// 모든 시계열 행은 (세션, 시각)으로 구분
+struct SessionRecord {
+    long long id = 0;
+    std::chrono::system_clock::time_point startedAt; // 세션 시작 벽시계 시각
+};
+
+// 저장/조회용 1초 요약 레코드
+struct SummaryRecord {
+    std::chrono::nanoseconds timestamp{0};
+    PhaseData voltageRms;
+    PhaseData currentRms;
+    PhaseData voltageThd;
+    PhaseData currentThd;
+    double totalActivePower = 0.0;
+    double totalReactivePower = 0.0;
+    double totalApparentPower = 0.0;
+    double totalPowerFactor = 0.0;
+    double frequency = 0.0;
+};
+
+// 저장/조회용 수요 레코드 (전체 유효/무효/피상 전력, 상별 전류, 전체 역률)
+struct DemandRecord {
+    std::chrono::nanoseconds timestamp{0};
+    DemandValues activePower;
+    DemandValues reactivePower;
+    DemandValues apparentPower;
+    GenericPhaseData<DemandValues> current;
+    DemandValues powerFactor;
+};
+
+// 저장/조회용 이벤트 레코드
+struct EventRecord {
+    std::chrono::nanoseconds startTime{0};
+    std::chrono::nanoseconds duration{0};
+    std::string type;   // "dip", "swell", "interruption" 등
+    int phase = -1;     // 0=A, 1=B, 2=C, 3=AB, 4=BC, 5=CA, -1=다상
+    double extremeValue = 0.0; // 잔류 전압(dip/interruption) 또는 최대 전압(swell)
+};
+
+// MeasurementRecorder 클래스
+// 1초 요약, 수요 레지스터, IEC 61000-4-30 집계 구간, 이벤트를 SQLite 시계열 스키마에 기록.
+// 인스턴스마다 새 세션을 만들어 그 세션 ID로 기록하므로 이전 실행의 행을 덮어쓰지 않음.
+// record* 함수는 큐에 넣기만 하고 즉시 반환하며(어느 스레드에서든 호출 가능),
+// 전용 기록 스레드가 준비된 구문과 N행 단위 트랜잭션으로 WAL 모드 DB에 씀.
+// 조회는 별도 읽기 연결을 사용하므로 기록과 동시에 수행 가능 (WAL).
+class MeasurementRecorder : public QObject
+{
+    Q_OBJECT
+public:
+    using Error = std::string;
+    using SessionId = long long;
+
+    // 스키마 생성, 세션 추가 후 기록 스레드 시작. DB 열기 실패 시 std::runtime_error
+    explicit MeasurementRecorder(std::string_view dbPath, QObject* parent = nullptr);
+    ~MeasurementRecorder();
+
+    // 이 기록기가 쓰는 세션
+    SessionId sessionId() const;
+
+    // 기록된 모든 세션 (오래된 순)
+    std::expected<std::vector<SessionRecord>, Error> querySessions();
+
+    // 세션 내 시간 범위 조회 [from, to]. (세션, 시각) 인덱스를 사용. 세션을 생략하면 현재 세션
+    std::expected<std::vector<SummaryRecord>, Error> querySummaries(std::chrono::nanoseconds from, std::chrono::nanoseconds to);
+    std::expected<std::vector<SummaryRecord>, Error> querySummaries(SessionId session, std::chrono::nanoseconds from, std::chrono::nanoseconds to);
+    std::expected<std::vector<DemandRecord>, Error> queryDemand(std::chrono::nanoseconds from, std::chrono::nanoseconds to);
+    std::expected<std::vector<DemandRecord>, Error> queryDemand(SessionId session, std::chrono::nanoseconds from, std::chrono::nanoseconds to);
+    std::expected<std::vector<AggregatedData>, Error> queryAggregates(AggregationTier tier, std::chrono::nanoseconds from, std::chrono::nanoseconds to);
+    std::expected<std::vector<AggregatedData>, Error> queryAggregates(SessionId session, AggregationTier tier, std::chrono::nanoseconds from, std::chrono::nanoseconds to);
+    std::expected<std::vector<EventRecord>, Error> queryEvents(std::chrono::nanoseconds from, std::chrono::nanoseconds to);
+    std::expected<std::vector<EventRecord>, Error> queryEvents(SessionId session, std::chrono::nanoseconds from, std::chrono::nanoseconds to);
+
+    // 큐에 쌓인 행을 모두 기록할 때까지 대기 (종료, 테스트용)
+    void flush();
+
+    // 큐가 가득 차서 버려진 행 수
+    size_t droppedCount() const;
+
+public slots:
+    void recordSummary(const OneSecondSummarySnapshot& snapshot);
+    void recordDemand(const DemandData& data);
+    // 150/180 사이클 이상 단계만 기록 (10/12 사이클 기본 구간은 상위 단계의 재료일 뿐이므로 제외)
+    void recordAggregate(const AggregatedData& data);
+    void recordEvent(const EventRecord& event);
+
+signals:
+    void errorOccurred(const QString& message);
+
+private:
+    using PendingRow = std::variant<OneSecondSummarySnapshot, DemandRecord, AggregatedData, EventRecord>;
+    struct PreparedStatements; // 기록 스레드 전용 INSERT 구문
+
+    void enqueue(PendingRow&& row);
+    void writerLoop();
+    void writeBatch(std::vector<PendingRow>& batch);
+    PreparedStatements& statements(); // 준비된 구문 (없으면 준비, 기록 스레드 전용)
+    void discardStatements();         // 실패한 배치 뒤 구문을 버림
+    void createSchema();
+    void beginSession();
+
+    std::string m_dbPath;
+    sqlite::database m_writeDb;
+    SessionId m_sessionId;
+    std::unique_ptr<PreparedStatements> m_statements; // 한 번 준비하고 재사용하는 구문 (실패 후에는 버리고 다시 준비)
+    std::optional<sqlite::database> m_readDb; // 첫 조회 시 생성
+    std::mutex m_readMutex;
+
+    // 기록 대기 큐
+    mutable std::mutex m_queueMutex;
+    std::condition_variable m_queueCondition;
+    std::condition_variable m_flushedCondition;
+    std::vector<PendingRow> m_pending;
+    size_t m_inFlight;      // 기록 스레드가 처리 중인 행 수
+    size_t m_droppedCount;
+    bool m_flushRequested;
+    bool m_stopRequested;
+
+    std::thread m_writerThread;
+};
+
+#endif // MEASUREMENT_RECORDER_H
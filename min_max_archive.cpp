@@ -0,0 +1,62 @@
+#include "min_max_archive.h"
+#include <algorithm>
+#include <cmath>
+
+MinMaxArchive::MinMaxArchive(std::chrono::nanoseconds interval, size_t capacity)
+    : m_interval(std::max(interval, std::chrono::nanoseconds(1)))
+    , m_ring(std::max<size_t>(capacity, 1))
+    , m_head(0)
+    , m_filled(0)
+{}
+
+void MinMaxArchive::update(double value, std::chrono::nanoseconds timestamp)
+{
+    if(std::isnan(value)) return;
+
+    // 값이 속한 구간의 시작 시각
+    const auto startTime = (timestamp / m_interval) * m_interval;
+
+    if(m_current.count > 0 && startTime != m_current.startTime) {
+        // 구간 변경: 진행 중 버킷을 링에 넣고 새 버킷 시작
+        m_ring[m_head] = m_current;
+        m_head = (m_head + 1) % m_ring.size();
+        m_filled = std::min(m_filled + 1, m_ring.size());
+        m_current = MinMaxBucket{};
+    }
+
+    if(m_current.count == 0) {
+        m_current.startTime = startTime;
+    }
+
+    m_current.min = std::min(m_current.min, value);
+    m_current.max = std::max(m_current.max, value);
+    m_current.sum += value;
+    ++m_current.count;
+}
+
+std::vector<MinMaxBucket> MinMaxArchive::lastIntervals(size_t n) const
+{
+    n = std::min(n, m_filled);
+
+    std::vector<MinMaxBucket> result;
+    result.reserve(n);
+
+    // 가장 최근 슬롯은 m_head - 1. n개 앞에서부터 순서대로 복사
+    const size_t size = m_ring.size();
+    for(size_t i = n; i > 0; --i) {
+        result.push_back(m_ring[(m_head + size - i) % size]);
+    }
+    return result;
+}
+
+const MinMaxBucket& MinMaxArchive::currentBucket() const { return m_current; }
+size_t MinMaxArchive::completedCount() const { return m_filled; }
+size_t MinMaxArchive::capacity() const { return m_ring.size(); }
+std::chrono::nanoseconds MinMaxArchive::interval() const { return m_interval; }
+
+void MinMaxArchive::reset()
+{
+    m_head = 0;
+    m_filled = 0;
+    m_current = MinMaxBucket{};
+}
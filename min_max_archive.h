@@ -0,0 +1,53 @@
+#ifndef MIN_MAX_ARCHIVE_H
+#define MIN_MAX_ARCHIVE_H
+
+#include <chrono>
+#include <cstddef>
+#include <limits>
+#include <vector>
+
+// 한 구간(시간/일)의 min/max/평균
+struct MinMaxBucket {
+    std::chrono::nanoseconds startTime{0}; // 구간 시작 시각 (구간 길이의 정수배로 정렬)
+    double min = std::numeric_limits<double>::max();
+    double max = std::numeric_limits<double>::lowest();
+    double sum = 0.0;
+    size_t count = 0;
+
+    double average() const {
+        return count > 0 ? sum / static_cast<double>(count) : std::numeric_limits<double>::quiet_NaN();
+    }
+};
+
+// MinMaxArchive 클래스
+// 1초 값을 고정 길이 구간 버킷으로 누적하고, 완료된 버킷을 고정 크기 링 버퍼에 보관.
+// 구간이 바뀌면 가장 오래된 슬롯을 덮어쓰므로 롤오버는 O(1)이며 할당이 없음.
+class MinMaxArchive
+{
+public:
+    MinMaxArchive(std::chrono::nanoseconds interval, size_t capacity);
+
+    // 값 입력 (NaN은 무시). timestamp는 시뮬레이션 시간
+    void update(double value, std::chrono::nanoseconds timestamp);
+
+    // 완료된 최근 N개 구간 (오래된 것 -> 최신 순)
+    std::vector<MinMaxBucket> lastIntervals(size_t n) const;
+
+    // 진행 중인 구간 (아직 값이 없으면 count == 0)
+    const MinMaxBucket& currentBucket() const;
+
+    size_t completedCount() const;
+    size_t capacity() const;
+    std::chrono::nanoseconds interval() const;
+    void reset();
+
+private:
+    std::chrono::nanoseconds m_interval;
+    std::vector<MinMaxBucket> m_ring;
+    size_t m_head;   // 다음에 기록할 슬롯
+    size_t m_filled; // 채워진 슬롯 수
+
+    MinMaxBucket m_current;
+};
+
+#endif // MIN_MAX_ARCHIVE_H
@@ -0,0 +1,151 @@
+#include "min_max_pyramid.h"
+
+namespace {
+    constexpr uint64_t MinLevelMask = (uint64_t{1} << MinMaxPyramid::MinLevel) - 1;
+}
+
+MinMaxPyramid::MinMaxPyramid()
+    : m_beginIndex(0)
+    , m_endIndex(0)
+{}
+
+MinMaxPyramid::ChannelValues MinMaxPyramid::channelValues(const DataPoint& p)
+{
+    return {p.voltage.a, p.voltage.b, p.voltage.c, p.current.a, p.current.b, p.current.c};
+}
+
+void MinMaxPyramid::append(const DataPoint& p)
+{
+    const ChannelValues values = channelValues(p);
+    const uint64_t index = m_endIndex++;
+
+    addToLevel(m_levels[MinLevel], index >> MinLevel, {values, values});
+
+    // MinLevel 버킷이 끝났을 때만 상위 레벨에 병합 (상위 레벨은 완료된 MinLevel 버킷까지만 포함)
+    if(((index + 1) & MinLevelMask) == 0) {
+        const Bucket completed = m_levels[MinLevel].buckets.back();
+        for(int k{MinLevel + 1}; k <= MaxLevel; ++k) {
+            addToLevel(m_levels[k], index >> k, completed);
+        }
+    }
+}
+
+void MinMaxPyramid::trimFront(uint64_t firstIndex)
+{
+    firstIndex = std::min(firstIndex, m_endIndex);
+    if(firstIndex <= m_beginIndex) return;
+    m_beginIndex = firstIndex;
+
+    for(int k{MinLevel}; k <= MaxLevel; ++k) {
+        Level& level = m_levels[k];
+        // 버킷의 마지막 샘플까지 모두 제거된 경우에만 삭제
+        while(!level.buckets.empty() && ((level.startBucket + 1) << k) <= firstIndex) {
+            level.buckets.pop_front();
+            ++level.startBucket;
+        }
+    }
+}
+
+void MinMaxPyramid::clear()
+{
+    for(auto& level : m_levels) {
+        level.buckets.clear();
+        level.startBucket = 0;
+    }
+    m_beginIndex = 0;
+    m_endIndex = 0;
+}
+
+uint64_t MinMaxPyramid::beginIndex() const { return m_beginIndex; }
+uint64_t MinMaxPyramid::endIndex() const { return m_endIndex; }
+
+size_t MinMaxPyramid::bucketCount() const
+{
+    size_t count = 0;
+    for(const auto& level : m_levels) {
+        count += level.buckets.size();
+    }
+    return count;
+}
+
+void MinMaxPyramid::envelope(uint64_t first, uint64_t last, size_t maxBuckets, std::vector<EnvelopeBucket>& out) const
+{
+    out.clear();
+    first = std::max(first, m_beginIndex);
+    last = std::min(last, m_endIndex);
+    if(first >= last || maxBuckets == 0) return;
+
+    envelopeFromLevel(std::max(levelFor(first, last, maxBuckets), MinLevel), first, last, out);
+}
+
+// ---- private ----
+int MinMaxPyramid::levelFor(uint64_t first, uint64_t last, size_t maxBuckets)
+{
+    const uint64_t count = last - first;
+    const uint64_t samplesPerBucket = (count + maxBuckets - 1) / maxBuckets;
+    int k = std::min(static_cast<int>(std::bit_width(samplesPerBucket - 1)), MaxLevel);
+    // 버킷 경계 정렬 때문에 한 칸 넘칠 수 있으면 한 단계 위로
+    while(k < MaxLevel && ((last - 1) >> k) - (first >> k) + 1 > maxBuckets) {
+        ++k;
+    }
+    return k;
+}
+
+void MinMaxPyramid::merge(Bucket& into, const Bucket& from)
+{
+    for(size_t ch = 0; ch < ChannelCount; ++ch) {
+        into.min[ch] = std::min(into.min[ch], from.min[ch]);
+        into.max[ch] = std::max(into.max[ch], from.max[ch]);
+    }
+}
+
+void MinMaxPyramid::addToLevel(Level& level, uint64_t bucketIndex, const Bucket& bucket)
+{
+    if(level.buckets.empty()) {
+        level.startBucket = bucketIndex;
+    } else if(bucketIndex == level.startBucket + level.buckets.size() - 1) {
+        merge(level.buckets.back(), bucket);
+        return;
+    }
+    level.buckets.push_back(bucket); // 새 버킷 시작
+}
+
+void MinMaxPyramid::envelopeFromLevel(int k, uint64_t first, uint64_t last, std::vector<EnvelopeBucket>& out) const
+{
+    const Level& level = m_levels[k];
+    const Level& finest = m_levels[MinLevel];
+
+    // 상위 레벨의 마지막 버킷에는 아직 끝나지 않은 MinLevel 버킷이 빠져 있으므로 조회 시 합침
+    const bool hasPartial = k > MinLevel && (m_endIndex & MinLevelMask) != 0 && !finest.buckets.empty();
+    const uint64_t currentBucket = (m_endIndex - 1) >> k;
+    const uint64_t levelEnd = level.startBucket + level.buckets.size();
+
+    const uint64_t firstBucket = first >> k;
+    const uint64_t lastBucket = (last - 1) >> k;
+    out.reserve(lastBucket - firstBucket + 1);
+
+    for(uint64_t b = firstBucket; b <= lastBucket; ++b) {
+        Bucket bucket;
+        bool hasBucket = false;
+        if(b >= level.startBucket && b < levelEnd) {
+            bucket = level.buckets[b - level.startBucket];
+            hasBucket = true;
+        }
+        if(hasPartial && b == currentBucket) {
+            if(hasBucket) {
+                merge(bucket, finest.buckets.back());
+            } else {
+                bucket = finest.buckets.back();
+                hasBucket = true;
+            }
+        }
+        if(!hasBucket) continue;
+
+        EnvelopeBucket e;
+        e.firstIndex = std::max(b << k, first);
+        e.lastIndex = std::min(((b + 1) << k) - 1, last - 1);
+        e.min = bucket.min;
+        e.max = bucket.max;
+        out.push_back(e);
+    }
+}
@@ -0,0 +1,114 @@
+#ifndef MIN_MAX_PYRAMID_H
+#define MIN_MAX_PYRAMID_H
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cstdint>
+#include <deque>
+#include <vector>
+#include "config.h"
+#include "data_point.h"
+
+// MinMaxPyramid 클래스
+// 샘플 이력과 나란히 유지되는 다중 해상도 min/max 피라미드.
+// 레벨 k의 버킷 하나는 절대 인덱스 [b*2^k, (b+1)*2^k) 구간의 샘플을 요약함.
+//  - 가장 세밀한 레벨은 MinLevel(버킷당 32샘플)이라 전체 레벨 합이 샘플당 약 6바이트 (이력보다 작음).
+//    그보다 확대된 구간은 조회 시 원본 샘플에서 직접 요약 (구간이 2^MinLevel * 버킷 수 미만이므로 O(pixels))
+//  - 샘플 추가는 MinLevel 버킷만 갱신하고, MinLevel 버킷이 끝날 때 상위 레벨에 병합 (샘플당 분할 상환 O(1))
+//  - 가장 거친 레벨은 최대 이력 길이를 MinEnvelopeBuckets개 버킷으로 그릴 수 있는 정도까지만 유지
+// 임의 구간의 엔벨로프 조회는 출력 버킷 수만큼 O(pixels).
+class MinMaxPyramid
+{
+public:
+    // 채널 순서: Va, Vb, Vc, Ia, Ib, Ic
+    static constexpr size_t ChannelCount = 6;
+    static constexpr int MinLevel = 5;                // 버킷당 32샘플
+    static constexpr size_t MinEnvelopeBuckets = 64;  // 가장 좁은 그래프(약 128픽셀)의 버킷 수
+    static constexpr int MaxLevel = std::bit_width(static_cast<uint64_t>(config::Simulation::DataSize::MaxDataSize - 1) / MinEnvelopeBuckets);
+
+    using ChannelValues = std::array<double, ChannelCount>;
+
+    struct Bucket {
+        ChannelValues min;
+        ChannelValues max;
+    };
+
+    // 엔벨로프 조회 결과 한 칸
+    struct EnvelopeBucket {
+        uint64_t firstIndex = 0; // 버킷의 첫 샘플 절대 인덱스 (조회 구간으로 잘림)
+        uint64_t lastIndex = 0;  // 버킷의 마지막 샘플 절대 인덱스 (포함)
+        ChannelValues min;
+        ChannelValues max;
+    };
+
+    MinMaxPyramid();
+
+    static ChannelValues channelValues(const DataPoint& p);
+
+    void append(const DataPoint& p);
+
+    // firstIndex 이전 샘플이 제거되었음을 반영 (완전히 지난 버킷만 삭제)
+    void trimFront(uint64_t firstIndex);
+    void clear();
+
+    // 보관 중인 샘플의 절대 인덱스 범위 [begin, end)
+    uint64_t beginIndex() const;
+    uint64_t endIndex() const;
+    size_t bucketCount() const; // 모든 레벨의 버킷 수 (메모리 사용량 확인용)
+
+    // [first, last) 구간을 maxBuckets개 이하의 버킷으로 요약 (MinLevel보다 세밀하게는 나누지 않음).
+    // 구간 양 끝 버킷은 구간 밖 샘플을 일부 포함할 수 있음.
+    // 구간이 MinEnvelopeBuckets개보다 적은 버킷을 요구하면 maxBuckets를 넘을 수 있음
+    void envelope(uint64_t first, uint64_t last, size_t maxBuckets, std::vector<EnvelopeBucket>& out) const;
+
+    // 위와 같지만 MinLevel보다 세밀한 버킷이 필요하면 sampleAt(절대 인덱스) -> DataPoint로 원본을 직접 요약
+    template<typename SampleAt>
+    void envelope(uint64_t first, uint64_t last, size_t maxBuckets, std::vector<EnvelopeBucket>& out, SampleAt&& sampleAt) const
+    {
+        out.clear();
+        first = std::max(first, m_beginIndex);
+        last = std::min(last, m_endIndex);
+        if(first >= last || maxBuckets == 0) return;
+
+        const int k = levelFor(first, last, maxBuckets);
+        if(k >= MinLevel) {
+            envelopeFromLevel(k, first, last, out);
+            return;
+        }
+
+        out.reserve((((last - 1) >> k) - (first >> k)) + 1);
+        for(uint64_t b = first >> k; b <= ((last - 1) >> k); ++b) {
+            EnvelopeBucket e;
+            e.firstIndex = std::max(b << k, first);
+            e.lastIndex = std::min(((b + 1) << k) - 1, last - 1);
+            e.min = e.max = channelValues(sampleAt(e.firstIndex));
+            for(uint64_t i = e.firstIndex + 1; i <= e.lastIndex; ++i) {
+                const ChannelValues values = channelValues(sampleAt(i));
+                for(size_t ch = 0; ch < ChannelCount; ++ch) {
+                    e.min[ch] = std::min(e.min[ch], values[ch]);
+                    e.max[ch] = std::max(e.max[ch], values[ch]);
+                }
+            }
+            out.push_back(e);
+        }
+    }
+
+private:
+    struct Level {
+        std::deque<Bucket> buckets;
+        uint64_t startBucket = 0; // buckets.front()의 버킷 번호
+    };
+
+    // 버킷 수가 maxBuckets 이하가 되는 가장 세밀한 레벨 (0 ~ MaxLevel, MinLevel 미만이면 원본 필요)
+    static int levelFor(uint64_t first, uint64_t last, size_t maxBuckets);
+    static void merge(Bucket& into, const Bucket& from);
+    static void addToLevel(Level& level, uint64_t bucketIndex, const Bucket& bucket);
+    void envelopeFromLevel(int k, uint64_t first, uint64_t last, std::vector<EnvelopeBucket>& out) const;
+
+    std::array<Level, MaxLevel + 1> m_levels; // MinLevel 미만은 사용하지 않음
+    uint64_t m_beginIndex;
+    uint64_t m_endIndex;
+};
+
+#endif // MIN_MAX_PYRAMID_H
@@ -1,16 +1,24 @@
 #ifndef MIN_MAX_TRACKER_H
 #define MIN_MAX_TRACKER_H
 
-#include <QDateTime>
+#include <chrono>
 #include <limits>
 
+// 추적기 타임스탬프: 시뮬레이션 시간 (int64 ns)
+using TrackerTimestamp = std::chrono::nanoseconds;
+
 template<typename T>
 struct ValueWithTimestamp {
+    static constexpr TrackerTimestamp NoTimestamp = TrackerTimestamp::min();
+
     T value;
-    QDateTime timestamp;
+    TrackerTimestamp timestamp = NoTimestamp;
 
     ValueWithTimestamp(T v) : value(v) {}
     ValueWithTimestamp() : value(std::numeric_limits<T>::quiet_NaN()) {}
+
+    // 한 번이라도 갱신되었는지 여부
+    bool hasTimestamp() const { return timestamp != NoTimestamp; }
 };
 
 // 최소값 추적
@@ -18,7 +26,7 @@ template <typename T>
 struct MinTracker : public ValueWithTimestamp<T> {
     MinTracker() : ValueWithTimestamp<T>(std::numeric_limits<T>::max()) {}
 
-    void update(const T& newValue, const QDateTime& newTimestamp) {
+    void update(const T& newValue, TrackerTimestamp newTimestamp) {
         if(newValue < this->value) {
             this->value = newValue;
             this->timestamp = newTimestamp;
@@ -31,7 +39,7 @@ template <typename T>
 struct MaxTracker : public ValueWithTimestamp<T> {
     MaxTracker() : ValueWithTimestamp<T>(std::numeric_limits<T>::lowest()) {}
 
-    void update(const T& newValue, const QDateTime& newTimestamp) {
+    void update(const T& newValue, TrackerTimestamp newTimestamp) {
         if(newValue > this->value) {
             this->value = newValue;
             this->timestamp = newTimestamp;
@@ -44,7 +52,7 @@ struct MinMaxTracker {
     MinTracker<T> min;
     MaxTracker<T> max;
 
-    void update(const T& newValue, const QDateTime& newTimestamp) {
+    void update(const T& newValue, TrackerTimestamp newTimestamp) {
         min.update(newValue, newTimestamp);
         max.update(newValue, newTimestamp);
     }
@@ -0,0 +1,227 @@
+#include "one_second_accumulator.h"
+#include "analysis_utils.h"
+#include "config.h"
+#include <algorithm>
+#include <cmath>
+#include <complex>
+#include <limits>
+
+namespace {
+    std::complex<double> sumPhasor(const GenericPhaseData<HarmonicAnalysisResult>& phasePhasors) {
+        return phasePhasors.a.phasor + phasePhasors.b.phasor + phasePhasors.c.phasor;
+    }
+
+    // 차수별 제곱합 버퍼에 누적 (차수 범위를 넘으면 한 번만 확장)
+    void accumulateDominant(std::vector<double>& sumSqByOrder, const HarmonicAnalysisResult& dominant) {
+        if(dominant.order <= 1) return;
+        const size_t order = static_cast<size_t>(dominant.order);
+        if(order >= sumSqByOrder.size()) {
+            sumSqByOrder.resize(order + 1, 0.0);
+        }
+        sumSqByOrder[order] += dominant.rms * dominant.rms;
+    }
+
+    double dominantSumSq(const std::vector<double>& sumSqByOrder, int order) {
+        if(order <= 1 || static_cast<size_t>(order) >= sumSqByOrder.size()) return 0.0;
+        return sumSqByOrder[order];
+    }
+
+    // THD (THD = harmonicRMS / fundamentalRMS)
+    double calculateThd(double totalRms, double fundamentalRms) {
+        if(fundamentalRms > 1e-9) {
+            const double harmonicRmsSq = (totalRms * totalRms) - (fundamentalRms * fundamentalRms);
+            return (harmonicRmsSq > 1e-9) ? (std::sqrt(harmonicRmsSq) / fundamentalRms) * 100.0 : 0.0;
+        }
+        // 기본파가 0이라면 THD 값은 의미 없음
+        return (totalRms > 1e-9) ? std::numeric_limits<double>::infinity() : 0.0;
+    }
+
+    double calculateNemaUnbalance(const PhaseData& rms) {
+        const double avg = (rms.a + rms.b + rms.c) / 3.0;
+        if(avg < 1e-9) return 0.0;
+        const double max_dev = std::max({std::abs(rms.a - avg),
+                                         std::abs(rms.b - avg),
+                                         std::abs(rms.c - avg)});
+        return (max_dev / avg) * 100.0;
+    }
+    double calculateNemaUnbalance(const LineToLineData& rms) {
+        const double avg = (rms.ab + rms.bc + rms.ca) / 3.0;
+        if(avg < 1e-9) return 0.0;
+        const double max_dev = std::max({std::abs(rms.ab - avg),
+                                         std::abs(rms.bc - avg),
+                                         std::abs(rms.ca - avg)});
+        return (max_dev / avg) * 100.0;
+    }
+
+    void calculateSymUnbalance(const SymmetricalComponents& sym, double& u0, double& u2) {
+        if(sym.positive.magnitude > 1e-9) {
+            u0 = (sym.zero.magnitude / sym.positive.magnitude) * 100.0;
+            u2 = (sym.negative.magnitude / sym.positive.magnitude) * 100.0;
+        } else {
+            u0 = (sym.zero.magnitude > 1e-9) ? std::numeric_limits<double>::infinity() : 0.0;
+            u2 = (sym.negative.magnitude > 1e-9) ? std::numeric_limits<double>::infinity() : 0.0;
+        }
+    }
+}
+
+void OneSecondAccumulator::add(const MeasuredData& data)
+{
+    auto accumulatePhase = [&](int index, double v_rms, double v_ll_rms, double i_rms, double p_active, const auto& fv, const auto& fv_ll, const auto& fi) {
+        m_totalVoltageRmsSumSq[index] += v_rms * v_rms;
+        m_totalVoltageRmsSumSq_ll[index] += v_ll_rms * v_ll_rms;
+        m_totalCurrentRmsSumSq[index] += i_rms * i_rms;
+        m_activePowerSum[index] += p_active;
+        m_fundVoltageRmsSumSq[index] += fv.rms * fv.rms;
+        m_fundVoltageRmsSumSq_ll[index] += fv_ll.rms * fv_ll.rms;
+        m_fundCurrentRmsSumSq[index] += fi.rms * fi.rms;
+    };
+
+    accumulatePhase(0, data.voltageRms.a, data.voltageRms_ll.ab, data.currentRms.a, data.activePower.a, data.fundamentalVoltage.a, data.fundamentalVoltage_ll.ab, data.fundamentalCurrent.a);
+    accumulatePhase(1, data.voltageRms.b, data.voltageRms_ll.bc, data.currentRms.b, data.activePower.b, data.fundamentalVoltage.b, data.fundamentalVoltage_ll.bc, data.fundamentalCurrent.b);
+    accumulatePhase(2, data.voltageRms.c, data.voltageRms_ll.ca, data.currentRms.c, data.activePower.c, data.fundamentalVoltage.c, data.fundamentalVoltage_ll.ca, data.fundamentalCurrent.c);
+
+    m_fundReactivePowerSum[0] += data.power.phase.a.q1;
+    m_fundReactivePowerSum[1] += data.power.phase.b.q1;
+    m_fundReactivePowerSum[2] += data.power.phase.c.q1;
+
+    m_residualVoltageRmsSum += data.residualVoltageRms;
+    m_residualCurrentRmsSum += data.residualCurrentRms;
+
+    // 복소수 합의 절대값 계산 (잔류 기본파)
+    m_residualVoltageFundamentalSum += std::abs(sumPhasor(data.fundamentalVoltage));
+    m_residualCurrentFundamentalSum += std::abs(sumPhasor(data.fundamentalCurrent));
+
+    accumulateDominant(m_dominantVoltageRmsSumSqByOrder, data.dominantVoltage.a);
+    accumulateDominant(m_dominantCurrentRmsSumSqByOrder, data.dominantCurrent.a);
+
+    m_previousTimestamp = m_lastTimestamp;
+    m_lastTimestamp = data.timestamp;
+    ++m_count;
+}
+
+OneSecondSummaryData OneSecondAccumulator::finalize(const MeasuredData& lastCycleData) const
+{
+    if(m_count == 0) {
+        return {};
+    }
+
+    OneSecondSummaryData summary{};
+    const double N = static_cast<double>(m_count);
+
+    // 1. 기본 정보 설정
+    summary.timestamp = lastCycleData.timestamp;
+    summary.dominantHarmonicVoltageOrder = lastCycleData.dominantVoltage.a.order;
+    summary.dominantHarmonicCurrentOrder = lastCycleData.dominantCurrent.a.order;
+    summary.dominantHarmonicVoltagePhase = utils::radiansToDegrees(lastCycleData.dominantVoltage.a.phase);
+    summary.dominantHarmonicCurrentPhase = utils::radiansToDegrees(lastCycleData.dominantCurrent.a.phase);
+    summary.fundamentalVoltage = lastCycleData.fundamentalVoltage;
+    summary.fundamentalVoltage_ll = lastCycleData.fundamentalVoltage_ll;
+    summary.fundamentalCurrent = lastCycleData.fundamentalCurrent;
+
+    // 2. 위상별 계산 (RMS, Power, THD)
+    std::array<double, 3> voltageRms, voltageRms_ll, currentRms, pActive, apparent, reactive, powerFactor;
+    std::array<double, 3> voltageThd, voltageThd_ll, currentThd;
+
+    for(int i{0}; i < 3; ++i) {
+        voltageRms[i] = std::sqrt(m_totalVoltageRmsSumSq[i] / N);
+        voltageRms_ll[i] = std::sqrt(m_totalVoltageRmsSumSq_ll[i] / N);
+        currentRms[i] = std::sqrt(m_totalCurrentRmsSumSq[i] / N);
+        pActive[i] = m_activePowerSum[i] / N;
+
+        apparent[i] = voltageRms[i] * currentRms[i];
+        powerFactor[i] = (apparent[i] > 1e-9) ? std::abs(pActive[i] / apparent[i]) : 0.0;
+
+        // 무효 전력: 기본파 무효 전력 Q1 (IEEE 1459). sqrt(S² - P²)는 왜곡 전력까지 포함하므로 쓰지 않음
+        reactive[i] = m_fundReactivePowerSum[i] / N;
+
+        voltageThd[i] = calculateThd(voltageRms[i], std::sqrt(m_fundVoltageRmsSumSq[i] / N));
+        voltageThd_ll[i] = calculateThd(voltageRms_ll[i], std::sqrt(m_fundVoltageRmsSumSq_ll[i] / N));
+        currentThd[i] = calculateThd(currentRms[i], std::sqrt(m_fundCurrentRmsSumSq[i] / N));
+    }
+
+    summary.totalVoltageRms = {voltageRms[0], voltageRms[1], voltageRms[2]};
+    summary.totalVoltageRms_ll = {voltageRms_ll[0], voltageRms_ll[1], voltageRms_ll[2]};
+    summary.totalCurrentRms = {currentRms[0], currentRms[1], currentRms[2]};
+    summary.activePower = {pActive[0], pActive[1], pActive[2]};
+    summary.apparentPower = {apparent[0], apparent[1], apparent[2]};
+    summary.powerFactor = {powerFactor[0], powerFactor[1], powerFactor[2]};
+    summary.voltageThd = {voltageThd[0], voltageThd[1], voltageThd[2]};
+    summary.voltageThd_ll = {voltageThd_ll[0], voltageThd_ll[1], voltageThd_ll[2]};
+    summary.currentThd = {currentThd[0], currentThd[1], currentThd[2]};
+    summary.reactivePower = {reactive[0], reactive[1], reactive[2]};
+
+    // 3. 전체 지표 계산 (Total Power, Frequency, Residual)
+    summary.totalActivePower = summary.activePower.a + summary.activePower.b + summary.activePower.c;
+    summary.totalApparentPower = summary.apparentPower.a + summary.apparentPower.b + summary.apparentPower.c;
+    summary.totalReactivePower = summary.reactivePower.a + summary.reactivePower.b + summary.reactivePower.c;
+    summary.totalPowerFactor = (summary.totalApparentPower > 1e-6) ? std::abs(summary.totalActivePower) / summary.totalApparentPower : 0.0;
+
+    // 주파수 계산 (2사이클 필요)
+    if(m_count >= 2) {
+        const double duration = std::chrono::duration<double>(m_lastTimestamp - m_previousTimestamp).count();
+        summary.frequency = (duration > 0.0) ? lastCycleData.fundamentalVoltage.a.order * (1.0 / duration) : 0.0;
+    } else {
+        summary.frequency = 0.0;
+    }
+
+    summary.residualVoltageRms = m_residualVoltageRmsSum / N;
+    summary.residualCurrentRms = m_residualCurrentRmsSum / N;
+    summary.residualVoltageFundamental = m_residualVoltageFundamentalSum / N;
+    summary.residualCurrentFundamental = m_residualCurrentFundamentalSum / N;
+
+    summary.dominantHarmonicVoltageRms = std::sqrt(dominantSumSq(m_dominantVoltageRmsSumSqByOrder, summary.dominantHarmonicVoltageOrder) / N);
+    summary.dominantHarmonicCurrentRms = std::sqrt(dominantSumSq(m_dominantCurrentRmsSumSqByOrder, summary.dominantHarmonicCurrentOrder) / N);
+
+    // 4. 불평형률 계산 (NEMA)
+    summary.nemaVoltageUnbalance = calculateNemaUnbalance(summary.totalVoltageRms);
+    summary.nemaVoltageUnbalance_ll = calculateNemaUnbalance(summary.totalVoltageRms_ll);
+    summary.nemaCurrentUnbalance = calculateNemaUnbalance(summary.totalCurrentRms);
+
+    // 5. 대칭 성분 및 불평형률 (U0, U2)
+    const auto& LN_voltageData = lastCycleData.fundamentalVoltage;
+    const auto& LL_voltageData = lastCycleData.fundamentalVoltage_ll;
+    const auto& currentData = lastCycleData.fundamentalCurrent;
+
+    summary.voltageSymmetricalComponents = AnalysisUtils::calculateSymmetricalComponents(LN_voltageData.a, LN_voltageData.b, LN_voltageData.c);
+    summary.currentSymmetricalComponents = AnalysisUtils::calculateSymmetricalComponents(currentData.a, currentData.b, currentData.c);
+    auto sym_ll_temp = AnalysisUtils::calculateSymmetricalComponents(LL_voltageData.ab, LL_voltageData.bc, LL_voltageData.ca);
+    summary.voltageSymmetricalComponents_ll.positive = sym_ll_temp.positive;
+    summary.voltageSymmetricalComponents_ll.negative = sym_ll_temp.negative;
+
+    calculateSymUnbalance(summary.voltageSymmetricalComponents, summary.voltageU0Unbalance, summary.voltageU2Unbalance);
+    calculateSymUnbalance(summary.currentSymmetricalComponents, summary.currentU0Unbalance, summary.currentU2Unbalance);
+
+    // 6. 마지막 사이클 고조파 정보 복사
+    summary.lastCycleVoltageHarmonics = lastCycleData.voltageHarmonics;
+    summary.lastCycleCurrentHarmonics = lastCycleData.currentHarmonics;
+
+    summary.lastCycleFullVoltageHarmonics = lastCycleData.fullVoltageHarmonics;
+    summary.lastCycleFullCurrentHarmonics = lastCycleData.fullCurrentHarmonics;
+
+    return summary;
+}
+
+void OneSecondAccumulator::reset()
+{
+    m_totalVoltageRmsSumSq.fill(0.0);
+    m_totalCurrentRmsSumSq.fill(0.0);
+    m_totalVoltageRmsSumSq_ll.fill(0.0);
+    m_activePowerSum.fill(0.0);
+    m_fundReactivePowerSum.fill(0.0);
+    m_fundVoltageRmsSumSq.fill(0.0);
+    m_fundCurrentRmsSumSq.fill(0.0);
+    m_fundVoltageRmsSumSq_ll.fill(0.0);
+    m_residualVoltageRmsSum = 0.0;
+    m_residualCurrentRmsSum = 0.0;
+    m_residualVoltageFundamentalSum = 0.0;
+    m_residualCurrentFundamentalSum = 0.0;
+
+    std::fill(m_dominantVoltageRmsSumSqByOrder.begin(), m_dominantVoltageRmsSumSqByOrder.end(), 0.0);
+    std::fill(m_dominantCurrentRmsSumSqByOrder.begin(), m_dominantCurrentRmsSumSqByOrder.end(), 0.0);
+
+    m_lastTimestamp = std::chrono::nanoseconds{0};
+    m_previousTimestamp = std::chrono::nanoseconds{0};
+    m_count = 0;
+}
+
+size_t OneSecondAccumulator::count() const { return m_count; }
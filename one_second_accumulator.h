@@ -0,0 +1,54 @@
+#ifndef ONE_SECOND_ACCUMULATOR_H
+#define ONE_SECOND_ACCUMULATOR_H
+
+#include "measured_data.h"
+#include <array>
+#include <chrono>
+#include <vector>
+
+// OneSecondAccumulator 클래스
+// 사이클 단위 MeasuredData를 복사하지 않고 누적 합만 갱신하는 스트리밍 집계기.
+// add()는 사이클당 O(1), finalize()는 구간당 한 번 호출되어 OneSecondSummaryData를 만든다.
+// 지배 고조파는 구간 끝에서야 차수가 결정되므로 차수별 제곱합을 따로 유지한다.
+class OneSecondAccumulator
+{
+public:
+    OneSecondAccumulator() = default;
+
+    // 한 사이클의 측정 결과를 누적
+    void add(const MeasuredData& cycleData);
+
+    // 누적된 값으로 요약 데이터 생성 (lastCycleData: 구간의 마지막 사이클)
+    OneSecondSummaryData finalize(const MeasuredData& lastCycleData) const;
+
+    // 다음 구간을 위해 누적값 초기화 (차수별 버퍼의 용량은 유지)
+    void reset();
+
+    size_t count() const;
+
+private:
+    std::array<double, 3> m_totalVoltageRmsSumSq{};
+    std::array<double, 3> m_totalCurrentRmsSumSq{};
+    std::array<double, 3> m_totalVoltageRmsSumSq_ll{}; // [0]:ab [1]:bc [2]:ca
+    std::array<double, 3> m_activePowerSum{};
+    std::array<double, 3> m_fundReactivePowerSum{}; // IEEE 1459 Q1
+    std::array<double, 3> m_fundVoltageRmsSumSq{};
+    std::array<double, 3> m_fundCurrentRmsSumSq{};
+    std::array<double, 3> m_fundVoltageRmsSumSq_ll{};
+    double m_residualVoltageRmsSum = 0.0;
+    double m_residualCurrentRmsSum = 0.0;
+    double m_residualVoltageFundamentalSum = 0.0;
+    double m_residualCurrentFundamentalSum = 0.0;
+
+    // A상 기준, 인덱스 = 고조파 차수
+    std::vector<double> m_dominantVoltageRmsSumSqByOrder;
+    std::vector<double> m_dominantCurrentRmsSumSqByOrder;
+
+    // 주파수 계산용 (마지막 두 사이클의 타임스탬프)
+    std::chrono::nanoseconds m_lastTimestamp{0};
+    std::chrono::nanoseconds m_previousTimestamp{0};
+
+    size_t m_count = 0;
+};
+
+#endif // ONE_SECOND_ACCUMULATOR_H
@@ -82,8 +82,10 @@ void OneSecondSummaryWindow::setupUi()
     setLayout(mainLayout);
 }
 
-void OneSecondSummaryWindow::updateData(const OneSecondSummaryData& data)
+void OneSecondSummaryWindow::updateData(const OneSecondSummarySnapshot& snapshot)
 {
+    if(!snapshot) return;
+    const OneSecondSummaryData& data = *snapshot;
 
     // 숫자 포맷 지정: 소숫점 3자리까지
     m_tableWidget->item(Row::TotalRmsA, Col::Voltage)->setText(QString::number(data.totalVoltageRms.a, 'f', 3));
@@ -47,7 +47,7 @@ public:
 
 public slots:
     // SimulationEngine의 신호를 받아 UI를 업데이트할 슬롯
-    void updateData(const OneSecondSummaryData& data);
+    void updateData(const OneSecondSummarySnapshot& snapshot);
 
 private:
     void setupUi();
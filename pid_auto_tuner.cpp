@@ -0,0 +1,210 @@
+#include "pid_auto_tuner.h"
+#include "simulation_engine.h"
+#include <QDebug>
+#include <algorithm>
+#include <optional>
+#include <random>
+#include <thread>
+
+namespace {
+    struct TunerConstants {
+        static constexpr std::chrono::milliseconds Step{5};  // 주파수 갱신 및 오차 관측 주기
+        static constexpr double LockToleranceHz = 0.05;      // 잠금으로 보는 오차 (FLL 잠금 기준과 동일)
+        static constexpr double Amplitude = 220.0;
+        static constexpr int MaxDataSize = 256;              // 튜닝 중에는 그래프용 이력이 필요 없음
+
+        // 점수 가중치 (낮을수록 좋음)
+        static constexpr double OvershootWeightPerHz = 1.0;
+        static constexpr double RestartWeight = 0.5;
+        static constexpr double UnlockedPenalty = 10.0;
+    };
+}
+
+double PidAutoTuner::Scenario::frequencyAt(Milliseconds t) const
+{
+    if(t < changeStart) {
+        return startFrequency;
+    }
+    if(changeDuration.count() <= 0 || t >= changeStart + changeDuration) {
+        return endFrequency;
+    }
+    const double ratio = static_cast<double>((t - changeStart).count()) / changeDuration.count();
+    return startFrequency + (endFrequency - startFrequency) * ratio;
+}
+
+std::vector<PidAutoTuner::Scenario> PidAutoTuner::defaultScenarios()
+{
+    using namespace std::chrono_literals;
+    return {
+        { .name = "step up 60->61 Hz",   .duration = 6000ms, .startFrequency = 60.0, .endFrequency = 61.0, .changeStart = 3000ms },
+        { .name = "step down 60->57 Hz", .duration = 6000ms, .startFrequency = 60.0, .endFrequency = 57.0, .changeStart = 3000ms },
+        { .name = "ramp 50->52 Hz",      .duration = 7000ms, .startFrequency = 50.0, .endFrequency = 52.0, .changeStart = 3000ms, .changeDuration = 2000ms },
+        { .name = "noisy 50 Hz",         .duration = 6000ms, .startFrequency = 50.0, .endFrequency = 50.0,
+          .jitterHz = 0.02, .harmonicMagnitude = 22.0, .seed = 7 },
+    };
+}
+
+std::vector<PidAutoTuner::Candidate> PidAutoTuner::makeGrid(const Candidate& base, std::span<const double> factors)
+{
+    std::vector<Candidate> grid;
+    if(factors.empty()) {
+        return grid;
+    }
+
+    // 6자리 factors.size()진수로 모든 조합을 나열
+    const size_t n = factors.size();
+    size_t total = 1;
+    for(int i{0}; i < 6; ++i) total *= n;
+    grid.reserve(total);
+
+    for(size_t index = 0; index < total; ++index) {
+        size_t digits = index;
+        auto next = [&]() { const double f = factors[digits % n]; digits /= n; return f; };
+
+        Candidate c = base;
+        c.fll.Kp *= next(); c.fll.Ki *= next(); c.fll.Kd *= next();
+        c.zc.Kp *= next();  c.zc.Ki *= next();  c.zc.Kd *= next();
+        grid.push_back(c);
+    }
+    return grid;
+}
+
+std::vector<PidAutoTuner::Result> PidAutoTuner::run(const std::vector<Candidate>& candidates,
+                                                    const std::vector<Scenario>& scenarios,
+                                                    const ProgressCallback& progress,
+                                                    const std::atomic<bool>* cancel)
+{
+    const size_t jobCount = candidates.size() * scenarios.size();
+    std::vector<ScenarioScore> scores(jobCount);
+    std::vector<char> finished(jobCount, 0);
+    std::atomic<size_t> nextJob{0};
+    std::atomic<size_t> doneCount{0};
+
+    // 작업 하나(엔진 수 초 분량)가 충분히 크므로 작업 단위로 가져가며 모든 코어를 사용
+    auto worker = [&]() {
+        while(true) {
+            if(cancel && cancel->load(std::memory_order_relaxed)) break;
+            const size_t job = nextJob.fetch_add(1, std::memory_order_relaxed);
+            if(job >= jobCount) break;
+
+            const auto& candidate = candidates[job / scenarios.size()];
+            const auto& scenario = scenarios[job % scenarios.size()];
+            try {
+                scores[job] = evaluate(candidate, scenario);
+                finished[job] = 1;
+            } catch(const std::exception& e) {
+                qWarning() << "PidAutoTuner:" << e.what();
+            }
+
+            const size_t done = doneCount.fetch_add(1, std::memory_order_relaxed) + 1;
+            if(progress) progress(done, jobCount);
+        }
+    };
+
+    const unsigned threadCount = std::max(1u, std::thread::hardware_concurrency());
+    {
+        std::vector<std::jthread> workers;
+        workers.reserve(threadCount);
+        for(unsigned i{0}; i < threadCount; ++i) {
+            workers.emplace_back(worker);
+        }
+    } // jthread 소멸 시 join
+
+    // 모든 시나리오가 끝난 후보만 집계
+    std::vector<Result> results;
+    results.reserve(candidates.size());
+    for(size_t c = 0; c < candidates.size(); ++c) {
+        Result result{ .candidate = candidates[c] };
+        bool complete = true;
+        for(size_t s = 0; s < scenarios.size(); ++s) {
+            const size_t job = c * scenarios.size() + s;
+            if(!finished[job]) {
+                complete = false;
+                break;
+            }
+            const auto& scenarioScore = scores[job];
+            result.score += score(scenarioScore, scenarios[s]);
+            result.meanLockTimeSec += scenarioScore.lockTimeSec;
+            result.maxOvershootHz = std::max(result.maxOvershootHz, scenarioScore.overshootHz);
+            result.restarts += scenarioScore.restarts;
+            if(!scenarioScore.locked) ++result.unlockedScenarios;
+        }
+        if(!complete || scenarios.empty()) {
+            continue;
+        }
+        result.score /= scenarios.size();
+        result.meanLockTimeSec /= scenarios.size();
+        results.push_back(result);
+    }
+
+    std::ranges::stable_sort(results, {}, &Result::score);
+    return results;
+}
+
+PidAutoTuner::ScenarioScore PidAutoTuner::evaluate(const Candidate& candidate, const Scenario& scenario)
+{
+    // 작업 스레드 안에서만 사용하는 헤드리스 엔진 (타이머는 시작하지 않음)
+    SimulationEngine engine;
+    engine.m_maxDataSize.setValue(TunerConstants::MaxDataSize);
+    engine.m_amplitude.setValue(TunerConstants::Amplitude);
+    engine.m_frequency.setValue(scenario.startFrequency);
+    engine.m_voltageHarmonic.setValue({{3, scenario.harmonicMagnitude, 0.0}});
+    engine.enableQualityMeasurements(false); // 점수는 샘플링 주파수와 재시작 횟수만 사용
+    engine.updateFrequencyTrackerCoefficients(candidate.fll, candidate.zc);
+    engine.enableFrequencyTracking(true);
+
+    std::mt19937 rng(scenario.seed);
+    std::uniform_real_distribution<double> jitter(-1.0, 1.0);
+
+    const auto step = TunerConstants::Step;
+    const auto reference = scenario.changeStart;
+    std::optional<Milliseconds> firstLock;
+    std::optional<Milliseconds> lastViolation;
+    double overshoot = 0.0;
+    double error = 0.0;
+
+    for(Milliseconds t{0}; t < scenario.duration; t += step) {
+        double frequency = scenario.frequencyAt(t);
+        if(scenario.jitterHz > 0.0) {
+            frequency += scenario.jitterHz * jitter(rng);
+        }
+        engine.m_frequency.setValue(frequency);
+        engine.runFor(step);
+
+        // 추적 목표: 샘플링 주파수(samplingCycles)가 신호 주파수와 같아지는 것
+        const Milliseconds now = t + step;
+        error = engine.m_samplingCycles.value() - scenario.frequencyAt(now);
+        if(now < reference) {
+            continue;
+        }
+
+        if(std::abs(error) > TunerConstants::LockToleranceHz) {
+            lastViolation = now;
+        } else if(!firstLock) {
+            firstLock = now;
+        }
+        if(firstLock) {
+            overshoot = std::max(overshoot, std::abs(error));
+        }
+    }
+
+    ScenarioScore result;
+    result.locked = std::abs(error) <= TunerConstants::LockToleranceHz;
+    result.lockTimeSec = lastViolation ? std::chrono::duration<double>(*lastViolation - reference).count() : 0.0;
+    result.overshootHz = overshoot;
+    result.restarts = engine.getFrequencyTracker()->restartCount();
+    return result;
+}
+
+double PidAutoTuner::score(const ScenarioScore& result, const Scenario& scenario)
+{
+    // 잠금 시간은 관측 구간 길이로 정규화
+    const double spanSec = std::chrono::duration<double>(scenario.duration - scenario.changeStart).count();
+    double value = spanSec > 0.0 ? result.lockTimeSec / spanSec : 0.0;
+    value += TunerConstants::OvershootWeightPerHz * result.overshootHz;
+    value += TunerConstants::RestartWeight * result.restarts;
+    if(!result.locked) {
+        value += TunerConstants::UnlockedPenalty;
+    }
+    return value;
+}
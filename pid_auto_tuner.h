@@ -0,0 +1,80 @@
+#ifndef PID_AUTO_TUNER_H
+#define PID_AUTO_TUNER_H
+
+#include <atomic>
+#include <chrono>
+#include <functional>
+#include <span>
+#include <string>
+#include <vector>
+#include "frequency_tracker.h"
+
+// PidAutoTuner 클래스
+// FrequencyTracker의 FLL/ZC PID 계수를 오프라인으로 탐색.
+// (후보 계수, 시나리오) 조합마다 타이머 없는 SimulationEngine을 만들어 병렬로 실행하고,
+// 잠금 시간, 오버슈트, 거친 탐색 재시작 횟수로 점수를 매겨 순위표를 반환.
+// 엔진/추적기는 작업 스레드 안에서 생성되고 버려지므로 GUI 스레드와 상태를 공유하지 않음.
+class PidAutoTuner
+{
+public:
+    using Milliseconds = std::chrono::milliseconds;
+
+    // 후보 계수 한 쌍
+    struct Candidate {
+        FrequencyTracker::PidCoefficients fll;
+        FrequencyTracker::PidCoefficients zc;
+    };
+
+    // 신호 주파수 변화 시나리오
+    struct Scenario {
+        std::string name;
+        Milliseconds duration{6000};
+        double startFrequency = 60.0;   // 시작 주파수 (Hz)
+        double endFrequency = 60.0;     // 변화 후 주파수 (Hz)
+        Milliseconds changeStart{0};    // 변화 시작 시점
+        Milliseconds changeDuration{0}; // 0이면 계단, 아니면 이 시간 동안 선형 램프
+        double jitterHz = 0.0;          // 주파수 무작위 흔들림 폭 (잡음 시나리오)
+        double harmonicMagnitude = 0.0; // 3고조파 크기 (파형 왜곡)
+        unsigned seed = 1;
+
+        double frequencyAt(Milliseconds t) const; // 흔들림 제외 목표 주파수
+    };
+
+    // 후보 하나의 시나리오 평균 성적 (점수가 낮을수록 좋음)
+    struct Result {
+        Candidate candidate;
+        double score = 0.0;
+        double meanLockTimeSec = 0.0;   // 기준 시점부터 허용 오차 안에 머무르기 시작한 시점까지
+        double maxOvershootHz = 0.0;    // 첫 잠금 이후 최대 오차
+        int restarts = 0;               // 거친 탐색 재시작 횟수 합
+        int unlockedScenarios = 0;      // 끝날 때까지 잠기지 않은 시나리오 수
+    };
+
+    using ProgressCallback = std::function<void(size_t done, size_t total)>;
+
+    // 계단(상승/하강), 램프, 잡음 시나리오 묶음
+    static std::vector<Scenario> defaultScenarios();
+
+    // base의 6개 계수 각각에 factors를 곱한 모든 조합 (factors.size()^6개)
+    static std::vector<Candidate> makeGrid(const Candidate& base, std::span<const double> factors);
+
+    // 모든 (후보, 시나리오)를 하드웨어 스레드 수만큼의 작업자로 나눠 실행하고 점수 오름차순으로 반환.
+    // cancel이 true가 되면 남은 작업을 건너뛰고 지금까지의 결과만 반환
+    static std::vector<Result> run(const std::vector<Candidate>& candidates,
+                                   const std::vector<Scenario>& scenarios,
+                                   const ProgressCallback& progress = {},
+                                   const std::atomic<bool>* cancel = nullptr);
+
+private:
+    struct ScenarioScore {
+        double lockTimeSec = 0.0;
+        double overshootHz = 0.0;
+        int restarts = 0;
+        bool locked = false;
+    };
+
+    static ScenarioScore evaluate(const Candidate& candidate, const Scenario& scenario);
+    static double score(const ScenarioScore& result, const Scenario& scenario);
+};
+
+#endif // PID_AUTO_TUNER_H
@@ -5,6 +5,17 @@
 #include <QHBoxLayout>
 #include <QFormLayout>
 #include <QGroupBox>
+#include <QProgressBar>
+#include <QTableWidget>
+#include <QHeaderView>
+#include <algorithm>
+#include <array>
+
+namespace {
+    // 자동 튜닝 격자: 현재 계수의 0.5배, 1배, 2배 (6개 계수 -> 729 후보)
+    constexpr std::array<double, 3> TuningFactors = {0.5, 1.0, 2.0};
+    constexpr int MaxDisplayedResults = 20;
+}
 
 PidTuningDialog::PidTuningDialog(QWidget *parent)
     : QDialog(parent)
@@ -14,6 +25,16 @@ PidTuningDialog::PidTuningDialog(QWidget *parent)
     // 시그널 슬롯 연결
     connect(m_applyButton, &QPushButton::clicked, this, &PidTuningDialog::accept);
     connect(m_closeButton, &QPushButton::clicked, this, &PidTuningDialog::reject);
+    connect(m_autoTuneButton, &QPushButton::clicked, this, &PidTuningDialog::startAutoTuning);
+    connect(m_resultTable, &QTableWidget::cellClicked, this, [this](int row, int) {
+        applyResultRow(row);
+    });
+}
+
+PidTuningDialog::~PidTuningDialog()
+{
+    // 진행 중인 튜닝을 멈추고 작업 스레드 종료 대기 (jthread 소멸 시 join)
+    m_cancelTuning = true;
 }
 
 void PidTuningDialog::setupUi()
@@ -54,6 +75,26 @@ void PidTuningDialog::setupUi()
     zcLayout->addRow("I (Ki)", m_zcKiControl);
     zcLayout->addRow("D (Kd)", m_zcKdControl);
 
+    // 자동 튜닝 위젯 생성
+    m_autoTuneButton = new QPushButton("자동 튜닝");
+    m_autoTuneButton->setToolTip("현재 계수 주변 후보를 계단/램프/잡음 시나리오로 병렬 시뮬레이션하여 순위를 매김");
+    m_autoTuneProgress = new QProgressBar();
+    m_autoTuneProgress->setRange(0, 100);
+    m_autoTuneProgress->setValue(0);
+
+    m_resultTable = new QTableWidget(0, 11);
+    m_resultTable->setHorizontalHeaderLabels({"점수", "잠금(s)", "오버슈트(Hz)", "재시작", "미잠금",
+                                              "FLL Kp", "FLL Ki", "FLL Kd", "ZC Kp", "ZC Ki", "ZC Kd"});
+    m_resultTable->setEditTriggers(QAbstractItemView::NoEditTriggers);
+    m_resultTable->setSelectionBehavior(QAbstractItemView::SelectRows);
+    m_resultTable->setSelectionMode(QAbstractItemView::SingleSelection);
+    m_resultTable->horizontalHeader()->setSectionResizeMode(QHeaderView::ResizeToContents);
+    m_resultTable->setMinimumHeight(200);
+
+    auto tuningLayout = new QHBoxLayout();
+    tuningLayout->addWidget(m_autoTuneButton);
+    tuningLayout->addWidget(m_autoTuneProgress);
+
     // 버튼 생성
     m_applyButton = new QPushButton("적용");
     m_closeButton = new QPushButton("닫기");
@@ -70,6 +111,8 @@ void PidTuningDialog::setupUi()
     buttonLayout->addWidget(m_closeButton);
 
     mainLayout->addLayout(pidLayout);
+    mainLayout->addLayout(tuningLayout);
+    mainLayout->addWidget(m_resultTable);
     mainLayout->addLayout(buttonLayout, Qt::AlignRight);
 }
 
@@ -102,3 +145,85 @@ void PidTuningDialog::accept()
 
     QDialog::accept();
 }
+
+void PidTuningDialog::startAutoTuning()
+{
+    if(m_tuningThread.joinable()) {
+        return; // 이미 실행 중
+    }
+
+    // 현재 입력값을 격자의 중심으로 사용
+    PidAutoTuner::Candidate base;
+    base.fll = { .Kp = m_fllKpControl->value(), .Ki = m_fllKiControl->value(), .Kd = m_fllKdControl->value() };
+    base.zc = { .Kp = m_zcKpControl->value(), .Ki = m_zcKiControl->value(), .Kd = m_zcKdControl->value() };
+
+    m_autoTuneButton->setEnabled(false);
+    m_autoTuneProgress->setValue(0);
+    m_cancelTuning = false;
+
+    m_tuningThread = std::jthread([this, base]() {
+        const auto candidates = PidAutoTuner::makeGrid(base, TuningFactors);
+        std::atomic<int> lastPercent{0};
+
+        auto results = PidAutoTuner::run(candidates, PidAutoTuner::defaultScenarios(),
+            [this, &lastPercent](size_t done, size_t total) {
+                // 1% 단위로만 GUI에 알림
+                const int percent = static_cast<int>(done * 100 / std::max<size_t>(total, 1));
+                if(lastPercent.exchange(percent) != percent) {
+                    QMetaObject::invokeMethod(this, [this, percent]() {
+                        m_autoTuneProgress->setValue(percent);
+                    }, Qt::QueuedConnection);
+                }
+            }, &m_cancelTuning);
+
+        QMetaObject::invokeMethod(this, [this, results = std::move(results)]() mutable {
+            onAutoTuningFinished(std::move(results));
+        }, Qt::QueuedConnection);
+    });
+}
+
+void PidTuningDialog::onAutoTuningFinished(std::vector<PidAutoTuner::Result> results)
+{
+    m_tuningThread.join();
+    m_autoTuneButton->setEnabled(true);
+    m_autoTuneProgress->setValue(100);
+
+    m_results = std::move(results);
+    const int rowCount = std::min(static_cast<int>(m_results.size()), MaxDisplayedResults);
+    m_resultTable->setRowCount(rowCount);
+
+    for(int row = 0; row < rowCount; ++row) {
+        const auto& r = m_results[row];
+        const std::array<QString, 11> cells = {
+            QString::number(r.score, 'f', 3),
+            QString::number(r.meanLockTimeSec, 'f', 2),
+            QString::number(r.maxOvershootHz, 'f', 3),
+            QString::number(r.restarts),
+            QString::number(r.unlockedScenarios),
+            QString::number(r.candidate.fll.Kp, 'g', 4),
+            QString::number(r.candidate.fll.Ki, 'g', 4),
+            QString::number(r.candidate.fll.Kd, 'g', 4),
+            QString::number(r.candidate.zc.Kp, 'g', 4),
+            QString::number(r.candidate.zc.Ki, 'g', 4),
+            QString::number(r.candidate.zc.Kd, 'g', 4),
+        };
+        for(int column = 0; column < static_cast<int>(cells.size()); ++column) {
+            m_resultTable->setItem(row, column, new QTableWidgetItem(cells[column]));
+        }
+    }
+
+    if(rowCount > 0) {
+        m_resultTable->selectRow(0);
+        applyResultRow(0);
+    }
+}
+
+void PidTuningDialog::applyResultRow(int row)
+{
+    if(row < 0 || row >= static_cast<int>(m_results.size())) {
+        return;
+    }
+
+    // 입력 칸에만 반영. "적용"을 눌러야 추적기에 전달됨
+    setInitialValues(m_results[row].candidate.fll, m_results[row].candidate.zc);
+}
@@ -3,17 +3,23 @@
 
 #include <QDialog>
 #include <QObject>
+#include <atomic>
+#include <thread>
 #include "frequency_tracker.h"
+#include "pid_auto_tuner.h"
 
 class ValueControlWidget;
 class QGroupBox;
 class QPushButton;
+class QProgressBar;
+class QTableWidget;
 
 class PidTuningDialog : public QDialog
 {
     Q_OBJECT
 public:
     explicit PidTuningDialog(QWidget *parent = nullptr);
+    ~PidTuningDialog();
 
     // 다이얼 로그를 열 때 현재 PID 값으로 초기화하는 함수
     void setInitialValues(const FrequencyTracker::PidCoefficients& fllCoeffs, const FrequencyTracker::PidCoefficients& zcCoeffs);
@@ -25,6 +31,11 @@ private:
     void setupUi();
     void accept() override;
 
+    // 자동 튜닝 (현재 입력값을 기준으로 격자 탐색, 백그라운드 스레드에서 실행)
+    void startAutoTuning();
+    void onAutoTuningFinished(std::vector<PidAutoTuner::Result> results);
+    void applyResultRow(int row);
+
     // FLL 그룹
     QGroupBox* m_fllGroup;
     ValueControlWidget* m_fllKpControl;
@@ -37,6 +48,14 @@ private:
     ValueControlWidget* m_zcKiControl;
     ValueControlWidget* m_zcKdControl;
 
+    // 자동 튜닝
+    QPushButton* m_autoTuneButton;
+    QProgressBar* m_autoTuneProgress;
+    QTableWidget* m_resultTable;
+    std::vector<PidAutoTuner::Result> m_results;
+    std::atomic<bool> m_cancelTuning{false};
+    std::jthread m_tuningThread;
+
     // 버튼
     QPushButton* m_applyButton;
     QPushButton* m_closeButton;
@@ -0,0 +1,287 @@
+#include "sample_history.h"
+#include "config.h"
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <utility>
+
+SampleHistory::SampleHistory()
+    : m_storage(Storage::Double)
+    , m_voltageFullScale(config::History::VoltageFullScale)
+    , m_currentFullScale(config::History::CurrentFullScale)
+{
+    updateScale();
+}
+
+void SampleHistory::setStorage(Storage storage)
+{
+    if(storage == m_storage) return;
+    reencode(storage, m_voltageFullScale, m_currentFullScale);
+}
+
+void SampleHistory::setFullScale(double voltageFullScale, double currentFullScale)
+{
+    if(voltageFullScale <= 0.0 || currentFullScale <= 0.0) return;
+    reencode(m_storage, voltageFullScale, currentFullScale);
+}
+
+void SampleHistory::push_back(const DataPoint& point)
+{
+    append(point.timestamp, channelValues(point));
+}
+
+void SampleHistory::pop_front()
+{
+    if(m_size == 0) return;
+    ++m_beginIndex;
+    --m_size;
+
+    // 앞 블록/구간의 샘플을 모두 버렸으면 해제
+    if(m_beginIndex >= (m_firstBlock + 1) * config::History::BlockSize) {
+        m_blocks.pop_front();
+        ++m_firstBlock;
+    }
+    const Segment& front = m_segments.front();
+    if(m_beginIndex >= front.firstIndex + front.count) {
+        m_segments.pop_front();
+    }
+}
+
+void SampleHistory::clear()
+{
+    m_blocks.clear();
+    m_segments.clear();
+    m_beginIndex += m_size;
+    m_size = 0;
+    m_clippedCount = 0;
+}
+
+DataPoint SampleHistory::operator[](size_t index) const
+{
+    const uint64_t absoluteIndex = m_beginIndex + index;
+    const Values v = values(absoluteIndex);
+
+    DataPoint point;
+    point.timestamp = segmentTime(locateSegment(absoluteIndex), absoluteIndex);
+    point.voltage.a = v[VoltageA];
+    point.voltage.b = v[VoltageB];
+    point.voltage.c = v[VoltageC];
+    point.current.a = v[CurrentA];
+    point.current.b = v[CurrentB];
+    point.current.c = v[CurrentC];
+    point.voltage_ll.ab = v[VoltageA] - v[VoltageB];
+    point.voltage_ll.bc = v[VoltageB] - v[VoltageC];
+    point.voltage_ll.ca = v[VoltageC] - v[VoltageA];
+    return point;
+}
+
+SampleHistory::Nanoseconds SampleHistory::timestamp(size_t index) const
+{
+    const uint64_t absoluteIndex = m_beginIndex + index;
+    return segmentTime(locateSegment(absoluteIndex), absoluteIndex);
+}
+
+SampleHistory::const_iterator SampleHistory::lowerBound(Nanoseconds time) const
+{
+    return search(time, false);
+}
+
+SampleHistory::const_iterator SampleHistory::upperBound(Nanoseconds time) const
+{
+    return search(time, true);
+}
+
+size_t SampleHistory::bytesPerSample() const
+{
+    size_t channelBytes = sizeof(double);
+    switch(m_storage) {
+    case Storage::Double: channelBytes = sizeof(double); break;
+    case Storage::Int32: channelBytes = sizeof(int32_t); break;
+    case Storage::Int16: channelBytes = sizeof(int16_t); break;
+    }
+    return channelBytes * ChannelCount;
+}
+
+// ---- private ----
+SampleHistory::Values SampleHistory::channelValues(const DataPoint& point)
+{
+    return {
+        point.voltage.a, point.voltage.b, point.voltage.c,
+        point.current.a, point.current.b, point.current.c
+    };
+}
+
+SampleHistory::Nanoseconds SampleHistory::segmentTime(const Segment& segment, uint64_t absoluteIndex)
+{
+    return segment.startTime + segment.interval * static_cast<int64_t>(absoluteIndex - segment.firstIndex);
+}
+
+void SampleHistory::updateScale()
+{
+    double maxCode = 0.0;
+    switch(m_storage) {
+    case Storage::Double: maxCode = 0.0; break;
+    case Storage::Int32: maxCode = std::numeric_limits<int32_t>::max(); break;
+    case Storage::Int16: maxCode = std::numeric_limits<int16_t>::max(); break;
+    }
+
+    for(int ch{0}; ch < ChannelCount; ++ch) {
+        const double fullScale = (ch < CurrentA) ? m_voltageFullScale : m_currentFullScale;
+        m_lsb[ch] = (maxCode > 0.0) ? fullScale / maxCode : 0.0;
+        m_inverseLsb[ch] = (maxCode > 0.0) ? maxCode / fullScale : 0.0;
+    }
+}
+
+void SampleHistory::reencode(Storage storage, double voltageFullScale, double currentFullScale)
+{
+    // 이전 형식/배율로 복원한 값을 새 형식/배율로 다시 인코딩 (절대 인덱스는 유지)
+    std::vector<std::pair<Nanoseconds, Values>> decoded;
+    decoded.reserve(m_size);
+    for(uint64_t index = m_beginIndex; index < m_beginIndex + m_size; ++index) {
+        decoded.emplace_back(segmentTime(locateSegment(index), index), values(index));
+    }
+
+    // 복사본이 공유하던 블록은 건드리지 않고 새 블록에 기록
+    m_blocks.clear();
+    m_segments.clear();
+    m_size = 0;
+    m_storage = storage;
+    m_voltageFullScale = voltageFullScale;
+    m_currentFullScale = currentFullScale;
+    updateScale();
+    for(const auto& [time, v] : decoded) {
+        append(time, v);
+    }
+}
+
+const SampleHistory::Segment& SampleHistory::locateSegment(uint64_t absoluteIndex) const
+{
+    // 간격이 바뀌는 일은 드물어 대부분 마지막 구간
+    if(absoluteIndex >= m_segments.back().firstIndex) {
+        return m_segments.back();
+    }
+    const auto it = std::upper_bound(m_segments.begin(), m_segments.end(), absoluteIndex,
+                                     [](uint64_t index, const Segment& segment) { return index < segment.firstIndex; });
+    return *std::prev(it);
+}
+
+SampleHistory::Values SampleHistory::values(uint64_t absoluteIndex) const
+{
+    const Block& block = *m_blocks[absoluteIndex / config::History::BlockSize - m_firstBlock];
+    const size_t offset = absoluteIndex % config::History::BlockSize;
+    switch(m_storage) {
+    case Storage::Int32: return decode(block.int32s, offset);
+    case Storage::Int16: return decode(block.int16s, offset);
+    case Storage::Double: break;
+    }
+    Values v;
+    for(int ch{0}; ch < ChannelCount; ++ch) {
+        v[ch] = block.doubles[ch][offset];
+    }
+    return v;
+}
+
+void SampleHistory::append(Nanoseconds timestamp, const Values& values)
+{
+    const uint64_t absoluteIndex = m_beginIndex + m_size;
+
+    // 마지막 구간의 간격에 맞는 시각이면 이어 붙이고, 아니면 새 구간 (블록은 그대로)
+    bool startSegment = m_segments.empty();
+    if(!startSegment) {
+        Segment& last = m_segments.back();
+        if(last.count == 1) {
+            last.interval = timestamp - last.startTime;
+            startSegment = last.interval <= Nanoseconds::zero();
+            if(startSegment) last.interval = Nanoseconds::zero();
+        } else {
+            startSegment = timestamp != last.startTime + last.interval * static_cast<int64_t>(last.count);
+        }
+    }
+    if(startSegment) {
+        m_segments.push_back({absoluteIndex, timestamp, Nanoseconds::zero(), 0});
+    }
+    ++m_segments.back().count;
+
+    // 블록 경계에서만 할당. 이미 있는 블록은 복사본과 공유 중이어도 복사본 크기 뒤쪽 칸이므로 그대로 씀
+    const uint64_t blockNumber = absoluteIndex / config::History::BlockSize;
+    if(m_blocks.empty() || blockNumber >= m_firstBlock + m_blocks.size()) {
+        if(m_blocks.empty()) m_firstBlock = blockNumber;
+        Block& block = *m_blocks.emplace_back(std::make_shared<Block>());
+        for(int ch{0}; ch < ChannelCount; ++ch) {
+            switch(m_storage) {
+            case Storage::Double: block.doubles[ch].resize(config::History::BlockSize); break;
+            case Storage::Int32: block.int32s[ch].resize(config::History::BlockSize); break;
+            case Storage::Int16: block.int16s[ch].resize(config::History::BlockSize); break;
+            }
+        }
+    }
+
+    Block& block = *m_blocks.back();
+    const size_t offset = absoluteIndex % config::History::BlockSize;
+    switch(m_storage) {
+    case Storage::Double:
+        for(int ch{0}; ch < ChannelCount; ++ch) {
+            block.doubles[ch][offset] = values[ch];
+        }
+        break;
+    case Storage::Int32: encode(block.int32s, offset, values); break;
+    case Storage::Int16: encode(block.int16s, offset, values); break;
+    }
+    ++m_size;
+}
+
+uint64_t SampleHistory::searchSegment(const Segment& segment, Nanoseconds time, bool strict) const
+{
+    const size_t first = (m_beginIndex > segment.firstIndex) ? m_beginIndex - segment.firstIndex : 0;
+    size_t offset = 0;
+    const auto elapsed = (time - segment.startTime).count();
+    if(elapsed < 0) {
+        offset = 0;
+    } else if(segment.interval <= Nanoseconds::zero()) {
+        offset = (strict || elapsed > 0) ? segment.count : 0; // 샘플 하나인 구간
+    } else {
+        const int64_t interval = segment.interval.count();
+        // lower: ceil(elapsed / interval), upper: floor(elapsed / interval) + 1
+        offset = strict ? static_cast<size_t>(elapsed / interval + 1) : static_cast<size_t>((elapsed + interval - 1) / interval);
+    }
+    return segment.firstIndex + std::clamp(offset, first, segment.count);
+}
+
+SampleHistory::const_iterator SampleHistory::search(Nanoseconds time, bool strict) const
+{
+    if(m_size == 0) return end();
+
+    // 마지막 샘플이 조건을 만족하는 첫 구간 (구간은 시각 순서)
+    const auto it = std::partition_point(m_segments.begin(), m_segments.end(), [&](const Segment& segment) {
+        const Nanoseconds lastTime = segment.startTime + segment.interval * static_cast<int64_t>(segment.count - 1);
+        return strict ? lastTime <= time : lastTime < time;
+    });
+    if(it == m_segments.end()) return end();
+
+    const uint64_t absoluteIndex = searchSegment(*it, time, strict);
+    return {this, static_cast<size_t>(absoluteIndex - m_beginIndex)};
+}
+
+template<typename T>
+void SampleHistory::encode(std::array<std::vector<T>, ChannelCount>& columns, size_t offset, const Values& values)
+{
+    // 대칭 범위 [-max, max]로 포화 (음수 쪽 최솟값 하나는 쓰지 않음)
+    constexpr double maxCode = std::numeric_limits<T>::max();
+    for(int ch{0}; ch < ChannelCount; ++ch) {
+        const double scaled = std::nearbyint(values[ch] * m_inverseLsb[ch]);
+        if(std::abs(scaled) > maxCode) {
+            ++m_clippedCount;
+        }
+        columns[ch][offset] = static_cast<T>(std::clamp(scaled, -maxCode, maxCode));
+    }
+}
+
+template<typename T>
+SampleHistory::Values SampleHistory::decode(const std::array<std::vector<T>, ChannelCount>& columns, size_t offset) const
+{
+    Values v;
+    for(int ch{0}; ch < ChannelCount; ++ch) {
+        v[ch] = columns[ch][offset] * m_lsb[ch];
+    }
+    return v;
+}
@@ -0,0 +1,171 @@
+#ifndef SAMPLE_HISTORY_H
+#define SAMPLE_HISTORY_H
+
+#include <QMetaType>
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <iterator>
+#include <memory>
+#include <vector>
+#include "data_point.h"
+
+// SampleHistory 클래스
+// 원시 파형 이력 (m_data). 샘플을 블록 단위로 보관하고 읽을 때 DataPoint로 복원함 (반복자/인덱스 접근 모두 값 반환).
+//  - 블록: 채널별 고정 길이 배열 (config::History::BlockSize 샘플). 절대 인덱스 [k*BlockSize, (k+1)*BlockSize)를 담당하며
+//    만들 때 한 번만 할당하고 이후에는 빈 칸에 쓰기만 함
+//  - 구간(Segment): 시작 인덱스 + 시작 시각 + 정수 샘플 간격. 간격이 바뀌면(샘플링 설정/추적기 변경) 새 구간만 추가하므로
+//    타임스탬프는 항상 원래 값 그대로 복원되고, 간격이 자주 바뀌어도 블록 수는 샘플 수 / BlockSize로 유지됨
+//  - 선간 전압은 저장하지 않고 상전압 차이로 계산 (push_back에 넣은 voltage_ll은 무시)
+//  - 채널 형식: Double(손실 없음) 또는 채널별 배율(LSB)로 정수화한 Int32/Int16 (범위를 넘으면 포화)
+// 엔진의 분석 경로는 생성 직후의 double 값을 쓰고, 이력은 그래프/내보내기/사후 분석용.
+// 복사본끼리 블록을 공유하고 구간 목록만 값으로 복사함 (샘플은 복사하지 않음).
+// 원본은 복사본의 크기 뒤쪽 칸에만 쓰므로, 복사본을 다른 스레드에 넘겨도 원본 수정과 겹치지 않음.
+class SampleHistory
+{
+public:
+    using Nanoseconds = std::chrono::nanoseconds;
+
+    enum class Storage { Double, Int32, Int16 };
+    enum Channel { VoltageA, VoltageB, VoltageC, CurrentA, CurrentB, CurrentC, ChannelCount };
+
+    using value_type = DataPoint;
+    using size_type = size_t;
+    using difference_type = std::ptrdiff_t;
+
+    // 임의 접근 반복자. 역참조하면 복원된 DataPoint 값
+    class const_iterator
+    {
+    public:
+        using iterator_category = std::random_access_iterator_tag;
+        using value_type = DataPoint;
+        using difference_type = std::ptrdiff_t;
+        using reference = DataPoint;
+
+        // it->timestamp 형태 접근용 (임시 값을 감쌈)
+        struct pointer {
+            DataPoint point;
+            const DataPoint* operator->() const { return &point; }
+        };
+
+        const_iterator() = default;
+        const_iterator(const SampleHistory* history, size_t index) : m_history(history), m_index(index) {}
+
+        reference operator*() const { return (*m_history)[m_index]; }
+        pointer operator->() const { return {(*m_history)[m_index]}; }
+        reference operator[](difference_type n) const { return (*m_history)[m_index + n]; }
+
+        const_iterator& operator++() { ++m_index; return *this; }
+        const_iterator operator++(int) { auto old = *this; ++m_index; return old; }
+        const_iterator& operator--() { --m_index; return *this; }
+        const_iterator operator--(int) { auto old = *this; --m_index; return old; }
+        const_iterator& operator+=(difference_type n) { m_index += n; return *this; }
+        const_iterator& operator-=(difference_type n) { m_index -= n; return *this; }
+        friend const_iterator operator+(const_iterator it, difference_type n) { return it += n; }
+        friend const_iterator operator+(difference_type n, const_iterator it) { return it += n; }
+        friend const_iterator operator-(const_iterator it, difference_type n) { return it -= n; }
+        friend difference_type operator-(const const_iterator& a, const const_iterator& b) {
+            return static_cast<difference_type>(a.m_index) - static_cast<difference_type>(b.m_index);
+        }
+        friend bool operator==(const const_iterator& a, const const_iterator& b) { return a.m_index == b.m_index; }
+        friend auto operator<=>(const const_iterator& a, const const_iterator& b) { return a.m_index <=> b.m_index; }
+
+        size_t index() const { return m_index; }
+
+    private:
+        const SampleHistory* m_history = nullptr;
+        size_t m_index = 0;
+    };
+    using iterator = const_iterator;
+
+    SampleHistory();
+
+    // 저장 형식 변경. 보관 중인 샘플은 새 형식으로 다시 인코딩
+    void setStorage(Storage storage);
+    Storage storage() const { return m_storage; }
+
+    // 정수 형식의 입력 범위 (±피크). 보관 중인 샘플은 다시 인코딩
+    void setFullScale(double voltageFullScale, double currentFullScale);
+    double lsb(int channel) const { return m_lsb[channel]; } // Double 형식에서는 0
+
+    void push_back(const DataPoint& point);
+    void pop_front();
+    void clear();
+
+    size_t size() const { return m_size; }
+    bool empty() const { return m_size == 0; }
+    DataPoint operator[](size_t index) const;
+    DataPoint front() const { return (*this)[0]; }
+    DataPoint back() const { return (*this)[m_size - 1]; }
+    Nanoseconds timestamp(size_t index) const;
+    const_iterator begin() const { return {this, 0}; }
+    const_iterator end() const { return {this, m_size}; }
+
+    // 시각 검색. 구간은 이진 탐색, 구간 안에서는 간격으로 나눠 바로 계산
+    const_iterator lowerBound(Nanoseconds time) const; // timestamp >= time인 첫 샘플
+    const_iterator upperBound(Nanoseconds time) const; // timestamp > time인 첫 샘플
+
+    // 샘플 하나가 차지하는 바이트 수 (블록 헤더 제외)
+    size_t bytesPerSample() const;
+    // 정수 형식에서 범위를 넘어 포화된 값의 누적 수
+    size_t clippedCount() const { return m_clippedCount; }
+    size_t blockCount() const { return m_blocks.size(); }
+    size_t segmentCount() const { return m_segments.size(); }
+
+private:
+    using Values = std::array<double, ChannelCount>;
+
+    // 채널별 고정 길이 배열 (현재 형식의 배열만 BlockSize 크기로 할당)
+    struct Block {
+        std::array<std::vector<double>, ChannelCount> doubles;
+        std::array<std::vector<int32_t>, ChannelCount> int32s;
+        std::array<std::vector<int16_t>, ChannelCount> int16s;
+    };
+
+    // 같은 간격으로 이어지는 샘플 구간 (다음 구간의 firstIndex 또는 끝까지)
+    struct Segment {
+        uint64_t firstIndex = 0;     // 구간 첫 샘플의 절대 인덱스
+        Nanoseconds startTime{0};
+        Nanoseconds interval{0};     // 샘플이 하나뿐이면 아직 0
+        size_t count = 0;
+    };
+
+    static Values channelValues(const DataPoint& point);
+    static Nanoseconds segmentTime(const Segment& segment, uint64_t absoluteIndex);
+    void updateScale();
+    void reencode(Storage storage, double voltageFullScale, double currentFullScale);
+    const Segment& locateSegment(uint64_t absoluteIndex) const;
+    Values values(uint64_t absoluteIndex) const;
+    void append(Nanoseconds timestamp, const Values& values);
+    // 구간 안에서 timestamp >= time(strict면 >)인 첫 절대 인덱스
+    uint64_t searchSegment(const Segment& segment, Nanoseconds time, bool strict) const;
+    const_iterator search(Nanoseconds time, bool strict) const;
+
+    template<typename T>
+    void encode(std::array<std::vector<T>, ChannelCount>& columns, size_t offset, const Values& values);
+    template<typename T>
+    Values decode(const std::array<std::vector<T>, ChannelCount>& columns, size_t offset) const;
+
+    Storage m_storage;
+    double m_voltageFullScale;
+    double m_currentFullScale;
+    Values m_lsb{};
+    Values m_inverseLsb{};
+    size_t m_clippedCount = 0;
+
+    using BlockPtr = std::shared_ptr<Block>;
+    std::deque<BlockPtr> m_blocks;
+    uint64_t m_firstBlock = 0; // m_blocks.front()의 블록 번호 (절대 인덱스 / BlockSize)
+    std::deque<Segment> m_segments;
+    uint64_t m_beginIndex = 0; // 보관 중인 첫 샘플의 절대 인덱스 (앞 블록/구간 안에서 버려진 샘플 건너뜀)
+    size_t m_size = 0;
+};
+Q_DECLARE_METATYPE(SampleHistory)
+
+// 원시 파형 이력의 불변 스냅샷 (스레드 간 전달 시 참조 카운트만 증가)
+using SampleHistorySnapshot = std::shared_ptr<const SampleHistory>;
+Q_DECLARE_METATYPE(SampleHistorySnapshot)
+
+#endif // SAMPLE_HISTORY_H
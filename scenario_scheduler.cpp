@@ -0,0 +1,263 @@
+#include "scenario_scheduler.h"
+#include <QFile>
+#include <QJsonArray>
+#include <QJsonDocument>
+#include <QJsonObject>
+#include <algorithm>
+#include <limits>
+#include <memory>
+
+namespace {
+    using Nanoseconds = utils::Nanoseconds;
+
+    Nanoseconds secondsToNs(double seconds)
+    {
+        return std::chrono::duration_cast<Nanoseconds>(utils::FpSeconds(seconds));
+    }
+
+    // "abc", "b", "ac" -> 상 비트
+    std::expected<unsigned, QString> parsePhases(const QJsonValue& value)
+    {
+        if(value.isUndefined()) {
+            return ScenarioScheduler::AllPhases;
+        }
+        unsigned mask = 0;
+        for(const QChar c : value.toString().toLower()) {
+            if(c == 'a') mask |= 0b001;
+            else if(c == 'b') mask |= 0b010;
+            else if(c == 'c') mask |= 0b100;
+            else return std::unexpected(QString("알 수 없는 상 '%1'").arg(c));
+        }
+        if(mask == 0) {
+            return std::unexpected(QString("상이 지정되지 않았습니다."));
+        }
+        return mask;
+    }
+
+    // 선택된 상마다 f(상 인덱스) 호출
+    template<typename F>
+    void forEachPhase(unsigned mask, F&& f)
+    {
+        for(int phase{0}; phase < 3; ++phase) {
+            if(mask & (1u << phase)) f(phase);
+        }
+    }
+
+    void removeHarmonic(HarmonicList& list, const HarmonicComponent& harmonic)
+    {
+        if(auto it = std::ranges::find(list, harmonic); it != list.end()) {
+            list.erase(it);
+        }
+    }
+}
+
+std::expected<ScenarioScheduler::Timeline, QString> ScenarioScheduler::fromJson(const QByteArray& json)
+{
+    QJsonParseError parseError;
+    const QJsonDocument doc = QJsonDocument::fromJson(json, &parseError);
+    if(doc.isNull()) {
+        return std::unexpected(QString("JSON 파싱 실패: %1").arg(parseError.errorString()));
+    }
+    if(!doc.isObject() || !doc.object()["events"].isArray()) {
+        return std::unexpected(QString("'events' 배열이 없습니다."));
+    }
+
+    Timeline timeline;
+    timeline.name = doc.object()["name"].toString();
+
+    const QJsonArray events = doc.object()["events"].toArray();
+    for(qsizetype i = 0; i < events.size(); ++i) {
+        const QJsonObject obj = events[i].toObject();
+        const auto fail = [i](const QString& message) {
+            return std::unexpected(QString("이벤트 %1: %2").arg(i).arg(message));
+        };
+
+        Event event;
+        const double timeSec = obj["time"].toDouble(-1.0);
+        const double durationSec = obj["duration"].toDouble(0.0);
+        if(timeSec < 0.0 || durationSec < 0.0) {
+            return fail("time/duration은 0 이상이어야 합니다.");
+        }
+        event.time = secondsToNs(timeSec);
+        event.duration = secondsToNs(durationSec);
+
+        auto phases = parsePhases(obj["phases"]);
+        if(!phases) {
+            return fail(phases.error());
+        }
+        event.phases = *phases;
+
+        const QString type = obj["type"].toString();
+        if(type == "sag" || type == "swell") {
+            event.type = (type == "sag") ? EventType::Sag : EventType::Swell;
+            event.depth = obj["depth"].toDouble();
+            if(event.depth < 0.0 || (event.type == EventType::Sag && event.depth > 1.0)) {
+                return fail("depth 범위가 잘못되었습니다.");
+            }
+            if(event.duration.count() <= 0) {
+                return fail("새그/스웰은 duration이 필요합니다.");
+            }
+        } else if(type == "frequencyRamp") {
+            event.type = EventType::FrequencyRamp;
+            event.deltaHz = obj["deltaHz"].toDouble();
+        } else if(type == "phaseJump") {
+            event.type = EventType::PhaseJump;
+            event.degrees = obj["degrees"].toDouble();
+        } else if(type == "harmonic") {
+            event.type = EventType::HarmonicInjection;
+            event.harmonic = { .order = obj["order"].toInt(), .magnitude = obj["magnitude"].toDouble(), .phase = obj["phase"].toDouble() };
+            event.currentTarget = (obj["target"].toString("voltage") == "current");
+            if(event.harmonic.order < 1) {
+                return fail("order는 1 이상이어야 합니다.");
+            }
+        } else if(type == "unbalance") {
+            event.type = EventType::UnbalanceStep;
+            event.scale = obj["scale"].toDouble(1.0);
+            event.degrees = obj["degrees"].toDouble(0.0);
+            if(event.scale < 0.0) {
+                return fail("scale은 0 이상이어야 합니다.");
+            }
+        } else {
+            return fail(QString("알 수 없는 type '%1'").arg(type));
+        }
+
+        timeline.events.push_back(event);
+    }
+    return timeline;
+}
+
+std::expected<ScenarioScheduler::Timeline, QString> ScenarioScheduler::loadFile(const QString& path)
+{
+    QFile file(path);
+    if(!file.open(QIODevice::ReadOnly)) {
+        return std::unexpected(QString("파일을 열 수 없습니다: %1").arg(file.errorString()));
+    }
+    return fromJson(file.readAll());
+}
+
+void ScenarioScheduler::start(const Timeline& timeline, Nanoseconds now)
+{
+    clear();
+    m_name = timeline.name;
+    for(const auto& event : timeline.events) {
+        schedule(event, now);
+    }
+    // 같은 시각의 동작은 파일 순서 유지
+    std::ranges::stable_sort(m_actions, {}, &Action::time);
+}
+
+void ScenarioScheduler::clear()
+{
+    m_name.clear();
+    m_actions.clear();
+    m_nextAction = 0;
+    m_state = DisturbanceState{};
+}
+
+bool ScenarioScheduler::isActive() const
+{
+    return m_nextAction < m_actions.size();
+}
+
+const QString& ScenarioScheduler::name() const
+{
+    return m_name;
+}
+
+int ScenarioScheduler::samplesUntilNextAction(Nanoseconds now, Nanoseconds interval, int limit) const
+{
+    if(!isActive() || interval.count() <= 0) {
+        return limit;
+    }
+    // now + k * interval >= 동작 시각인 최소 k (그 샘플 생성 직전에 적용)
+    const auto remaining = m_actions[m_nextAction].time - now;
+    if(remaining.count() <= 0) {
+        return 0;
+    }
+    const auto samples = (remaining.count() + interval.count() - 1) / interval.count();
+    return static_cast<int>(std::min<long long>(samples, limit));
+}
+
+bool ScenarioScheduler::applyDue(Nanoseconds now)
+{
+    if(!isActive()) {
+        return false;
+    }
+    while(m_nextAction < m_actions.size() && m_actions[m_nextAction].time <= now) {
+        m_actions[m_nextAction].apply(m_state);
+        ++m_nextAction;
+    }
+    return !isActive();
+}
+
+void ScenarioScheduler::schedule(const Event& event, Nanoseconds origin)
+{
+    const Nanoseconds begin = origin + event.time;
+    const Nanoseconds end = begin + event.duration;
+    const unsigned phases = event.phases;
+
+    switch(event.type) {
+    case EventType::Sag:
+    case EventType::Swell: {
+        // 겹치는 새그/스웰은 합성하지 않고 나중 것이 우선
+        const double scale = (event.type == EventType::Sag) ? 1.0 - event.depth : 1.0 + event.depth;
+        m_actions.push_back({begin, [phases, scale](DisturbanceState& s) {
+            forEachPhase(phases, [&](int p) { s.dipScale[p] = scale; });
+        }});
+        m_actions.push_back({end, [phases](DisturbanceState& s) {
+            forEachPhase(phases, [&](int p) { s.dipScale[p] = 1.0; });
+        }});
+        break;
+    }
+    case EventType::FrequencyRamp: {
+        const double deltaHz = event.deltaHz;
+        if(event.duration.count() <= 0) {
+            m_actions.push_back({begin, [deltaHz](DisturbanceState& s) { s.frequencyOffsetHz += deltaHz; }});
+            break;
+        }
+        // 샘플마다 기울기로 적분하고, 끝에서 누적 오차 없이 목표값으로 맞춤
+        const double slope = deltaHz / std::chrono::duration_cast<utils::FpSeconds>(event.duration).count();
+        auto startOffset = std::make_shared<double>(0.0);
+        m_actions.push_back({begin, [slope, startOffset](DisturbanceState& s) {
+            *startOffset = s.frequencyOffsetHz;
+            s.frequencySlopeHzPerSec += slope;
+        }});
+        m_actions.push_back({end, [slope, deltaHz, startOffset](DisturbanceState& s) {
+            s.frequencySlopeHzPerSec -= slope;
+            s.frequencyOffsetHz = *startOffset + deltaHz;
+        }});
+        break;
+    }
+    case EventType::PhaseJump: {
+        const double radians = utils::degreesToRadians(event.degrees);
+        m_actions.push_back({begin, [phases, radians](DisturbanceState& s) {
+            forEachPhase(phases, [&](int p) { s.voltagePhaseOffset[p] += radians; });
+        }});
+        break;
+    }
+    case EventType::HarmonicInjection: {
+        const HarmonicComponent harmonic = event.harmonic;
+        const bool current = event.currentTarget;
+        m_actions.push_back({begin, [harmonic, current](DisturbanceState& s) {
+            (current ? s.currentHarmonics : s.voltageHarmonics).push_back(harmonic);
+        }});
+        if(event.duration.count() > 0) {
+            m_actions.push_back({end, [harmonic, current](DisturbanceState& s) {
+                removeHarmonic(current ? s.currentHarmonics : s.voltageHarmonics, harmonic);
+            }});
+        }
+        break;
+    }
+    case EventType::UnbalanceStep: {
+        const double scale = event.scale;
+        const double radians = utils::degreesToRadians(event.degrees);
+        m_actions.push_back({begin, [phases, scale, radians](DisturbanceState& s) {
+            forEachPhase(phases, [&](int p) {
+                s.unbalanceScale[p] = scale;
+                s.voltagePhaseOffset[p] += radians;
+            });
+        }});
+        break;
+    }
+    }
+}
@@ -0,0 +1,109 @@
+#ifndef SCENARIO_SCHEDULER_H
+#define SCENARIO_SCHEDULER_H
+
+#include <QByteArray>
+#include <QString>
+#include <array>
+#include <expected>
+#include <functional>
+#include <vector>
+#include "config.h"
+#include "shared_data_types.h"
+
+// 시나리오가 신호 생성에 더하는 외란 상태
+// 시나리오가 없을 때는 항등값(배율 1, 오프셋 0)이므로 엔진은 분기 없이 항상 적용
+struct DisturbanceState {
+    std::array<double, 3> dipScale{1.0, 1.0, 1.0};         // 새그/스웰 전압 배율 (상별)
+    std::array<double, 3> unbalanceScale{1.0, 1.0, 1.0};   // 불평형 전압 크기 배율 (상별)
+    std::array<double, 3> voltagePhaseOffset{0.0, 0.0, 0.0}; // 위상 점프/불평형 위상 (라디안, 상별)
+    double frequencyOffsetHz = 0.0;                        // 기본 주파수에 더해지는 편차
+    double frequencySlopeHzPerSec = 0.0;                   // 램프 중 주파수 변화율
+    HarmonicList voltageHarmonics;                          // 주입된 전압 고조파
+    HarmonicList currentHarmonics;                          // 주입된 전류 고조파
+
+    double voltageScale(int phase) const { return dipScale[phase] * unbalanceScale[phase]; }
+};
+
+// ScenarioScheduler 클래스
+// 시뮬레이션 시간 기준 외란 타임라인(JSON)을 샘플 단위로 정확히 적용.
+// 각 이벤트는 시작/종료 동작으로 펼쳐 시간순으로 정렬해 두고,
+// 엔진은 다음 동작까지 남은 샘플 수만큼 검사 없이 생성한 뒤 applyDue()를 호출.
+// 타임라인 시간은 start() 시점을 0으로 하는 상대 시간.
+class ScenarioScheduler
+{
+public:
+    using Nanoseconds = utils::Nanoseconds;
+
+    enum class EventType {
+        Sag,               // 전압 강하 (depth: 강하 비율 0~1, duration 필수)
+        Swell,             // 전압 상승 (depth: 상승 비율, duration 필수)
+        FrequencyRamp,     // 주파수 램프 (deltaHz를 duration 동안 선형 변화, 이후 유지. duration 0이면 계단)
+        PhaseJump,         // 전압 위상 점프 (degrees, 이후 유지)
+        HarmonicInjection, // 고조파 주입 (order/magnitude/phase, duration 0이면 계속 유지)
+        UnbalanceStep      // 상별 크기 배율(scale)/위상(degrees) 계단 변경 (이후 유지)
+    };
+
+    // 상 선택 비트 (A=1, B=2, C=4)
+    static constexpr unsigned AllPhases = 0b111;
+
+    struct Event {
+        Nanoseconds time{0};
+        Nanoseconds duration{0};
+        EventType type = EventType::Sag;
+        unsigned phases = AllPhases;
+        double depth = 0.0;
+        double deltaHz = 0.0;
+        double degrees = 0.0;
+        double scale = 1.0;
+        HarmonicComponent harmonic{};
+        bool currentTarget = false; // 고조파 주입 대상 (false: 전압, true: 전류)
+    };
+
+    struct Timeline {
+        QString name;
+        std::vector<Event> events;
+    };
+
+    // JSON 형식:
+    // { "name": "...", "events": [ { "time": 1.0, "type": "sag", "depth": 0.3, "duration": 0.1, "phases": "abc" }, ... ] }
+    // 시간 단위는 초. type: sag, swell, frequencyRamp, phaseJump, harmonic, unbalance
+    static std::expected<Timeline, QString> fromJson(const QByteArray& json);
+    static std::expected<Timeline, QString> loadFile(const QString& path);
+
+    // 타임라인을 now 기준으로 예약 (이전 시나리오와 외란 상태는 초기화)
+    void start(const Timeline& timeline, Nanoseconds now);
+    // 시나리오 중단 및 외란 상태 초기화
+    void clear();
+
+    bool isActive() const;
+    const QString& name() const;
+
+    // now부터 샘플 간격 interval로 생성할 때, 다음 동작 시각 이전까지 생성할 수 있는 샘플 수 (최대 limit)
+    int samplesUntilNextAction(Nanoseconds now, Nanoseconds interval, int limit) const;
+
+    // now 이하 시각의 동작을 모두 적용. 마지막 동작을 적용했으면 true
+    bool applyDue(Nanoseconds now);
+
+    // 지금까지 적용한 동작 수 (applyDue 전후 비교로 동작 발생 여부 확인)
+    size_t appliedActionCount() const { return m_nextAction; }
+
+    // 샘플 한 개만큼 램프 진행 (기울기가 0이면 변화 없음)
+    void advance(double dtSeconds) { m_state.frequencyOffsetHz += m_state.frequencySlopeHzPerSec * dtSeconds; }
+
+    const DisturbanceState& state() const { return m_state; }
+
+private:
+    struct Action {
+        Nanoseconds time;
+        std::function<void(DisturbanceState&)> apply;
+    };
+
+    void schedule(const Event& event, Nanoseconds origin);
+
+    QString m_name;
+    std::vector<Action> m_actions; // 시간순 정렬
+    size_t m_nextAction = 0;
+    DisturbanceState m_state;
+};
+
+#endif // SCENARIO_SCHEDULER_H
@@ -8,6 +8,7 @@
 #include <QTableWidget>
 #include <QSpinBox>
 #include <QDoubleSpinBox>
+#include <QComboBox>
 #include <QLabel>
 #include <QGroupBox>
 #include <QHBoxLayout>
@@ -105,9 +106,16 @@ void SettingsDialog::setupUi()
     m_graphWidthSpinBox->setSingleStep(0.1);
     m_graphWidthSpinBox->setDecimals(2);
 
+    auto demandIntervalLabel = new QLabel("수요 구간");
+    m_demandIntervalComboBox = new QComboBox();
+    for(int minutes : config::Demand::IntervalMinutes) {
+        m_demandIntervalComboBox->addItem(QString("%1 min").arg(minutes), minutes);
+    }
+
     auto formLayout = new QFormLayout();
     formLayout->addRow(detailsLabel, m_maxDataSizeSpinBox);
     formLayout->addRow(graphWidthLabel, m_graphWidthSpinBox);
+    formLayout->addRow(demandIntervalLabel, m_demandIntervalComboBox);
 
     auto detailsGroupBox = new QGroupBox("상세 설정");
     detailsGroupBox->setLayout(formLayout);
@@ -137,6 +145,7 @@ int SettingsDialog::openWithValues(const ControlPanelState& state)
 {
     m_maxDataSizeSpinBox->setValue(state.simulation.maxDataSize);
     m_graphWidthSpinBox->setValue(state.view.graphWidth);
+    m_demandIntervalComboBox->setCurrentIndex(m_demandIntervalComboBox->findData(state.simulation.demandIntervalMinutes));
     refreshPresetList();
     updateUiStates();
 
@@ -152,6 +161,10 @@ double SettingsDialog::getGraphWidth() const
 {
     return m_graphWidthSpinBox->value();
 }
+int SettingsDialog::getDemandInterval() const
+{
+    return m_demandIntervalComboBox->currentData().toInt();
+}
 SettingsDialog::DialogResult SettingsDialog::getResultState() const
 {
     return m_resultState;
@@ -327,7 +340,7 @@ void SettingsDialog::updateUiStates()
 void SettingsDialog::accept()
 {
     if(m_controller) {
-        emit settingsApplied(m_maxDataSizeSpinBox->value(), m_graphWidthSpinBox->value());
+        emit settingsApplied(m_maxDataSizeSpinBox->value(), m_graphWidthSpinBox->value(), getDemandInterval());
     }
     m_resultState = DialogResult::Accepted; // 상태를 ok 눌림으로 설정
     QDialog::accept();
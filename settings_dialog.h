@@ -13,6 +13,7 @@ class QPushButton;
 class QTableWidget;
 class QSpinBox;
 class QDoubleSpinBox;
+class QComboBox;
 class QGroupBox;
 
 struct PresetPreviewData; // Controller와 데이터를 주고받을 구조체
@@ -32,6 +33,7 @@ public:
 
     int getMaxSize() const;
     double getGraphWidth() const;
+    int getDemandInterval() const;
 
 signals:
     // Controller에게 작업을 요청하는 시그널들
@@ -39,7 +41,7 @@ signals:
     void loadPresetRequested(const QString& presetName);
     void deletePresetRequested(const QString& presetName);
     void renamePresetRequested(const QString& oldName, const QString& newName);
-    void settingsApplied(int maxDataSize, double graphWidth);
+    void settingsApplied(int maxDataSize, double graphWidth, int demandIntervalMinutes);
     void presetLoaded();
 
 public slots:
@@ -66,6 +68,7 @@ private:
     QTableWidget* m_previewTableWidget;
     QSpinBox* m_maxDataSizeSpinBox;
     QDoubleSpinBox* m_graphWidthSpinBox;
+    QComboBox* m_demandIntervalComboBox;
     QPushButton* m_okButton;
     QPushButton* m_cancelButton;
     QGroupBox* m_previewGroupBox;
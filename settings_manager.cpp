@@ -1,19 +1,180 @@
 #include "settings_manager.h"
 
+namespace {
+    // PRAGMA user_version
+    // 0: value TEXT 열 (모든 값을 문자열로 저장)
+    // 1: value 열에 타입 친화도 없음 (INTEGER/REAL/TEXT를 그대로 저장)
+    constexpr int SchemaVersion = 1;
+
+    constexpr const char* CreateSettingsTable =
+        "CREATE TABLE IF NOT EXISTS Settings ("
+        " preset_name TEXT NOT NULL,"
+        " key TEXT NOT NULL,"
+        " value NOT NULL,"
+        " PRIMARY KEY (preset_name, key)"
+        ") WITHOUT ROWID;";
+
+    // 값 열을 타입별 열로 나눠 읽음 (어느 타입인지 typeof로 판별)
+    constexpr const char* SelectColumns =
+        "CASE WHEN typeof(value) = 'integer' THEN value END,"
+        " CASE WHEN typeof(value) = 'real' THEN value END,"
+        " CASE WHEN typeof(value) IN ('text', 'blob') THEN CAST(value AS TEXT) END";
+
+    SettingsManager::Value columnsToValue(std::optional<long long> integer, std::optional<double> real, std::optional<std::string> text) {
+        if(integer) return *integer;
+        if(real) return *real;
+        return text.value_or(std::string{});
+    }
+}
+
+// 프리셋 전환 시마다 SQL 파싱을 반복하지 않도록 생성자에서 한 번만 준비
+struct SettingsManager::PreparedStatements {
+    sqlite::database_binder insertSetting;
+    sqlite::database_binder selectSetting;
+    sqlite::database_binder selectPreset;
+};
+
 SettingsManager::SettingsManager(std::string_view dp_path) : db(std::string(dp_path)) {
     try {
-        // Settings 테이블이 없으면 새로  생성
-        db << "CREATE TABLE IF NOT EXISTS Settings ("
-              " preset_name TEXT NOT NULL,"
-              " key TEXT NOT NULL,"
-              " value TEXT NOT NULL,"
-              " PRIMARY KEY (preset_name, key)"
-              ");";
+        migrateSchema();
+
+        statements();
     } catch (const std::exception& e) {
         throw std::runtime_error("데이터베이스 초기화 실패: " + std::string(e.what()));
     }
 }
 
+SettingsManager::~SettingsManager() = default;
+
+SettingsManager::PreparedStatements& SettingsManager::statements()
+{
+    if(!m_statements) {
+        m_statements = std::make_unique<PreparedStatements>(PreparedStatements{
+            db << "INSERT OR REPLACE INTO Settings (preset_name, key, value) VALUES (?, ?, ?);",
+            db << std::string("SELECT ") + SelectColumns + " FROM Settings WHERE preset_name = ? AND key = ?;",
+            db << std::string("SELECT key, ") + SelectColumns + " FROM Settings WHERE preset_name = ?;"
+        });
+        // 실행하지 않은 구문이 소멸 시 실행되지 않도록 표시
+        m_statements->insertSetting.used(true);
+        m_statements->selectSetting.used(true);
+        m_statements->selectPreset.used(true);
+    }
+    return *m_statements;
+}
+
+// 예외로 중단된 구문은 바인딩 위치와 실행 상태가 남아 다음 호출의 바인딩이 어긋나므로 버리고 다시 준비
+void SettingsManager::discardStatements()
+{
+    if(!m_statements) {
+        return;
+    }
+    // 남은 바인딩으로 소멸 시 실행되지 않도록 표시
+    m_statements->insertSetting.used(true);
+    m_statements->selectSetting.used(true);
+    m_statements->selectPreset.used(true);
+    m_statements.reset();
+}
+
+void SettingsManager::migrateSchema()
+{
+    int version = 0;
+    db << "PRAGMA user_version;" >> version;
+    if(version >= SchemaVersion) {
+        return;
+    }
+
+    int tableCount = 0;
+    db << "SELECT count(*) FROM sqlite_master WHERE type = 'table' AND name = 'Settings';" >> tableCount;
+
+    db << "BEGIN;";
+    try {
+        if(tableCount > 0) {
+            // 버전 0 테이블은 value가 TEXT 친화도라 숫자도 문자열로 변환됨 -> 친화도 없는 테이블로 복사
+            // 기존 문자열 값은 그대로 두고 읽을 때 해석 (presetValue/loadSetting)
+            db << "ALTER TABLE Settings RENAME TO Settings_v0;";
+            db << CreateSettingsTable;
+            db << "INSERT INTO Settings (preset_name, key, value) SELECT preset_name, key, value FROM Settings_v0;";
+            db << "DROP TABLE Settings_v0;";
+        } else {
+            db << CreateSettingsTable;
+        }
+        db << "PRAGMA user_version = " + std::to_string(SchemaVersion) + ";";
+        db << "COMMIT;";
+    } catch(...) {
+        db << "ROLLBACK;";
+        throw;
+    }
+}
+
+std::expected<SettingsManager::Preset, SettingsManager::Error> SettingsManager::loadPreset(std::string_view preset_name)
+{
+    try {
+        Preset preset;
+        statements().selectPreset << std::string(preset_name) >>
+            [&](std::string key, std::optional<long long> integer, std::optional<double> real, std::optional<std::string> text) {
+                preset.emplace(std::move(key), columnsToValue(integer, real, std::move(text)));
+            };
+        return preset;
+    } catch(const std::exception& e) {
+        discardStatements();
+        return std::unexpected("프리셋 불러오기 실패: " + std::string(e.what()));
+    }
+}
+
+std::expected<void, SettingsManager::Error> SettingsManager::savePreset(std::string_view preset_name, const Preset& values)
+{
+    try {
+        const std::string name(preset_name);
+        // 키마다 자동 커밋(fsync)하지 않도록 트랜잭션 하나로 묶음
+        db << "BEGIN;";
+        try {
+            auto& insert = statements().insertSetting;
+            for(const auto& [key, value] : values) {
+                insert << name << key;
+                std::visit([&](const auto& v) { insert << v; }, value);
+                insert++;
+            }
+            db << "COMMIT;";
+        } catch(...) {
+            db << "ROLLBACK;";
+            throw;
+        }
+        return {};
+    } catch(const std::exception& e) {
+        discardStatements();
+        return std::unexpected("프리셋 저장 실패: " + std::string(e.what()));
+    }
+}
+
+std::expected<void, SettingsManager::Error> SettingsManager::saveValue(std::string_view preset_name, std::string_view key, const Value& value)
+{
+    try {
+        auto& insert = statements().insertSetting;
+        insert << std::string(preset_name) << std::string(key);
+        std::visit([&](const auto& v) { insert << v; }, value);
+        insert++;
+        return {}; // 성공 시 void를 의미하는 빈 객체 반환
+    } catch(const std::exception& e) {
+        discardStatements();
+        return std::unexpected("설정 저장 실패: " + std::string(e.what()));
+    }
+}
+
+std::expected<std::optional<SettingsManager::Value>, SettingsManager::Error> SettingsManager::loadValue(std::string_view preset_name, std::string_view key)
+{
+    try {
+        std::optional<Value> result;
+        statements().selectSetting << std::string(preset_name) << std::string(key) >>
+            [&](std::optional<long long> integer, std::optional<double> real, std::optional<std::string> text) {
+                result = columnsToValue(integer, real, std::move(text));
+            };
+        return result; // 행이 없으면 nullopt
+    } catch(const std::exception& e) {
+        discardStatements();
+        return std::unexpected("설정 불러오기 실패: " + std::string(e.what()));
+    }
+}
+
 std::expected<std::vector<std::string>, SettingsManager::Error> SettingsManager::getAllPresetNames() {
     try {
         std::vector<std::string> names;
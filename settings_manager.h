@@ -3,64 +3,136 @@
 
 #include <sqlite_modern_cpp.h>
 #include <expected>
+#include <limits>
+#include <map>
+#include <memory>
+#include <optional>
 #include <sstream>
+#include <type_traits>
+#include <variant>
 
 class SettingsManager
 {
 public:
     explicit SettingsManager(std::string_view dp_path);
+    ~SettingsManager();
 
     // 반환 타입을 std::expected로 변경
     using Error = std::string;
 
-    // 설정을 저장하는 template 함수
+    // 저장 값 (정수/실수는 SQLite INTEGER/REAL 그대로, 나머지는 TEXT)
+    using Value = std::variant<long long, double, std::string>;
+    // 프리셋 하나의 전체 키-값
+    using Preset = std::map<std::string, Value, std::less<>>;
+
+    // 프리셋 전체를 SELECT 한 번으로 불러옴 (없는 프리셋이면 빈 맵)
+    std::expected<Preset, Error> loadPreset(std::string_view preset_name);
+    // 프리셋 전체를 트랜잭션 하나로 저장 (실패 시 롤백)
+    std::expected<void, Error> savePreset(std::string_view preset_name, const Preset& values);
+
+    // T를 저장 값으로 변환
     template<typename T>
-    std::expected<void, Error> saveSetting(std::string_view preset_name, std::string_view key, const T& value) {
-        try {
+    static Value toValue(const T& value) {
+        if constexpr (std::is_same_v<T, bool> || std::is_integral_v<T> || std::is_enum_v<T>) {
+            return static_cast<long long>(value);
+        } else if constexpr (std::is_floating_point_v<T>) {
+            return static_cast<double>(value);
+        } else if constexpr (std::is_convertible_v<const T&, std::string>) {
+            return std::string(value);
+        } else {
             std::stringstream ss;
             ss << value;
-            db << "INSERT OR REPLACE INTO Settings (preset_name, key, value) VALUES (?, ?, ?);"
-               << std::string(preset_name) << std::string(key) << ss.str();
-            return {}; // 성공 시 void를 의미하는 빈 객체 반환
-        } catch(const std::exception& e) {
-            return std::unexpected("설정 저장 실패: " + std::string(e.what()));
+            return ss.str();
+        }
+    }
+
+    // 프리셋 맵에서 값을 T로 꺼냄. 키가 없으면 defaultValue 반환
+    // 이전 버전 DB는 모든 값이 문자열이므로 숫자 요청 시 문자열도 해석
+    template<typename T>
+    static std::expected<T, Error> presetValue(const Preset& preset, std::string_view key, const T& defaultValue) {
+        const auto it = preset.find(key);
+        if(it == preset.end()) {
+            return defaultValue;
         }
+        return fromValue(it->second, key, defaultValue);
+    }
+
+    // 설정을 저장하는 template 함수
+    template<typename T>
+    std::expected<void, Error> saveSetting(std::string_view preset_name, std::string_view key, const T& value) {
+        return saveValue(preset_name, key, toValue(value));
     }
 
     // 설정을 불러오는 template 함수
     // 키가 존재하지 않으면 defaultValue를 반환
     template<typename T>
     std::expected<T, Error> loadSetting(std::string_view preset_name, std::string_view key, const T& defaultValue) {
-        try {
-            std::string value_str;
-            db << "SELECT value FROM Settings WHERE preset_name = ? AND key = ?;"
-               << std::string(preset_name) << std::string(key) >> value_str;
+        auto value = loadValue(preset_name, key);
+        if(!value) {
+            return std::unexpected(value.error());
+        }
+        if(!*value) {
+            return defaultValue; // 키가 없는 것은 오류가 아니므로 기본값 반환
+        }
+        return fromValue(**value, key, defaultValue);
+    }
+
+    std::expected<std::vector<std::string>, Error> getAllPresetNames();
+    std::expected<void, Error> deletePreset(std::string_view preset_name);
+    std::expected<void, Error> renamePreset(std::string_view old_name, std::string_view new_name);
+private:
+    struct PreparedStatements;
 
+    template<typename T>
+    static std::expected<T, Error> fromValue(const Value& value, std::string_view key, const T& defaultValue) {
+        if constexpr (std::is_same_v<T, std::string>) {
+            if(const auto* text = std::get_if<std::string>(&value); text && text->empty()) {
+                return defaultValue;
+            }
+            return std::visit([](const auto& v) -> std::string {
+                if constexpr (std::is_same_v<std::decay_t<decltype(v)>, std::string>) {
+                    return v;
+                } else {
+                    std::stringstream ss;
+                    ss.precision(std::numeric_limits<double>::max_digits10);
+                    ss << v;
+                    return ss.str();
+                }
+            }, value);
+        } else {
+            if constexpr (std::is_arithmetic_v<T> || std::is_enum_v<T>) {
+                if(const auto* i = std::get_if<long long>(&value)) return static_cast<T>(*i);
+                if(const auto* d = std::get_if<double>(&value)) return static_cast<T>(*d);
+            }
 
-            if(value_str.empty()) {
-                return defaultValue; // 키가 없는 것은 오류가 아니므로 기본값 반환
+            // 문자열로 저장된 값 (이전 버전 DB 또는 사용자 정의 타입)
+            const auto* text = std::get_if<std::string>(&value);
+            if(!text) {
+                return std::unexpected("'" + std::string(key) + "' 값의 타입이 맞지 않습니다.");
+            }
+            if(text->empty()) {
+                return defaultValue;
             }
 
-            T result;
-            std::stringstream ss(value_str);
+            using Parsed = std::conditional_t<std::is_enum_v<T>, long long, T>;
+            Parsed result;
+            std::stringstream ss(*text);
             ss >> result;
             if(ss.fail() || !ss.eof()) {
                 return std::unexpected("'" + std::string(key) + "' 값을 반환하는데 실패했습니다.");
             }
-            return result;
-        } catch (const sqlite::sqlite_exception&) {
-            // 행이 없는 경우(not found)는 비정상적인 상황으로 보고 기본값 반환
-            return defaultValue;
-        } catch(const std::exception& e) {
-            return std::unexpected("설정 불러오기 실패: " + std::string(e.what()));
+            return static_cast<T>(result);
         }
     }
 
-    std::expected<std::vector<std::string>, Error> getAllPresetNames();
-    std::expected<void, Error> deletePreset(std::string_view preset_name);
-    std::expected<void, Error> renamePreset(std::string_view old_name, std::string_view new_name);
-private:
+    std::expected<void, Error> saveValue(std::string_view preset_name, std::string_view key, const Value& value);
+    std::expected<std::optional<Value>, Error> loadValue(std::string_view preset_name, std::string_view key);
+    void migrateSchema();
+    PreparedStatements& statements(); // 준비된 구문 (없으면 준비)
+    void discardStatements();         // 실패한 호출 뒤 구문을 버림
+
     sqlite::database db; // 데이터베이스 객체
+    std::unique_ptr<PreparedStatements> m_statements; // 한 번 준비하고 재사용하는 구문 (실패 후에는 버리고 다시 준비)
 };
 
 #endif // SETTINGS_MANAGER_H
@@ -9,6 +9,33 @@
 
 namespace {
 constexpr int StatusBarTimeOut = 3000;
+
+// QVariant <-> DB 저장 값 변환 (숫자는 타입을 유지해 문자열 변환/파싱을 피함)
+SettingsManager::Value variantToValue(const QVariant& v)
+{
+    switch(v.typeId()) {
+    case QMetaType::Bool:
+    case QMetaType::Int:
+    case QMetaType::UInt:
+    case QMetaType::LongLong:
+    case QMetaType::ULongLong:
+        return static_cast<long long>(v.toLongLong());
+    case QMetaType::Float:
+    case QMetaType::Double:
+        return v.toDouble();
+    default:
+        return v.toString().toStdString();
+    }
+}
+
+QVariant valueToVariant(const SettingsManager::Value& value)
+{
+    return std::visit([](const auto& v) -> QVariant {
+        using T = std::decay_t<decltype(v)>;
+        if constexpr (std::is_same_v<T, std::string>) return QString::fromStdString(v);
+        else return QVariant::fromValue(v);
+    }, value);
+}
 }
 
 SettingsUiController::SettingsUiController(ControlPanel* controlPanel, SettingsManager& settingsManager, QWidget* parent)
@@ -68,24 +95,32 @@ void SettingsUiController::onRequestPresetList()
 void SettingsUiController::onRequestPresetValues(const QString& presetName)
 {
     QVariantMap previewData;
-    std::string presetStdString = presetName.toStdString();
 
-    // m_settingsMap을 순회하며 모든 키에 대해 DB값을 읽음
+    // 프리셋 전체를 한 번에 읽고 메모리에서 키별로 꺼냄
+    auto presetResult = m_settingsManager.loadPreset(presetName.toStdString());
+    if(!presetResult) {
+        qWarning() << "Failed to load preset" << presetName << ":" << QString::fromStdString(presetResult.error());
+        emit presetValuesFetched(previewData);
+        return;
+    }
+    const auto& preset = *presetResult;
+
+    // m_settingsMap을 순회하며 모든 키에 대해 값을 꺼냄
     for(const auto& [key, info] : m_settingsMap) {
 
         QVariant loadedValueAsVariant;
         const QVariant& defaultValue = info.defaultValue;
 
-        // defaultValue의 타입에 따라 loadSetting을 다르게 호출
+        // defaultValue의 타입으로 꺼냄
         if(defaultValue.typeId() == QMetaType::Int) {
-            auto result = m_settingsManager.loadSetting(presetStdString, key, defaultValue.toInt());
+            auto result = SettingsManager::presetValue(preset, key, defaultValue.toInt());
             if(result) loadedValueAsVariant = *result;
         } else if(defaultValue.typeId() == QMetaType::Double) {
-            auto result = m_settingsManager.loadSetting(presetStdString, key, defaultValue.toDouble());
+            auto result = SettingsManager::presetValue(preset, key, defaultValue.toDouble());
             if(result) loadedValueAsVariant = *result;
         } else {
             // 기본적으로 문자열로 처리 시도
-            auto result = m_settingsManager.loadSetting(presetStdString, key, defaultValue.toString().toStdString());
+            auto result = SettingsManager::presetValue(preset, key, defaultValue.toString().toStdString());
             if(result) loadedValueAsVariant = QString::fromStdString(*result);
         }
 
@@ -108,7 +143,7 @@ void SettingsUiController::onRequestPresetValues(const QString& presetName)
     }
 
     // maxDataSize 별도 처리
-    auto maxDataSizeRes = m_settingsManager.loadSetting(presetName.toStdString(), "maxDataSize", config::Simulation::DataSize::DefaultDataSize);
+    auto maxDataSizeRes = SettingsManager::presetValue(preset, "maxDataSize", config::Simulation::DataSize::DefaultDataSize);
     if(maxDataSizeRes) {
         previewData["저장 크기"] = *maxDataSizeRes;
     }
@@ -116,7 +151,7 @@ void SettingsUiController::onRequestPresetValues(const QString& presetName)
     emit presetValuesFetched(previewData);
 }
 
-void SettingsUiController::onApplyDialogSettings(const int maxDatasize, const double graphWidth)
+void SettingsUiController::onApplyDialogSettings(const int maxDatasize, const double graphWidth, const int demandIntervalMinutes)
 {
     // 데이터 유실 확인
     if(!requestMaxSizeChange(maxDatasize)) return;
@@ -126,6 +161,12 @@ void SettingsUiController::onApplyDialogSettings(const int maxDatasize, const do
 
     emit setMaxDataSize(maxDatasize);
     emit setGraphWidth(graphWidth);
+
+    // 수요 구간이 바뀌면 누적 수요와 최대 수요가 초기화되므로 같은 값이면 보내지 않음
+    if(m_state.simulation.demandIntervalMinutes != demandIntervalMinutes) {
+        m_state.simulation.demandIntervalMinutes = demandIntervalMinutes;
+        emit setDemandInterval(demandIntervalMinutes);
+    }
 }
 
 void SettingsUiController::onAmplitudeChanged(double value)
@@ -258,6 +299,7 @@ void SettingsUiController::initializeSettingsMap()
     bind("samplesPerCycle", m_state.simulation.samplesPerCycle, &SettingsUiController::setSamplesPerCycle, config::Sampling::DefaultSamplesPerCycle, "cycle당 sample");
     bind("graphWidthSec", m_state.view.graphWidth, &SettingsUiController::setGraphWidth, config::Simulation::GraphWidth::Default, "그래프 시간 폭");
     bind("updateMode", m_state.simulation.updateMode, &SettingsUiController::setUpdateMode, 2, "갱신 모드");
+    bind("demandIntervalMinutes", m_state.simulation.demandIntervalMinutes, &SettingsUiController::setDemandInterval, config::Demand::DefaultIntervalMinutes, "수요 구간 (분)");
 
     // 3상 관련 설정
     bind("voltageBAmplitude", m_state.threePhase.voltageBAmplitude, &SettingsUiController::setVoltageBAmplitude, config::Source::ThreePhase::DefaultAmplitudeB, "B상 전압 크기");
@@ -310,10 +352,17 @@ bool SettingsUiController::requestMaxSizeChange(int newSize)
 
 std::expected<void, std::string> SettingsUiController::applySettingsToEngine(std::string_view presetName)
 {
+    // 프리셋 전체를 SELECT 한 번으로 읽음
+    auto presetResult = m_settingsManager.loadPreset(presetName);
+    if(!presetResult) {
+        return std::unexpected(presetResult.error());
+    }
+    const auto& preset = *presetResult;
+
     m_blockUiSignals = true; // 프리셋 적용 시 슬롯 호출 잠시 무시
 
     // 미리 최대 데이터 크기 변경 요청
-    if(auto res = m_settingsManager.loadSetting(presetName, "maxDataSize", m_state.simulation.maxDataSize); res) {
+    if(auto res = SettingsManager::presetValue(preset, "maxDataSize", m_state.simulation.maxDataSize); res) {
         if(requestMaxSizeChange(*res)) {
             m_state.simulation.maxDataSize = *res;
             emit setMaxDataSize(*res);
@@ -326,21 +375,11 @@ std::expected<void, std::string> SettingsUiController::applySettingsToEngine(std
         return std::unexpected(res.error());
     }
 
-    // 맵을 순회하면 DB에서 값을 불러와 각 Property에 적용
+    // 맵을 순회하며 불러온 값을 각 Property에 적용
     for(auto const& [key, info] : m_settingsMap) {
-        // 1. DB에서 값을 문자열로 불러옴
-        std::string defaultValueStr = info.defaultValue.toString().toStdString();
-
-        auto loadResult = m_settingsManager.loadSetting(presetName, key, defaultValueStr);
-
-        if(!loadResult) {
-            // 실패 시, 에러를 그대로 반환
-            m_blockUiSignals = false;
-            return std::unexpected(loadResult.error());
-        }
-
-        // 2. 불러온 문자열을 QVariant로 변환
-        QVariant loadedValue(QString::fromStdString(*loadResult));
+        // 1. 저장된 값을 QVariant로 변환 (없으면 기본값)
+        const auto it = preset.find(key);
+        QVariant loadedValue = (it != preset.end()) ? valueToVariant(it->second) : info.defaultValue;
 
         // 위상은 Degree -> Radian 변환
         if(info.isAngle) {
@@ -353,13 +392,13 @@ std::expected<void, std::string> SettingsUiController::applySettingsToEngine(std
         info.setter(loadedValue);
     }
     // 고조파 리스트 로드
-    auto voltageRes = m_settingsManager.loadSetting(presetName, "voltageHarmonicsJson", std::string(""));
+    auto voltageRes = SettingsManager::presetValue(preset, "voltageHarmonicsJson", std::string(""));
     if(voltageRes) {
         const auto& voltageList = UIutils::jsonToHarmonicList(QString::fromStdString(*voltageRes));
         m_state.harmonics.voltageList = voltageList;
         emit setVoltageHarmonics(voltageList);
     }
-    auto currentRes = m_settingsManager.loadSetting(presetName, "currentHarmonicsJson", std::string(""));
+    auto currentRes = SettingsManager::presetValue(preset, "currentHarmonicsJson", std::string(""));
     if(currentRes) {
         const auto& currentList = UIutils::jsonToHarmonicList(QString::fromStdString(*currentRes));
         m_state.harmonics.currentList = currentList;
@@ -375,7 +414,8 @@ std::expected<void, std::string> SettingsUiController::applySettingsToEngine(std
 
 std::expected<void, std::string> SettingsUiController::saveEngineToSettings(std::string_view presetName)
 {
-    // 맵을 순회하며 각 getter를 호출하여 값을 DB에 저장
+    // 맵을 순회하며 각 getter를 호출하여 값을 모은 뒤 트랜잭션 하나로 저장
+    SettingsManager::Preset preset;
     for(auto const& [key, info] : m_settingsMap) {
         // 1. Getter로 현재 값을 QVariant로 가져옴
         QVariant valueToSave = info.getter();
@@ -388,22 +428,19 @@ std::expected<void, std::string> SettingsUiController::saveEngineToSettings(std:
         }
 
         // 2. QVariant를 DB에 저장할 수 있는 형태로 변환
-        std::string valueStr = valueToSave.toString().toStdString();
-
-        // 3. DB에 저장
-        auto result  = m_settingsManager.saveSetting(presetName, key, valueStr);
-
-        if(!result) return result; // 오류 발생 시 즉시 전파
+        preset[key] = variantToValue(valueToSave);
     }
     // 고조파 리스트 저장
     QString voltageJson = UIutils::harmonicListToJson(m_state.harmonics.voltageList);
     QString currentJson = UIutils::harmonicListToJson(m_state.harmonics.currentList);
 
-    if(auto res = m_settingsManager.saveSetting(presetName, "voltageHarmonicsJson", voltageJson.toStdString()); !res) return res;
-    if(auto res = m_settingsManager.saveSetting(presetName, "currentHarmonicsJson", currentJson.toStdString()); !res) return res;
+    preset["voltageHarmonicsJson"] = voltageJson.toStdString();
+    preset["currentHarmonicsJson"] = currentJson.toStdString();
 
     // UI와 별개인 엔진 파라미터들도 저장
-    if(auto res = m_settingsManager.saveSetting(presetName, "maxDataSize", m_state.simulation.maxDataSize); !res) return res;
+    preset["maxDataSize"] = SettingsManager::toValue(m_state.simulation.maxDataSize);
+
+    if(auto res = m_settingsManager.savePreset(presetName, preset); !res) return res;
 
     m_parent->findChild<QStatusBar*>()->showMessage(QString("'%1' 이름으로 설정을 저장했습니다.").arg(QString::fromUtf8(presetName.data(), presetName.size())), StatusBarTimeOut);
     return {};
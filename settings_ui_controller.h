@@ -57,6 +57,7 @@ signals:
     void requestCaptureIntervalUpdate();
     void setMaxDataSize(int size);
     void setGraphWidth(double width);
+    void setDemandInterval(int minutes);
     void enableTracking(bool enabled);
 
     // FrequencyTracker 접근 시그널
@@ -73,7 +74,7 @@ public slots:
     // SettingsDialog가 프리셋 목록이나 상세 값을 요청할 때 호출될 슬롯
     void onRequestPresetList();
     void onRequestPresetValues(const QString& presetName);
-    void onApplyDialogSettings(const int maxDatasize, const double graphWidth);
+    void onApplyDialogSettings(const int maxDatasize, const double graphWidth, const int demandIntervalMinutes);
 
     // ControlPanel의 실시간 변경에 반응하는 슬롯들
     void onAmplitudeChanged(double value);
@@ -1,6 +1,8 @@
 #include "simulation_engine.h"
 #include "analysis_utils.h"
 #include <QDebug>
+#include <array>
+#include <numbers>
 
 SimulationEngine::SimulationEngine()
     : QObject()
@@ -9,6 +11,7 @@ SimulationEngine::SimulationEngine()
     , m_simulationTimeNs(0)
     , m_accumulatedTimeNs(0)
     , m_sampleCounterForUpdate(0)
+    , m_harmonicGroupAnalysisEnabled(false)
     , m_oneSecondBlockStartTime(0)
     , m_totalEngeryWh(0.0)
 
@@ -36,6 +39,10 @@ SimulationEngine::SimulationEngine()
     , m_current_B_phase_deg(config::Source::ThreePhase::DefaultCurrentPhaseB_deg, this)
     , m_current_C_amplitude(config::Source::ThreePhase::DefaultCurrentAmplitudeC, this)
     , m_current_C_phase_deg(config::Source::ThreePhase::DefaultCurrentPhaseC_deg, this)
+
+    // --- 전력품질 검출, 계측 전단 (선언 순서) ---
+    , m_eventDetector(EventChannelCount)
+    , m_adcFrontEnd(config::Adc::DefaultSeed)
 {
     // --- 시뮬레이션 파라미터 초기화 ---
 
@@ -48,6 +55,14 @@ SimulationEngine::SimulationEngine()
     // --- 나머지 초기화 로직 ---
     using namespace std::chrono_literals;
 
+    // 스레드 간 큐 연결로 전달되는 스냅샷 타입 등록
+    qRegisterMetaType<OneSecondSummarySnapshot>();
+    qRegisterMetaType<MeasuredDataSnapshot>();
+    qRegisterMetaType<VoltageEvent>();
+    qRegisterMetaType<HarmonicGroupResult>();
+    qRegisterMetaType<SampleHistory>();
+    qRegisterMetaType<SampleHistorySnapshot>();
+
     m_captureTimer = new QChronoTimer(this); // 부모 설정
     m_captureTimer->setTimerType(Qt::PreciseTimer);
     recalculateCaptureInterval(); // m_captureIntervalNs 초기 계산
@@ -56,12 +71,59 @@ SimulationEngine::SimulationEngine()
     // FrequencyTracker 생성 및 시그널 연결
     m_frequencyTracker = std::make_unique<FrequencyTracker>(this, this);
     connect(m_frequencyTracker.get(), &FrequencyTracker::samplingCyclesUpdated, &m_samplingCycles, qOverload<const double&>(&Property<double>::setValue));
+
+    // 다단계 집계 엔진 생성 (엔진과 같은 스레드로 이동하도록 부모 설정)
+    m_aggregationEngine = std::make_unique<AggregationEngine>(this);
+    m_aggregationEngine->setNominalFrequency(m_frequency.value());
+    m_harmonicGroupAnalyzer = std::make_unique<HarmonicGroupAnalyzer>(this);
+
+    // 전압 이벤트 검출기: 끝난 이벤트를 알리고, 이벤트가 걸친 집계 구간에 플래그
+    m_eventDetector.setSamplesPerCycle(m_samplesPerCycle.value());
+    m_transientRecorder.setSamplesPerCycle(m_samplesPerCycle.value());
+    m_resampler.configure(m_samplesPerCycle.value());
+    m_transientRecorder.setFundamentalFrequency(m_frequency.value());
+    m_eventDetector.setEventCallback([this](const VoltageEvent& event) {
+        m_aggregationEngine->flagCurrentInterval();
+        emit voltageEventDetected(event);
+    });
+    updateEventNominalVoltages();
+    connect(&m_samplesPerCycle, qOverload<const int&>(&Property<int>::valueChanged), this, [this](const int& samples) {
+        m_eventDetector.setSamplesPerCycle(samples);
+        m_transientRecorder.setSamplesPerCycle(samples);
+        m_resampler.configure(samples);
+    });
+    for(auto* amplitude : {&m_amplitude, &m_voltage_B_amplitude, &m_voltage_C_amplitude}) {
+        connect(amplitude, qOverload<const double&>(&Property<double>::valueChanged), this, &SimulationEngine::updateEventNominalVoltages);
+    }
+
+    // 플리커미터: 계통 주파수가 바뀌면 LPF 차단 주파수(35/42Hz) 재설정
+    // 과도 캡처: dv/dt 트리거 레벨(기본파 최대 기울기 기준) 재계산
+    m_flickermeter.reset();
+    connect(&m_frequency, qOverload<const double&>(&Property<double>::valueChanged), this, [this](const double& frequency) {
+        m_flickermeter.configure(m_samplingCycles.value() * m_samplesPerCycle.value(), frequency);
+        m_transientRecorder.setFundamentalFrequency(frequency);
+        m_aggregationEngine->setNominalFrequency(frequency);
+        m_adcFrontEnd.setTiming(m_samplingCycles.value() * m_samplesPerCycle.value(), frequency);
+    });
 }
 
 // ---- public -----
 bool SimulationEngine::isRunning() const { return m_captureTimer->isActive(); }
+
+void SimulationEngine::runFor(Nanoseconds duration)
+{
+    // 추적기가 샘플링 주파수를 바꿀 수 있으므로 한 샘플씩 진행
+    const Nanoseconds endTime = m_simulationTimeNs + duration;
+    while(m_simulationTimeNs < endTime) {
+        generateSamples(1);
+    }
+}
 int SimulationEngine::getDataSize() const { return m_data.size(); }
 FrequencyTracker* SimulationEngine::getFrequencyTracker() const { return m_frequencyTracker.get(); }
+AggregationEngine* SimulationEngine::getAggregationEngine() const { return m_aggregationEngine.get(); }
+HarmonicGroupAnalyzer* SimulationEngine::getHarmonicGroupAnalyzer() const { return m_harmonicGroupAnalyzer.get(); }
+const VoltageEventDetector& SimulationEngine::getVoltageEventDetector() const { return m_eventDetector; }
+TransientRecorder& SimulationEngine::getTransientRecorder() { return m_transientRecorder; }
 // -----------------
 
 // ---- public slots ----
@@ -91,9 +153,7 @@ void SimulationEngine::onMaxDataSizeChanged(int newSize)
     while(m_data.size() > static_cast<size_t>(newSize)) {
         m_data.pop_front();
     }
-    while(m_measuredData.size() > static_cast<size_t>(newSize)) {
-        m_measuredData.pop_front();
-    }
+    trimMeasuredData();
 
     emit dataUpdated(m_data);
     emit measuredDataUpdated(m_measuredData);
@@ -124,6 +184,11 @@ void SimulationEngine::recalculateCaptureInterval()
     } else {
         m_captureIntervalsNs = FpNanoseconds(1.0e9);
     }
+    m_flickermeter.configure(totalSamplesPerSecond, m_frequency.value());
+    m_adcFrontEnd.setTiming(totalSamplesPerSecond, m_frequency.value());
+
+    // 생성 중 간격이 바뀌면 시나리오 동작까지의 샘플 수가 달라지므로 현재 구간을 이 샘플에서 끊음
+    m_segmentSamplesLeft = std::min(m_segmentSamplesLeft, 1);
 
     updateCaptureTimer();
 }
@@ -155,6 +220,22 @@ void SimulationEngine::enableFrequencyTracking(bool enabled)
     }
 }
 
+void SimulationEngine::setFrequencyTrackingMethod(FrequencyTracker::TrackingMethod method)
+{
+    m_frequencyTracker->setTrackingMethod(method);
+}
+
+void SimulationEngine::enableHarmonicGroupAnalysis(bool enabled)
+{
+    m_harmonicGroupAnalysisEnabled = enabled;
+    m_harmonicGroupAnalyzer->reset();
+}
+
+void SimulationEngine::enableQualityMeasurements(bool enabled)
+{
+    m_qualityMeasurementsEnabled = enabled;
+}
+
 void SimulationEngine::updateFrequencyTrackerCoefficients(const FrequencyTracker::PidCoefficients& fll, const FrequencyTracker::PidCoefficients& zc)
 {
     if(m_frequencyTracker) {
@@ -163,6 +244,53 @@ void SimulationEngine::updateFrequencyTrackerCoefficients(const FrequencyTracker
     }
 }
 
+void SimulationEngine::startScenario(const ScenarioScheduler::Timeline& timeline)
+{
+    m_scenario.start(timeline, m_simulationTimeNs);
+    // 0초 이벤트는 다음 샘플 전에 바로 적용
+    if(m_scenario.applyDue(m_simulationTimeNs)) {
+        emit scenarioFinished(timeline.name);
+    }
+    if(m_scenario.appliedActionCount() > 0) {
+        m_transientRecorder.triggerExternal();
+    }
+    qDebug() << "Scenario started:" << timeline.name << "events:" << timeline.events.size();
+}
+
+void SimulationEngine::stopScenario()
+{
+    m_scenario.clear();
+}
+
+void SimulationEngine::enableAdcFrontEnd(bool enabled)
+{
+    if(enabled && !m_adcFrontEndEnabled) {
+        m_adcFrontEnd.reset();
+    }
+    m_adcFrontEndEnabled = enabled;
+}
+
+void SimulationEngine::setAdcFrontEndSettings(const AdcFrontEnd::Settings& settings)
+{
+    m_adcFrontEnd.setSettings(settings);
+}
+
+void SimulationEngine::setHistoryStorage(SampleHistory::Storage storage)
+{
+    m_data.setStorage(storage);
+    emit dataUpdated(m_data);
+}
+
+void SimulationEngine::enableSynchronousResampling(bool enabled)
+{
+    m_resamplingEnabled = enabled;
+}
+
+void SimulationEngine::setResamplingKernel(SynchronousResampler::Kernel kernel)
+{
+    m_resampler.setKernel(kernel);
+}
+
 // -----------------------
 
 
@@ -182,38 +310,101 @@ void SimulationEngine::captureData()
     // 안전장치. 설정 오류 등으로 샘플이 폭주하는 것을 방지
     if(samplesToGenerate > 10000) samplesToGenerate = 10000;
 
-    // 배치 루프 수행
-    for(int i{0}; i < samplesToGenerate; ++i) {
-        PhaseData currentVoltage = calculateCurrentVoltage();
-        PhaseData currentAmperage = calculateCurrentAmperage();
-        addNewDataPoint(currentVoltage, currentAmperage);
-
+    generateSamples(samplesToGenerate);
+}
 
-        // 사이클 계산을 위해 버퍼 채우기
-        m_cycleSampleBuffer.push_back(m_data.back());
-        if(m_cycleSampleBuffer.size() > static_cast<size_t>(m_samplesPerCycle.value())) {
-            m_cycleSampleBuffer.erase(m_cycleSampleBuffer.begin());
+void SimulationEngine::generateSamples(int count)
+{
+    // 다음 시나리오 동작 직전까지를 한 구간으로 묶어, 구간 안에서는 이벤트 검사 없이 생성.
+    // 추적기가 샘플 간격을 바꾸면 recalculateCaptureInterval()이 구간을 끊어 다시 계산
+    int remaining = count;
+    while(remaining > 0) {
+        const auto interval = std::chrono::duration_cast<Nanoseconds>(m_captureIntervalsNs);
+        const int segment = m_scenario.samplesUntilNextAction(m_simulationTimeNs, interval, remaining);
+
+        m_segmentSamplesLeft = segment;
+        int generated = 0;
+        while(m_segmentSamplesLeft > 0) {
+            generateSample();
+            --m_segmentSamplesLeft;
+            ++generated;
         }
+        remaining -= generated;
 
-        // 주파수, 위상 자동 추적
-        m_frequencyTracker->process(m_data.back(), m_measuredData.empty() ? MeasuredData{} : m_measuredData.back(), m_cycleSampleBuffer);
+        // 동작 시각에 도달한 샘플 직전에 적용하고, 그 샘플을 과도 캡처의 외부 트리거로 표시
+        const size_t appliedBefore = m_scenario.appliedActionCount();
+        if(m_scenario.applyDue(m_simulationTimeNs)) {
+            emit scenarioFinished(m_scenario.name());
+        }
+        if(m_scenario.appliedActionCount() != appliedBefore) {
+            m_transientRecorder.triggerExternal();
+        }
+    }
+}
 
-        // 사이클이 꽉 찼으면 사이클 단위 연산 수행
-        if(m_cycleSampleBuffer.size() >= static_cast<size_t>(m_samplesPerCycle.value())) {
-            calculateCycleData();
+void SimulationEngine::generateSample()
+{
+    PhaseData currentVoltage = calculateCurrentVoltage();
+    PhaseData currentAmperage = calculateCurrentAmperage();
+    if(m_adcFrontEndEnabled) {
+        AdcFrontEnd::Frame frame = {
+            currentVoltage.a, currentVoltage.b, currentVoltage.c,
+            currentAmperage.a, currentAmperage.b, currentAmperage.c
+        };
+        m_adcFrontEnd.process(frame);
+        currentVoltage.a = frame[AdcFrontEnd::VoltageA];
+        currentVoltage.b = frame[AdcFrontEnd::VoltageB];
+        currentVoltage.c = frame[AdcFrontEnd::VoltageC];
+        currentAmperage.a = frame[AdcFrontEnd::CurrentA];
+        currentAmperage.b = frame[AdcFrontEnd::CurrentB];
+        currentAmperage.c = frame[AdcFrontEnd::CurrentC];
+    }
+    // 분석은 이력 저장 형식과 무관하게 double 원본으로
+    const DataPoint& latest = addNewDataPoint(currentVoltage, currentAmperage);
+
+    if(m_qualityMeasurementsEnabled) {
+        // 반주기 RMS 및 이벤트 검출 (상태 기계는 반주기마다만 실행)
+        const std::array<double, EventChannelCount> eventFrame = {
+            latest.voltage.a, latest.voltage.b, latest.voltage.c,
+            latest.voltage_ll.ab, latest.voltage_ll.bc, latest.voltage_ll.ca
+        };
+        if(m_eventDetector.process(latest.timestamp, eventFrame) && m_eventDetector.isEventActive()) {
+            m_aggregationEngine->flagCurrentInterval();
         }
+        m_flickermeter.process({latest.voltage.a, latest.voltage.b, latest.voltage.c});
+        m_transientRecorder.process(latest.timestamp, {
+            latest.voltage.a, latest.voltage.b, latest.voltage.c,
+            latest.current.a, latest.current.b, latest.current.c
+        });
+    }
 
-        // 다음 스텝을 위해 현재 진행 위상 업데이트
-        const double phaseDelta = config::Math::TwoPi * m_frequency.value() * (std::chrono::duration_cast<FpSeconds>(m_captureIntervalsNs)).count();
-        m_currentPhaseRadians = std::fmod(m_currentPhaseRadians + phaseDelta, config::Math::TwoPi);
+    // 사이클 계산을 위해 버퍼 채우기
+    m_cycleSampleBuffer.push_back(latest);
+    m_resampler.push(latest);
+    if(m_cycleSampleBuffer.size() > static_cast<size_t>(m_samplesPerCycle.value())) {
+        m_cycleSampleBuffer.erase(m_cycleSampleBuffer.begin());
+    }
 
-        // UI 갱신 및 사이클 계산을 위한 누적 위상 업데이트
-        ++m_sampleCounterForUpdate;
+    // 주파수, 위상 자동 추적
+    m_frequencyTracker->process(latest, m_measuredData.empty() ? MeasuredData{} : m_measuredData.back(), m_cycleSampleBuffer);
 
-        // 누적된 위상을 보고 Mode에 맞춰 업데이트
-        processUpdateByMode(true); // 누적 위상 리셋
-        advanceSimulationTime();
+    // 사이클이 꽉 찼으면 사이클 단위 연산 수행
+    if(m_cycleSampleBuffer.size() >= static_cast<size_t>(m_samplesPerCycle.value())) {
+        calculateCycleData();
     }
+
+    // 다음 스텝을 위해 현재 진행 위상 업데이트 (시나리오 주파수 편차 포함)
+    const double dtSeconds = (std::chrono::duration_cast<FpSeconds>(m_captureIntervalsNs)).count();
+    const double phaseDelta = config::Math::TwoPi * (m_frequency.value() + m_scenario.state().frequencyOffsetHz) * dtSeconds;
+    m_currentPhaseRadians = std::fmod(m_currentPhaseRadians + phaseDelta, config::Math::TwoPi);
+    m_scenario.advance(dtSeconds);
+
+    // UI 갱신 및 사이클 계산을 위한 누적 위상 업데이트
+    ++m_sampleCounterForUpdate;
+
+    // 누적된 위상을 보고 Mode에 맞춰 업데이트
+    processUpdateByMode(true); // 누적 위상 리셋
+    advanceSimulationTime();
 }
 
 void SimulationEngine::handleMaxDataSizeChange(int newSize)
@@ -221,15 +412,21 @@ void SimulationEngine::handleMaxDataSizeChange(int newSize)
     while(m_data.size() > static_cast<size_t>(newSize)) {
         m_data.pop_front();
     }
-    while(m_measuredData.size() > static_cast<size_t>(newSize)) {
-        m_measuredData.pop_front();
-    }
+    trimMeasuredData();
     emit dataUpdated(m_data);
 }
 // -----------------------
 
 
 // ---- private 함수들 ----
+void SimulationEngine::trimMeasuredData()
+{
+    const size_t capacity = static_cast<size_t>(std::min(m_maxDataSize.value(), config::Simulation::MeasuredDataSize));
+    while(m_measuredData.size() > capacity) {
+        m_measuredData.pop_front();
+    }
+}
+
 void SimulationEngine::advanceSimulationTime()
 {
     m_simulationTimeNs += std::chrono::duration_cast<Nanoseconds>(m_captureIntervalsNs);
@@ -244,18 +441,26 @@ PhaseData SimulationEngine::calculateCurrentVoltage() const
     const double fundamentalPhase = m_currentPhaseRadians + m_phaseRadians.value();
     const auto& harmonics = m_voltageHarmonic.value();
 
+    // 시나리오 외란 (없으면 배율 1, 오프셋 0, 주입 고조파 없음)
+    const auto& disturbance = m_scenario.state();
+    const auto& injected = disturbance.voltageHarmonics;
+
     // A상
-    result.a = calculatePhaseData(m_amplitude.value(), fundamentalPhase, harmonics);
+    const double fundamentalPhase_A = fundamentalPhase + disturbance.voltagePhaseOffset[0];
+    result.a = disturbance.voltageScale(0) * calculatePhaseData(m_amplitude.value(), fundamentalPhase_A, harmonics)
+               + calculateHarmonicsData(fundamentalPhase_A, injected);
 
     // B상
     const double phase_B_offset = utils::degreesToRadians(m_voltage_B_phase_deg.value());
-    const double fundamentalPhase_B = fundamentalPhase + phase_B_offset;
-    result.b = calculatePhaseData(m_voltage_B_amplitude.value(), fundamentalPhase_B, harmonics);
+    const double fundamentalPhase_B = fundamentalPhase + phase_B_offset + disturbance.voltagePhaseOffset[1];
+    result.b = disturbance.voltageScale(1) * calculatePhaseData(m_voltage_B_amplitude.value(), fundamentalPhase_B, harmonics)
+               + calculateHarmonicsData(fundamentalPhase_B, injected);
 
     // C상
     const double phase_C_offset = utils::degreesToRadians(m_voltage_C_phase_deg.value());
-    const double fundamentalPhase_C = fundamentalPhase + phase_C_offset;
-    result.c = calculatePhaseData(m_voltage_C_amplitude.value(), fundamentalPhase_C, harmonics);
+    const double fundamentalPhase_C = fundamentalPhase + phase_C_offset + disturbance.voltagePhaseOffset[2];
+    result.c = disturbance.voltageScale(2) * calculatePhaseData(m_voltage_C_amplitude.value(), fundamentalPhase_C, harmonics)
+               + calculateHarmonicsData(fundamentalPhase_C, injected);
 
     return result;
 }
@@ -265,25 +470,29 @@ PhaseData SimulationEngine::calculateCurrentAmperage() const
     PhaseData result;
     const double baseCurrentPhase = m_currentPhaseRadians + m_phaseRadians.value() + m_currentPhaseOffsetRadians.value();
     const auto& harmonics = m_currentHarmonic.value();
+    const auto& injected = m_scenario.state().currentHarmonics; // 시나리오 주입 전류 고조파
 
     // 기본파, 고조파 계산
     // A상
-    result.a = calculatePhaseData(m_currentAmplitude.value(), baseCurrentPhase, harmonics);
+    result.a = calculatePhaseData(m_currentAmplitude.value(), baseCurrentPhase, harmonics)
+               + calculateHarmonicsData(baseCurrentPhase, injected);
 
     // B상
     const double phase_B_offset = utils::degreesToRadians(m_current_B_phase_deg.value());
     const double fundamentalPhase_B = baseCurrentPhase + phase_B_offset;
-    result.b = calculatePhaseData(m_current_B_amplitude.value(), fundamentalPhase_B, harmonics);
+    result.b = calculatePhaseData(m_current_B_amplitude.value(), fundamentalPhase_B, harmonics)
+               + calculateHarmonicsData(fundamentalPhase_B, injected);
 
     // C상
     const double phase_C_offset = utils::degreesToRadians(m_current_C_phase_deg.value());
     const double fundamentalPhase_C = baseCurrentPhase + phase_C_offset;
-    result.c = calculatePhaseData(m_current_C_amplitude.value(), fundamentalPhase_C, harmonics);
+    result.c = calculatePhaseData(m_current_C_amplitude.value(), fundamentalPhase_C, harmonics)
+               + calculateHarmonicsData(fundamentalPhase_C, injected);
 
     return result;
 }
 
-void SimulationEngine::addNewDataPoint(PhaseData voltage, PhaseData current)
+const DataPoint& SimulationEngine::addNewDataPoint(PhaseData voltage, PhaseData current)
 {
     // DataPoint 객체를 생성하여 저장
     LineToLineData voltage_ll;
@@ -291,13 +500,14 @@ void SimulationEngine::addNewDataPoint(PhaseData voltage, PhaseData current)
     voltage_ll.bc = voltage.b - voltage.c;
     voltage_ll.ca = voltage.c - voltage.a;
 
-    m_data.push_back({m_simulationTimeNs, voltage, current, voltage_ll});
+    m_latestDataPoint = {m_simulationTimeNs, voltage, current, voltage_ll};
+    m_data.push_back(m_latestDataPoint);
 
     // 최대 개수 관리
     if(m_data.size() > static_cast<size_t>(m_maxDataSize.value())) {
         m_data.pop_front();
     }
-
+    return m_latestDataPoint;
 }
 
 void SimulationEngine::calculateCycleData()
@@ -307,11 +517,16 @@ void SimulationEngine::calculateCycleData()
 
     MeasuredData newData;
     newData.timestamp = m_simulationTimeNs;
+    newData.trackedFrequency = m_frequencyTracker->trackedFrequency();
+    newData.rocof = m_frequencyTracker->rocof();
+    const std::vector<DataPoint>& samples = spectrumSamples();
+    GenericPhaseData<AnalysisUtils::Spectrum> voltageSpectra; // 차수별 전력/대칭 성분 계산용
+    GenericPhaseData<AnalysisUtils::Spectrum> currentSpectra;
 
     // 1. for 루프를 사용하여 3상에 대한 스펙트럼과 고조파 분석 수행
     for(int i{0}; i < 3; ++i) {
         // --- 전압 분석 ---
-        auto voltageSpectrumResult = analyzeSpectrum(AnalysisUtils::DataType::Voltage, i);
+        auto voltageSpectrumResult = analyzeSpectrum(samples, AnalysisUtils::DataType::Voltage, i);
         if(voltageSpectrumResult) {
             // 전체 스펙트럼 변환 및 저장
             auto fullHarmonics = AnalysisUtils::convertSpectrumToHarmonics(*voltageSpectrumResult);
@@ -327,12 +542,13 @@ void SimulationEngine::calculateCycleData()
             if(const auto* dom = AnalysisUtils::getDominantHarmonic(harmonics)) {
                 AnalysisUtils::getPhaseComponent(i, newData.dominantVoltage) = *dom;
             }
+            AnalysisUtils::getPhaseComponent(i, voltageSpectra) = std::move(*voltageSpectrumResult);
         } else {
             qWarning() << "Voltage Spectrum Analyze Failed !!!";
         }
 
         // --- 전류 분석 ---
-        auto currentSpectrumResult = analyzeSpectrum(AnalysisUtils::DataType::Current, i);
+        auto currentSpectrumResult = analyzeSpectrum(samples, AnalysisUtils::DataType::Current, i);
         if(currentSpectrumResult) {
             // 전체 스펙트럼 변환 및 저장
             auto fullHarmonics = AnalysisUtils::convertSpectrumToHarmonics(*currentSpectrumResult);
@@ -347,11 +563,15 @@ void SimulationEngine::calculateCycleData()
             if(const auto* dom = AnalysisUtils::getDominantHarmonic(harmonics)) {
                 AnalysisUtils::getPhaseComponent(i, newData.dominantCurrent) = *dom;
             }
+            AnalysisUtils::getPhaseComponent(i, currentSpectra) = std::move(*currentSpectrumResult);
         } else {
             qWarning() << "Current Spectrum Analyze Failed !!!";
         }
     }
 
+    // 차수별 고조파 P/Q와 대칭 성분 (상 하나라도 실패하면 비어 있음)
+    newData.harmonicOrders = AnalysisUtils::calculateHarmonicOrderData(voltageSpectra, currentSpectra);
+
     // 2. --- 선간 전압 기본파 계산 ---
     const auto Va_fund{newData.fundamentalVoltage.a.phasor};
     const auto Vb_fund{newData.fundamentalVoltage.b.phasor};
@@ -366,23 +586,34 @@ void SimulationEngine::calculateCycleData()
     newData.fundamentalVoltage_ll.ca = {.order = 1, .rms = std::abs(Vca_fund), .phase = std::arg(Vca_fund), .phasor = Vca_fund};
 
     // 3. --- 전체 cycle data 계산 ---
-    newData.voltageRms = AnalysisUtils::calculateTotalRms(m_cycleSampleBuffer, AnalysisUtils::DataType::Voltage);
-    newData.currentRms = AnalysisUtils::calculateTotalRms(m_cycleSampleBuffer, AnalysisUtils::DataType::Current);
-    newData.activePower = AnalysisUtils::calculateActivePower(m_cycleSampleBuffer);
-    newData.residualVoltageRms = AnalysisUtils::calculateResidualRms(m_cycleSampleBuffer, AnalysisUtils::DataType::Voltage);
-    newData.residualCurrentRms = AnalysisUtils::calculateResidualRms(m_cycleSampleBuffer, AnalysisUtils::DataType::Current);
-    newData.voltageRms_ll = AnalysisUtils::calculateTotalRms_ll(m_cycleSampleBuffer);
+    // 기본파 페이저와 같은 레코드(재표본화된 한 주기 또는 사이클 버퍼)에서 계산해야 IEEE 1459의 VH/IH가 맞음
+    newData.voltageRms = AnalysisUtils::calculateTotalRms(samples, AnalysisUtils::DataType::Voltage);
+    newData.currentRms = AnalysisUtils::calculateTotalRms(samples, AnalysisUtils::DataType::Current);
+    newData.activePower = AnalysisUtils::calculateActivePower(samples);
+    newData.residualVoltageRms = AnalysisUtils::calculateResidualRms(samples, AnalysisUtils::DataType::Voltage);
+    newData.residualCurrentRms = AnalysisUtils::calculateResidualRms(samples, AnalysisUtils::DataType::Current);
+    newData.voltageRms_ll = AnalysisUtils::calculateTotalRms_ll(samples);
+
+    // IEEE 1459 분해 (위에서 구한 RMS/전력과 기본파 페이저 재사용)
+    newData.power = AnalysisUtils::calculateIeee1459(newData);
 
 
     // 4. 완성된 데이터를 컨테이너에 추가
     m_measuredData.push_back(newData);
 
     // 최대 개수 관리
-    if(m_measuredData.size() > static_cast<size_t>(m_maxDataSize.value()))
-        m_measuredData.pop_front();
+    trimMeasuredData();
+
+    // 5. 1초 데이터 및 IEC 61000-4-30 집계 처리
+    if(m_qualityMeasurementsEnabled) {
+        processOneSecondData(m_measuredData.back());
+        m_aggregationEngine->process(m_measuredData.back());
+    }
 
-    // 5. 1초 데이터 처리 로직 호출
-    processOneSecondData(m_measuredData.back());
+    // 고조파 그룹 분석 (기본 집계 구간과 같은 10/12 사이클 윈도우)
+    if(m_harmonicGroupAnalysisEnabled) {
+        m_harmonicGroupAnalyzer->processCycle(m_cycleSampleBuffer, m_aggregationEngine->baseWindowCycles());
+    }
 
     // 6. UI에 업데이트 알림
     emit measuredDataUpdated(m_measuredData);
@@ -432,14 +663,46 @@ void SimulationEngine::processUpdateByMode(bool resetCounter)
     }
 }
 
-std::expected<AnalysisUtils::Spectrum, AnalysisUtils::SpectrumError> SimulationEngine::analyzeSpectrum(AnalysisUtils::DataType type, int phase) const
+std::expected<AnalysisUtils::Spectrum, AnalysisUtils::SpectrumError> SimulationEngine::analyzeSpectrum(const std::vector<DataPoint>& samples, AnalysisUtils::DataType type, int phase) const
 {
-    return AnalysisUtils::calculateSpectrum(m_cycleSampleBuffer, type, phase, false);
+    // 동기된 한 사이클이므로 사각 창 (SpectrumOptions 기본값)
+    auto spectrum = AnalysisUtils::calculateSpectrum(samples, type, phase, AnalysisUtils::SpectrumOptions{});
+    // 업샘플링으로 늘어난 빈(입력 나이퀴스트 위)은 정보가 없으므로 사이클 버퍼 기준 차수까지만
+    const size_t inputBins = m_cycleSampleBuffer.size() / 2 + 1;
+    if(spectrum && spectrum->size() > inputBins) {
+        spectrum->resize(inputBins);
+    }
+    return spectrum;
+}
+
+const std::vector<DataPoint>& SimulationEngine::spectrumSamples()
+{
+    if(!m_resamplingEnabled) {
+        return m_cycleSampleBuffer;
+    }
+
+    // 추적 주파수 (샘플 단위 추정이 없으면 추적기가 맞춰 둔 샘플링 주기 = 신호 주파수로 간주)
+    const double samplingCycles = m_samplingCycles.value();
+    const double trackedFrequency = m_frequencyTracker->trackedFrequency();
+    const double fundamental = (trackedFrequency > 0.0) ? trackedFrequency : samplingCycles;
+    if(fundamental <= 0.0) {
+        return m_cycleSampleBuffer;
+    }
+
+    const double samplesPerPeriod = samplingCycles * m_samplesPerCycle.value() / fundamental;
+    // 추적이 고정되어 버퍼가 이미 한 주기면 보간 오차 없이 그대로 사용
+    if(SynchronousResampler::isCoherent(samplesPerPeriod, m_cycleSampleBuffer.size())) {
+        return m_cycleSampleBuffer;
+    }
+    if(m_resampler.resample(samplesPerPeriod, m_captureIntervalsNs)) {
+        return m_resampler.cycle();
+    }
+    return m_cycleSampleBuffer;
 }
 
 void SimulationEngine::processOneSecondData(const MeasuredData& latestCycleDta)
 {
-    m_oneSecondCycleBuffer.push_back(latestCycleDta);
+    m_oneSecondAccumulator.add(latestCycleDta);
 
     // 시간 경과 확인
     auto elapsedNs = m_simulationTimeNs - m_oneSecondBlockStartTime;
@@ -452,7 +715,7 @@ void SimulationEngine::processOneSecondData(const MeasuredData& latestCycleDta)
     // qDebug() << "1초 경과";
 
     // 1초 데이터 가공 시작
-    OneSecondSummaryData summary = AnalysisUtils::buildOneSecondSummary(m_oneSecondCycleBuffer);
+    OneSecondSummaryData summary = m_oneSecondAccumulator.finalize(latestCycleDta);
 
     int samplesToTake = static_cast<int>(m_samplesPerCycle.value() * 2.0);
 
@@ -472,18 +735,35 @@ void SimulationEngine::processOneSecondData(const MeasuredData& latestCycleDta)
     m_totalEngeryWh += (totalActivePower * elapsedSeconds) / 3600.0;
     summary.totalEnergyWh = m_totalEngeryWh;
 
+    // 플리커 (Pst/Plt는 관측 구간이 채워질 때까지 NaN)
+    const auto toPhaseData = [](const Flickermeter::Lanes& lanes) {
+        PhaseData data;
+        data.a = lanes[0];
+        data.b = lanes[1];
+        data.c = lanes[2];
+        return data;
+    };
+    summary.flickerPinst = toPhaseData(m_flickermeter.pinst());
+    summary.flickerPst = toPhaseData(m_flickermeter.pst());
+    summary.flickerPlt = toPhaseData(m_flickermeter.plt());
+
     // 시그널 발생
-    emit oneSecondDataUpdated(summary);
+    emit oneSecondDataUpdated(std::make_shared<const OneSecondSummaryData>(std::move(summary)));
 
-    // 다음 1초를 위해 버퍼와 시작 시간 초기화
-    m_oneSecondCycleBuffer.clear();
+    // 다음 1초를 위해 누적값과 시작 시간 초기화
+    m_oneSecondAccumulator.reset();
 
     m_oneSecondBlockStartTime += elapsedNs;
 }
 
 double SimulationEngine::calculatePhaseData(double amplitude, double phaseOffset, const HarmonicList& harmonics) const
 {
-    double value = amplitude * sin(phaseOffset);
+    return amplitude * sin(phaseOffset) + calculateHarmonicsData(phaseOffset, harmonics);
+}
+
+double SimulationEngine::calculateHarmonicsData(double phaseOffset, const HarmonicList& harmonics) const
+{
+    double value = 0.0;
     for(const auto& harmonic : harmonics) {
         if(harmonic.magnitude != 0.0) {
             const double harmonicPhaseOffset = utils::degreesToRadians(harmonic.phase);
@@ -495,3 +775,20 @@ double SimulationEngine::calculatePhaseData(double amplitude, double phaseOffset
     }
     return value;
 }
+
+void SimulationEngine::updateEventNominalVoltages()
+{
+    // 공칭 전압(Udin) = 설정 진폭의 RMS. 선간은 A상 기준 √3배
+    const double phaseA = m_amplitude.value() / std::numbers::sqrt2;
+    m_eventDetector.setNominalVoltage(EventVa, phaseA);
+    m_eventDetector.setNominalVoltage(EventVb, m_voltage_B_amplitude.value() / std::numbers::sqrt2);
+    m_eventDetector.setNominalVoltage(EventVc, m_voltage_C_amplitude.value() / std::numbers::sqrt2);
+    for(int channel : {EventVab, EventVbc, EventVca}) {
+        m_eventDetector.setNominalVoltage(channel, phaseA * std::numbers::sqrt3);
+    }
+    const Flickermeter::Lanes phaseNominal = {phaseA, m_voltage_B_amplitude.value() / std::numbers::sqrt2, m_voltage_C_amplitude.value() / std::numbers::sqrt2};
+    m_flickermeter.setNominalVoltages(phaseNominal);
+    for(int phase{0}; phase < 3; ++phase) {
+        m_transientRecorder.setNominalVoltage(phase, phaseNominal[phase]);
+    }
+}
@@ -11,6 +11,16 @@
 #include "shared_data_types.h"
 #include "Property.h"
 #include "frequency_tracker.h"
+#include "one_second_accumulator.h"
+#include "aggregation_engine.h"
+#include "harmonic_group_analyzer.h"
+#include "scenario_scheduler.h"
+#include "voltage_event_detector.h"
+#include "flickermeter.h"
+#include "transient_recorder.h"
+#include "adc_front_end.h"
+#include "sample_history.h"
+#include "synchronous_resampler.h"
 
 // SimulationEngine 클래스
 // PowerSimulator의 핵심 로직 담당.
@@ -60,7 +70,17 @@ public:
     // 현재 데이터 버퍼의 크기 반환
     int getDataSize() const;
 
+    // 타이머 없이 시뮬레이션 시간을 duration만큼 진행 (오프라인 튜닝, 테스트용)
+    void runFor(utils::Nanoseconds duration);
+
     FrequencyTracker* getFrequencyTracker() const;
+    AggregationEngine* getAggregationEngine() const;
+    HarmonicGroupAnalyzer* getHarmonicGroupAnalyzer() const;
+    const VoltageEventDetector& getVoltageEventDetector() const;
+    TransientRecorder& getTransientRecorder(); // 싱크/트리거 설정은 엔진 스레드에서
+
+    // 이벤트 검출 채널 (상전압 A/B/C, 선간전압 AB/BC/CA)
+    enum EventChannel { EventVa, EventVb, EventVc, EventVab, EventVbc, EventVca, EventChannelCount };
 
 public slots:
     // 시뮬레이션 루프 시작
@@ -75,11 +95,30 @@ public slots:
     void updateCaptureTimer();
     void recalculateCaptureInterval();
     void enableFrequencyTracking(bool enabled);
+    void setFrequencyTrackingMethod(FrequencyTracker::TrackingMethod method);
+    void enableHarmonicGroupAnalysis(bool enabled); // 10/12 사이클 고조파 그룹 분석 모드
+    // 전력품질 단계(이벤트 검출, 플리커, 과도 캡처, 1초 요약, 다단계 집계). 사이클 측정값만 필요한 헤드리스 엔진에서 끔
+    void enableQualityMeasurements(bool enabled);
     void updateFrequencyTrackerCoefficients(const FrequencyTracker::PidCoefficients& fll, const FrequencyTracker::PidCoefficients& zc);
 
+    // 외란 시나리오 (현재 시뮬레이션 시각을 타임라인 0초로 예약)
+    void startScenario(const ScenarioScheduler::Timeline& timeline);
+    void stopScenario();
+
+    // ADC 전단 모델 (양자화, 이득/오프셋/위상 오차, 잡음). 끄면 이상적인 신호 그대로
+    void enableAdcFrontEnd(bool enabled);
+    void setAdcFrontEndSettings(const AdcFrontEnd::Settings& settings);
+
+    // 원시 파형 이력 저장 형식 (보관 중인 샘플도 변환됨)
+    void setHistoryStorage(SampleHistory::Storage storage);
+
+    // 사이클 스펙트럼을 추적 주파수 한 주기의 2^k점 재표본으로 계산 (끄면 사이클 버퍼 그대로)
+    void enableSynchronousResampling(bool enabled);
+    void setResamplingKernel(SynchronousResampler::Kernel kernel);
+
 signals:
     // 새로운 원시 파형 데이터가 준비되었을 때 발생
-    void dataUpdated(const std::deque<DataPoint>& data);
+    void dataUpdated(const SampleHistory& data);
 
     // 실행 상태가 변경되었을 때 발생 (시작/정지)
     void runningStateChanged(bool isRunning);
@@ -88,7 +127,7 @@ signals:
     void measuredDataUpdated(const std::deque<MeasuredData>& data);
       
     // 1초마다 요약된 데이터가 업데이트되었을 때 발생
-    void oneSecondDataUpdated(const OneSecondSummaryData& data);
+    void oneSecondDataUpdated(const OneSecondSummarySnapshot& data);
 
     // 페이저 분석 데이터가 업데이트되었을 때 발생
     void phasorUpdated(const GenericPhaseData<HarmonicAnalysisResult>& fundamentalVoltage,
@@ -96,6 +135,12 @@ signals:
                        const std::vector<HarmonicAnalysisResult>& voltageHarmonics,
                        const std::vector<HarmonicAnalysisResult>& currentHarmonics);
 
+    // 시나리오의 마지막 이벤트가 적용되었을 때 발생
+    void scenarioFinished(const QString& name);
+
+    // dip/swell/interruption 이벤트가 끝났을 때 발생 (channel은 EventChannel)
+    void voltageEventDetected(const VoltageEvent& event);
+
 private slots:
     // 메인 시뮬레이션 단계. m_captureTimer에 의해 호출됨.
     // 새로운 데이터 포인트를 생성하고 처리.
@@ -108,23 +153,31 @@ private:
     using FpNanoseconds = utils::FpNanoseconds;
     using Nanoseconds = utils::Nanoseconds;
     using FpSeconds = utils::FpSeconds;
-    std::expected<AnalysisUtils::Spectrum, AnalysisUtils::SpectrumError> analyzeSpectrum(AnalysisUtils::DataType type, int phase) const;
+    std::expected<AnalysisUtils::Spectrum, AnalysisUtils::SpectrumError> analyzeSpectrum(const std::vector<DataPoint>& samples, AnalysisUtils::DataType type, int phase) const;
+    const std::vector<DataPoint>& spectrumSamples(); // 버퍼가 이미 한 주기면 사이클 버퍼, 아니면 재표본화된 한 주기 (불가능하면 사이클 버퍼)
 
     void advanceSimulationTime();
+    void trimMeasuredData(); // 파형 이력 한도와 MeasuredDataSize 중 작은 값까지 앞에서 버림
+    void generateSamples(int count); // 시나리오 동작 시각 단위로 나눠 generateSample 반복
+    void generateSample(); // 샘플 1개 생성 및 사이클/추적/갱신 처리
     PhaseData calculateCurrentVoltage() const;
     PhaseData calculateCurrentAmperage() const;
-    void addNewDataPoint(PhaseData voltage, PhaseData current);
+    const DataPoint& addNewDataPoint(PhaseData voltage, PhaseData current); // 이력에 넣고 double 원본 반환
     
     // 현재 주기에 대한 RMS, 전력 및 기타 지표를 계산
     void calculateCycleData(); 
     // PhaseData 계산
     double calculatePhaseData(double amplitude, double phaseOffset, const HarmonicList& harmonics) const;
+    // 고조파 항만 합산 (시나리오 주입 고조파가 없으면 sin 호출 없이 0)
+    double calculateHarmonicsData(double phaseOffset, const HarmonicList& harmonics) const;
     
     void processUpdateByMode(bool resetCounter);
     void processOneSecondData(const MeasuredData& latestCycleData);
+    void updateEventNominalVoltages(); // 진폭 설정으로부터 채널별 공칭 RMS 갱신 (이벤트 검출기, 플리커미터, 과도 캡처)
 
     QChronoTimer* m_captureTimer;
-    std::deque<DataPoint> m_data;
+    SampleHistory m_data;
+    DataPoint m_latestDataPoint; // 이력 인코딩 전 최신 샘플 (분석 경로용)
 
     double m_currentPhaseRadians; // 현재 누적 위상
     int m_sampleCounterForUpdate;
@@ -138,11 +191,36 @@ private:
     std::vector<DataPoint> m_cycleSampleBuffer; // 1사이클 동안의 샘플을 모으는 버퍼
 
     std::unique_ptr<FrequencyTracker> m_frequencyTracker;
+    std::unique_ptr<AggregationEngine> m_aggregationEngine; // IEC 61000-4-30 다단계 집계
+    std::unique_ptr<HarmonicGroupAnalyzer> m_harmonicGroupAnalyzer; // IEC 61000-4-7 그룹화
+    bool m_harmonicGroupAnalysisEnabled;
+    bool m_qualityMeasurementsEnabled = true;
 
     // 1초 데이터 관련 변수
-    std::vector<MeasuredData> m_oneSecondCycleBuffer;
+    OneSecondAccumulator m_oneSecondAccumulator; // 사이클마다 누적, 1초마다 확정
     Nanoseconds m_oneSecondBlockStartTime;
     double m_totalEngeryWh;
+
+    // 반주기 RMS 기반 전압 이벤트 검출
+    VoltageEventDetector m_eventDetector;
+
+    // IEC 61000-4-15 플리커미터 (상전압)
+    Flickermeter m_flickermeter;
+
+    // 사전/사후 트리거 과도 파형 캡처
+    TransientRecorder m_transientRecorder;
+
+    // 계측 전단 모델 (생성 직후 적용)
+    AdcFrontEnd m_adcFrontEnd;
+    bool m_adcFrontEndEnabled = false;
+
+    // 스펙트럼용 동기 재표본화
+    SynchronousResampler m_resampler;
+    bool m_resamplingEnabled = true;
+
+    // 외란 시나리오
+    ScenarioScheduler m_scenario;
+    int m_segmentSamplesLeft = 0; // 현재 구간에서 검사 없이 생성할 남은 샘플 수
 };
 
 #endif // SIMULATION_ENGINE_H
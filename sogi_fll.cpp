@@ -0,0 +1,106 @@
+#include "sogi_fll.h"
+#include "config.h"
+#include <algorithm>
+#include <cmath>
+
+namespace {
+    struct SogiConstants {
+        static constexpr double Gain = 1.0;                    // SOGI 감쇠 이득 k (작을수록 고조파 영향 감소, 응답 느려짐)
+        static constexpr double FllGainPerCycle = 0.2;        // 정규화 FLL 이득 (추정 각주파수 배수). 약 3사이클에 1% 이내로 수렴
+        static constexpr double MinFrequencyHz = 0.5;
+        static constexpr double MaxFrequencyHz = 500.0;
+        static constexpr double MinAmplitude = 1e-6;          // 이보다 작으면 신호 없음으로 보고 FLL 정지
+        static constexpr double RocofTimeConstant_S = 0.1;    // ROCOF 저역통과 시정수
+        static constexpr double SettleCycles = 5.0;           // 잠금으로 판단하기까지 필요한 사이클 수
+    };
+    // 사전 왜곡 시 tan 발산을 막기 위한 정규화 주파수 상한 (f / fs)
+    constexpr double MaxNormalizedFrequency = 0.45;
+}
+
+void SogiFll::reset(double initialFrequencyHz)
+{
+    const double frequency = std::clamp(initialFrequencyHz, SogiConstants::MinFrequencyHz, SogiConstants::MaxFrequencyHz);
+    m_omega = config::Math::TwoPi * frequency;
+    m_u1 = m_u2 = 0.0;
+    m_v1 = m_v2 = 0.0;
+    m_qv1 = m_qv2 = 0.0;
+    m_previousFrequency = frequency;
+    m_rocof = 0.0;
+    m_settledTime = 0.0;
+}
+
+void SogiFll::process(double sample, double dtSeconds)
+{
+    if(dtSeconds <= 0.0) {
+        return;
+    }
+
+    // 1. SOGI (쌍선형 변환, 현재 추정 주파수로 계수를 매 샘플 계산)
+    // 공진 주파수가 추정 주파수와 정확히 일치하도록 주파수 사전 왜곡(prewarping) 적용
+    const double k = SogiConstants::Gain;
+    const double wt = 2.0 * std::tan(std::min(m_omega * dtSeconds, config::Math::TwoPi * MaxNormalizedFrequency) / 2.0);
+    const double x = 2.0 * k * wt;
+    const double y = wt * wt;
+    const double denominator = x + y + 4.0;
+
+    const double b0 = x / denominator;
+    const double qb0 = k * y / denominator;
+    const double a1 = 2.0 * (4.0 - y) / denominator;
+    const double a2 = (x - y - 4.0) / denominator;
+
+    const double v = b0 * (sample - m_u2) + a1 * m_v1 + a2 * m_v2;
+    const double qv = qb0 * (sample + 2.0 * m_u1 + m_u2) + a1 * m_qv1 + a2 * m_qv2;
+
+    m_u2 = m_u1; m_u1 = sample;
+    m_v2 = m_v1; m_v1 = v;
+    m_qv2 = m_qv1; m_qv1 = qv;
+
+    // 2. FLL (진폭 정규화)
+    const double magnitudeSquared = v * v + qv * qv;
+    if(magnitudeSquared < SogiConstants::MinAmplitude * SogiConstants::MinAmplitude) {
+        m_settledTime = 0.0;
+        return;
+    }
+
+    const double error = sample - v;
+    const double gamma = SogiConstants::FllGainPerCycle * m_omega;
+    m_omega -= gamma * k * m_omega * error * qv / magnitudeSquared * dtSeconds;
+    m_omega = std::clamp(m_omega,
+                         config::Math::TwoPi * SogiConstants::MinFrequencyHz,
+                         config::Math::TwoPi * SogiConstants::MaxFrequencyHz);
+
+    // 3. ROCOF (주파수 미분의 1차 저역통과)
+    const double frequency = m_omega / config::Math::TwoPi;
+    const double alpha = dtSeconds / (SogiConstants::RocofTimeConstant_S + dtSeconds);
+    m_rocof += alpha * ((frequency - m_previousFrequency) / dtSeconds - m_rocof);
+    m_previousFrequency = frequency;
+
+    m_settledTime += dtSeconds;
+}
+
+double SogiFll::frequency() const
+{
+    return m_omega / config::Math::TwoPi;
+}
+
+double SogiFll::rocof() const
+{
+    return m_rocof;
+}
+
+double SogiFll::amplitude() const
+{
+    return std::sqrt(m_v1 * m_v1 + m_qv1 * m_qv1);
+}
+
+double SogiFll::phase() const
+{
+    // v' = A sin(θ), qv' = -A cos(θ)
+    return std::atan2(m_v1, -m_qv1);
+}
+
+bool SogiFll::isLocked() const
+{
+    return amplitude() > SogiConstants::MinAmplitude
+           && m_settledTime * frequency() >= SogiConstants::SettleCycles;
+}
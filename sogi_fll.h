@@ -0,0 +1,39 @@
+#ifndef SOGI_FLL_H
+#define SOGI_FLL_H
+
+// SogiFll 클래스
+// 2차 일반화 적분기(SOGI)와 주파수 고정 루프(FLL)로 단상 신호의 주파수/위상을 샘플 단위로 추적.
+// 샘플당 O(1) 연산이며 버퍼 없이 직전 두 샘플의 상태만 유지.
+// SOGI는 추정 주파수에서 동작하는 대역통과 필터로, 기본파 성분(v')과 90도 지연 성분(qv')을 만듦.
+// FLL은 오차(u - v')와 qv'의 곱으로 주파수를 보정 (진폭으로 정규화되어 진폭과 무관하게 수렴).
+class SogiFll
+{
+public:
+    // initialFrequencyHz: 추적 시작 주파수 (잠금 전 추정값)
+    void reset(double initialFrequencyHz);
+
+    // 새 샘플 처리. dtSeconds는 이전 샘플과의 시간 간격
+    void process(double sample, double dtSeconds);
+
+    double frequency() const;   // 추정 주파수 (Hz)
+    double rocof() const;       // 주파수 변화율 (Hz/s, 저역통과 필터 적용)
+    double amplitude() const;   // 기본파 진폭 (피크)
+    double phase() const;       // 기본파 위상 (라디안, sin 기준)
+
+    // 진폭이 유효하고 초기 수렴 시간이 지났는지
+    bool isLocked() const;
+
+private:
+    double m_omega = 0.0;          // 추정 각주파수 (rad/s)
+
+    // SOGI 상태 (직전 두 입력/출력)
+    double m_u1 = 0.0, m_u2 = 0.0;
+    double m_v1 = 0.0, m_v2 = 0.0;
+    double m_qv1 = 0.0, m_qv2 = 0.0;
+
+    double m_previousFrequency = 0.0;
+    double m_rocof = 0.0;
+    double m_settledTime = 0.0;    // 진폭이 유효한 상태로 경과한 시간 (초)
+};
+
+#endif // SOGI_FLL_H
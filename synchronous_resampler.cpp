@@ -0,0 +1,189 @@
+#include "synchronous_resampler.h"
+#include "config.h"
+#include <algorithm>
+#include <bit>
+#include <cmath>
+#include <numbers>
+
+namespace {
+    using Resampling = config::Resampling;
+
+    constexpr int CubicTaps = 4;
+
+    double sinc(double x)
+    {
+        if(x == 0.0) return 1.0;
+        const double px = std::numbers::pi * x;
+        return std::sin(px) / px;
+    }
+
+    // Lanczos 다위상 표. 행 r은 mu = r / SincPhases (마지막 행은 mu = 1), 행 합은 1로 정규화 (직류 이득 정확히 1)
+    struct SincTable {
+        static constexpr int Half = Resampling::SincTaps / 2;
+        std::array<std::array<double, Resampling::SincTaps>, Resampling::SincPhases + 1> rows{};
+
+        SincTable()
+        {
+            for(int r{0}; r <= Resampling::SincPhases; ++r) {
+                const double mu = static_cast<double>(r) / Resampling::SincPhases;
+                double sum = 0.0;
+                for(int t{0}; t < Resampling::SincTaps; ++t) {
+                    const double x = mu - (t - Half + 1);
+                    const double value = (std::abs(x) < Half) ? sinc(x) * sinc(x / Half) : 0.0;
+                    rows[r][t] = value;
+                    sum += value;
+                }
+                for(double& value : rows[r]) {
+                    value /= sum;
+                }
+            }
+        }
+    };
+
+    const SincTable& sincTable()
+    {
+        static const SincTable table;
+        return table;
+    }
+}
+
+SynchronousResampler::SynchronousResampler()
+{
+    configure(config::Sampling::DefaultSamplesPerCycle);
+}
+
+void SynchronousResampler::configure(int samplesPerCycle)
+{
+    if(samplesPerCycle < Resampling::MinSamplesPerCycle) {
+        m_history.clear();
+        m_capacity = 0;
+        m_cycle.clear();
+        reset();
+        return;
+    }
+
+    m_minPeriod = samplesPerCycle / Resampling::MaxPeriodRatio;
+    m_maxPeriod = samplesPerCycle * Resampling::MaxPeriodRatio;
+
+    // 가장 긴 주기 + 양쪽 커널 여유
+    m_capacity = static_cast<size_t>(std::ceil(m_maxPeriod)) + Resampling::SincTaps + 1;
+    m_history.assign(2 * m_capacity, Frame{});
+    m_cycle.assign(std::bit_ceil(static_cast<size_t>(samplesPerCycle)), DataPoint{});
+    reset();
+}
+
+void SynchronousResampler::setKernel(Kernel kernel)
+{
+    m_kernel = kernel;
+}
+
+void SynchronousResampler::reset()
+{
+    m_count = 0;
+    m_latestTimestamp = Nanoseconds::zero();
+}
+
+void SynchronousResampler::push(const DataPoint& point)
+{
+    if(m_capacity == 0) return;
+
+    const Frame frame = {
+        point.voltage.a, point.voltage.b, point.voltage.c,
+        point.current.a, point.current.b, point.current.c
+    };
+    const size_t position = m_count % m_capacity;
+    m_history[position] = frame;
+    m_history[position + m_capacity] = frame;
+    ++m_count;
+    m_latestTimestamp = point.timestamp;
+}
+
+bool SynchronousResampler::isCoherent(double samplesPerPeriod, size_t cycleSize)
+{
+    return cycleSize > 0 && std::abs(samplesPerPeriod - static_cast<double>(cycleSize)) <= Resampling::CoherentTolerance;
+}
+
+bool SynchronousResampler::resample(double samplesPerPeriod, FpNanoseconds sampleInterval)
+{
+    const size_t points = m_cycle.size();
+    if(points == 0 || !(samplesPerPeriod >= m_minPeriod && samplesPerPeriod <= m_maxPeriod)) {
+        return false;
+    }
+
+    // 주기 구간 [start, end) (절대 샘플 인덱스, 분수). 마지막 점의 커널 끝이 최신 샘플에 닿도록 end를 정함
+    const int taps = tapCount();
+    const int half = taps / 2;
+    const double end = static_cast<double>(m_count) - half;
+    const double start = end - samplesPerPeriod;
+    const double startFloor = std::floor(start);
+    const double oldest = (m_count > m_capacity) ? static_cast<double>(m_count - m_capacity) : 0.0;
+    if(startFloor - (half - 1) < oldest) {
+        return false;
+    }
+
+    // 절대 인덱스가 커도 분수 정밀도가 유지되도록 정수 기준 + 작은 오프셋으로 계산
+    const uint64_t base = static_cast<uint64_t>(startFloor);
+    const double startOffset = start - startFloor;
+    const double step = samplesPerPeriod / points;
+    const double latestIndex = static_cast<double>(m_count - 1);
+
+    std::array<double, Resampling::SincTaps> coeff;
+    for(size_t j = 0; j < points; ++j) {
+        const double offset = startOffset + j * step;
+        const double whole = std::floor(offset);
+        coefficients(offset - whole, coeff.data());
+
+        // 이중 링이므로 첫 탭 위치에서 taps개가 항상 연속
+        const uint64_t firstTap = base + static_cast<uint64_t>(whole) - (half - 1);
+        const Frame* x = &m_history[firstTap % m_capacity];
+        Frame acc{};
+        for(int t{0}; t < taps; ++t) {
+            const double c = coeff[t];
+            for(int ch{0}; ch < ChannelCount; ++ch) {
+                acc[ch] += c * x[t][ch];
+            }
+        }
+
+        DataPoint& point = m_cycle[j];
+        const double samplesFromLatest = (static_cast<double>(base) - latestIndex) + offset;
+        point.timestamp = m_latestTimestamp + std::chrono::duration_cast<Nanoseconds>(sampleInterval * samplesFromLatest);
+        point.voltage = {acc[VoltageA], acc[VoltageB], acc[VoltageC]};
+        point.current = {acc[CurrentA], acc[CurrentB], acc[CurrentC]};
+        point.voltage_ll.ab = acc[VoltageA] - acc[VoltageB];
+        point.voltage_ll.bc = acc[VoltageB] - acc[VoltageC];
+        point.voltage_ll.ca = acc[VoltageC] - acc[VoltageA];
+    }
+    return true;
+}
+
+// ---- private ----
+int SynchronousResampler::tapCount() const
+{
+    return (m_kernel == Kernel::Cubic) ? CubicTaps : Resampling::SincTaps;
+}
+
+void SynchronousResampler::coefficients(double mu, double* taps) const
+{
+    if(m_kernel == Kernel::Cubic) {
+        // 4점 Lagrange (x[-1], x[0], x[1], x[2])
+        const double m1 = mu - 1.0;
+        const double m2 = mu - 2.0;
+        const double p1 = mu + 1.0;
+        taps[0] = -mu * m1 * m2 / 6.0;
+        taps[1] = p1 * m1 * m2 / 2.0;
+        taps[2] = -p1 * mu * m2 / 2.0;
+        taps[3] = p1 * mu * m1 / 6.0;
+        return;
+    }
+
+    // 이웃한 두 위상 행을 선형 보간
+    const auto& rows = sincTable().rows;
+    const double scaled = mu * Resampling::SincPhases;
+    const int row = std::min(static_cast<int>(scaled), Resampling::SincPhases - 1);
+    const double a = scaled - row;
+    const auto& r0 = rows[row];
+    const auto& r1 = rows[row + 1];
+    for(int t{0}; t < Resampling::SincTaps; ++t) {
+        taps[t] = r0[t] + a * (r1[t] - r0[t]);
+    }
+}
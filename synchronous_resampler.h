@@ -0,0 +1,69 @@
+#ifndef SYNCHRONOUS_RESAMPLER_H
+#define SYNCHRONOUS_RESAMPLER_H
+
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include "data_point.h"
+
+// SynchronousResampler 클래스
+// 최근 샘플 이력에서 추적 주파수의 정확히 한 주기를 골라 2^k점으로 보간.
+// 사이클 버퍼가 정수 주기가 아니어도(추적 미고정) 스펙트럼 분석이 누설 없는 radix-2 실수 FFT 경로를 쓰도록 함.
+//  - 출력 점 수 M = 사이클당 샘플 수 이상의 가장 작은 2의 거듭제곱 (업샘플링)
+//  - 커널: 4점 3차 Lagrange 또는 Lanczos 창 sinc (다위상 표, 행 사이 선형 보간)
+//  - 커널이 뒤쪽 샘플을 필요로 하므로 주기 끝은 최신 샘플보다 (탭 수 / 2 - 1) 샘플 앞
+// 이력은 채널 교차 배치 프레임의 이중 링(같은 프레임을 두 번 기록)이라 어느 탭 구간이든 연속 메모리이고,
+// 탭마다 6채널을 한 번에 누적하므로 채널 루프가 SIMD로 펼쳐짐.
+// 버퍼는 configure()에서 모두 할당하므로 push()/resample()에서는 할당이 없음.
+// 사이클 버퍼가 이미 정확히 한 주기면(추적 고정) 직접 FFT가 정확하고 보간은 고차 고조파를 깎으므로 쓰지 않음 (isCoherent).
+class SynchronousResampler
+{
+public:
+    using Nanoseconds = std::chrono::nanoseconds;
+    using FpNanoseconds = std::chrono::duration<double, std::nano>;
+
+    enum class Kernel { Cubic, Sinc };
+    enum Channel { VoltageA, VoltageB, VoltageC, CurrentA, CurrentB, CurrentC, ChannelCount };
+    using Frame = std::array<double, ChannelCount>;
+
+    SynchronousResampler();
+
+    // 사이클당 샘플 수로 출력 점 수와 이력 길이 결정 (이력은 비움). 샘플 경로와 같은 스레드에서 호출
+    void configure(int samplesPerCycle);
+    void setKernel(Kernel kernel);
+    Kernel kernel() const { return m_kernel; }
+    void reset();
+
+    // 출력 점 수 (사이클당 샘플 수가 config::Resampling::MinSamplesPerCycle 미만이면 0)
+    size_t outputSize() const { return m_cycle.size(); }
+
+    void push(const DataPoint& point);
+
+    // 사이클 버퍼(cycleSize 샘플)가 이미 한 주기와 맞는지. 맞으면 버퍼를 그대로 FFT (N이 2의 거듭제곱이 아니어도 정확)
+    static bool isCoherent(double samplesPerPeriod, size_t cycleSize);
+
+    // 최근 한 주기(samplesPerPeriod = 샘플링 주파수 / 추적 주파수 샘플)를 outputSize()점으로 보간.
+    // 이력이 모자라거나 주기가 허용 범위를 벗어나면 false (cycle()은 이전 값 유지)
+    bool resample(double samplesPerPeriod, FpNanoseconds sampleInterval);
+    const std::vector<DataPoint>& cycle() const { return m_cycle; }
+
+private:
+    int tapCount() const;
+    // 분수 위치 mu [0, 1)에서의 탭 계수. 탭 t는 정수 위치 + (t - 탭 수 / 2 + 1) 샘플
+    void coefficients(double mu, double* taps) const;
+
+    Kernel m_kernel = Kernel::Sinc;
+    double m_minPeriod = 0.0;
+    double m_maxPeriod = 0.0;
+
+    std::vector<Frame> m_history; // 크기 2 * m_capacity (같은 프레임을 i, i + m_capacity에 기록)
+    size_t m_capacity = 0;
+    uint64_t m_count = 0;         // 지금까지 넣은 샘플 수 (최신 샘플의 절대 인덱스 + 1)
+    Nanoseconds m_latestTimestamp{0};
+
+    std::vector<DataPoint> m_cycle;
+};
+
+#endif // SYNCHRONOUS_RESAMPLER_H
@@ -15,9 +15,20 @@
 #include "additional_metrics_window.h"
 #include "a3700n_window.h"
 #include "demand_calculator.h"
+#include "measurement_recorder.h"
+#include "frame_presenter.h"
+#include "config.h"
 
+#include <QActionGroup>
 #include <QApplication>
+#include <QDateTime>
+#include <QDir>
 #include <QMessageBox>
+#include <QFileDialog>
+#include <QStatusBar>
+#include <QDebug>
+#include <algorithm>
+#include <cmath>
 
 SystemController::SystemController(QObject *parent)
     : QObject{parent}
@@ -38,6 +49,14 @@ void SystemController::initialize()
     QString dbPath = QApplication::applicationDirPath() + "/settings.db";
     m_settingsManager = std::make_unique<SettingsManager>(dbPath.toStdString());
 
+    // 측정 데이터 기록. 실패해도 시뮬레이션은 계속 동작
+    try {
+        QString recordPath = QApplication::applicationDirPath() + "/" + config::sv_to_q(config::Recorder::DatabaseFileName);
+        m_recorder = std::make_unique<MeasurementRecorder>(recordPath.toStdString());
+    } catch(const std::exception& e) {
+        qWarning() << "SystemController:" << e.what();
+    }
+
     m_mainWindow = std::make_unique<MainWindow>();
 
     setupThread();
@@ -55,7 +74,13 @@ void SystemController::setupThread()
     m_engine = new SimulationEngine();
     m_engine->moveToThread(&m_simulationThread);
 
+    // 엔진과 같은 스레드에서 엔진 시그널을 직접 받아 합친 뒤 GUI 스레드로 전달
+    m_presenter = new FramePresenter();
+    m_presenter->setReceiverContext(m_mainWindow.get());
+    m_presenter->moveToThread(&m_simulationThread);
+
     connect(&m_simulationThread, &QThread::finished, m_engine, &QObject::deleteLater);
+    connect(&m_simulationThread, &QThread::finished, m_presenter, &QObject::deleteLater);
     m_simulationThread.start();
 }
 
@@ -83,6 +108,34 @@ void SystemController::createConnections()
         });
     });
 
+    // 외란 시나리오: 파일은 GUI 스레드에서 읽고 검증한 뒤 엔진 스레드에서 예약
+    connect(mw->getActionRunScenario(), &QAction::triggered, mw, [this, mw]() {
+        const QString path = QFileDialog::getOpenFileName(mw, "시나리오 열기", QString(), "Scenario (*.json)");
+        if(path.isEmpty()) return;
+
+        auto timeline = ScenarioScheduler::loadFile(path);
+        if(!timeline) {
+            QMessageBox::warning(mw, "시나리오 오류", timeline.error());
+            return;
+        }
+        mw->statusBar()->showMessage(QString("시나리오 '%1' 시작").arg(timeline->name));
+        QMetaObject::invokeMethod(m_engine, [engine = m_engine, timeline = std::move(*timeline)]() {
+            engine->startScenario(timeline);
+        });
+    });
+    connect(mw->getActionStopScenario(), &QAction::triggered, m_engine, &SimulationEngine::stopScenario);
+    connect(mw->getActionAdcFrontEnd(), &QAction::toggled, m_engine, &SimulationEngine::enableAdcFrontEnd);
+    connect(mw->getHistoryStorageGroup(), &QActionGroup::triggered, mw, [this](QAction* action) {
+        // QAction은 GUI 스레드에서만 읽고 저장 형식 값만 엔진 스레드로 넘김
+        const auto storage = static_cast<SampleHistory::Storage>(action->data().toInt());
+        QMetaObject::invokeMethod(m_engine, [engine = m_engine, storage]() {
+            engine->setHistoryStorage(storage);
+        });
+    });
+    connect(m_engine, &SimulationEngine::scenarioFinished, mw, [mw](const QString& name) {
+        mw->statusBar()->showMessage(QString("시나리오 '%1'의 모든 이벤트가 적용되었습니다.").arg(name));
+    });
+
     // ControlPanel -> Controller
     connect(cp, &ControlPanel::settingsClicked, sc, &SettingsUiController::showSettingsDialog);
     connect(cp, &ControlPanel::amplitudeChanged, sc, &SettingsUiController::onAmplitudeChanged);
@@ -95,6 +148,10 @@ void SystemController::createConnections()
     connect(cp, &ControlPanel::updateModeChanged, sc, &SettingsUiController::onUpdateModeChanged);
     connect(cp, &ControlPanel::harmonicsSettingsRequested, sc, &SettingsUiController::onHarmonicsSettingsRequested);
     connect(cp, &ControlPanel::trackingToggled, sc, &SettingsUiController::onTrackingToggled);
+    connect(cp, &ControlPanel::streamingTrackingToggled, m_engine, [this](bool enabled) {
+        m_engine->setFrequencyTrackingMethod(enabled ? FrequencyTracker::TrackingMethod::StreamingSogi
+                                                     : FrequencyTracker::TrackingMethod::CycleFft);
+    });
 
     // autoscroll 및 visibility
     connect(cp, &ControlPanel::autoScrollToggled, mw->getGraphWindow(), &GraphWindow::toggleAutoScroll);
@@ -157,18 +214,84 @@ void SystemController::createConnections()
         cp->setCurrentPhase(qRound(utils::radiansToDegrees(radians)));
     });
 
-    // Engine -> UI (Graph & Data Update)
-    connect(m_engine, &SimulationEngine::dataUpdated, mw->getGraphWindow(), &GraphWindow::updateGraph);
+    // Engine -> Presenter (같은 스레드, 최신 스냅샷만 보관)
+    connect(m_engine, &SimulationEngine::dataUpdated, m_presenter, &FramePresenter::submitWaveform, Qt::DirectConnection);
+    connect(m_engine, &SimulationEngine::measuredDataUpdated, m_presenter, &FramePresenter::submitMeasured, Qt::DirectConnection);
+    connect(m_engine, &SimulationEngine::phasorUpdated, m_presenter, &FramePresenter::submitPhasor, Qt::DirectConnection);
+
+    // Presenter -> UI (Graph & Data Update, 뷰마다 프레임당 최대 1회)
+    connect(m_presenter, &FramePresenter::waveformReady, mw->getGraphWindow(), &GraphWindow::updateGraph);
+    connect(m_presenter, &FramePresenter::measuredReady, mw->getAnalysisGraphWindow(), &AnalysisGraphWindow::updateGraph);
+    connect(m_presenter, &FramePresenter::phasorReady, mw->getPhasorView(), &PhasorView::updateData);
+    connect(m_presenter, &FramePresenter::measuredReady, mw->getFundamentalGraphWindow(), &FundamentalAnalysisGraphWindow::updateGraph);
+    connect(m_presenter, &FramePresenter::measuredReady, mw->getHarmonicGraphWindow(), &HarmonicAnalysisGraphWindow::updateGraph);
+    connect(m_presenter, &FramePresenter::droppedCountChanged, mw, &MainWindow::setDroppedUpdateCount);
+
+    // Engine -> UI
     connect(m_engine, &SimulationEngine::runningStateChanged, cp, &ControlPanel::setRunningState);
-    connect(m_engine, &SimulationEngine::measuredDataUpdated, mw->getAnalysisGraphWindow(), &AnalysisGraphWindow::updateGraph);
-    connect(m_engine, &SimulationEngine::phasorUpdated, mw->getPhasorView(), &PhasorView::updateData);
-    connect(m_engine, &SimulationEngine::measuredDataUpdated, mw->getFundamentalGraphWindow(), &FundamentalAnalysisGraphWindow::updateGraph);
-    connect(m_engine, &SimulationEngine::measuredDataUpdated, mw->getHarmonicGraphWindow(), &HarmonicAnalysisGraphWindow::updateGraph);
     connect(m_engine, &SimulationEngine::oneSecondDataUpdated, mw->getOneSecondWindow(), &OneSecondSummaryWindow::updateData);
     connect(m_engine, &SimulationEngine::oneSecondDataUpdated, mw->getAdditionalMetricsWindow(), &AdditionalMetricsWindow::updateData);
     connect(m_engine, &SimulationEngine::oneSecondDataUpdated, mw->getA3700Window(), &A3700N_Window::updateSummaryData);
     connect(m_engine, &SimulationEngine::oneSecondDataUpdated, mw->getDemandCalculator(), &DemandCalculator::processOneSecondData);
+    connect(sc, &SettingsUiController::setDemandInterval, mw->getDemandCalculator(), &DemandCalculator::setDemandInterval);
     connect(mw->getDemandCalculator(), &DemandCalculator::demandDataUpdated, mw->getA3700Window(), &A3700N_Window::updateDemandData);
+    connect(m_engine->getHarmonicGroupAnalyzer(), &HarmonicGroupAnalyzer::harmonicGroupsUpdated, mw->getA3700Window(), &A3700N_Window::updateHarmonicGroups);
+    connect(mw->getA3700Window(), &A3700N_Window::harmonicGroupAnalysisToggled, m_engine, &SimulationEngine::enableHarmonicGroupAnalysis);
+
+    // Engine / Calculator -> Recorder
+    // 큐에 넣기만 하므로 발신 스레드에서 바로 호출 (이벤트 루프 경유 없음)
+    if(m_recorder) {
+        auto recorder = m_recorder.get();
+        connect(m_engine, &SimulationEngine::oneSecondDataUpdated, recorder, &MeasurementRecorder::recordSummary, Qt::DirectConnection);
+        connect(mw->getDemandCalculator(), &DemandCalculator::demandDataUpdated, recorder, &MeasurementRecorder::recordDemand, Qt::DirectConnection);
+        connect(m_engine->getAggregationEngine(), &AggregationEngine::intervalAggregated, recorder, &MeasurementRecorder::recordAggregate, Qt::DirectConnection);
+        connect(m_engine, &SimulationEngine::voltageEventDetected, recorder, [recorder](const VoltageEvent& event) {
+            recorder->recordEvent({
+                .startTime = event.startTime,
+                .duration = event.duration,
+                .type = VoltageEvent::typeName(event.type),
+                .phase = event.channel,
+                .extremeValue = event.extremeValue
+            });
+        }, Qt::DirectConnection);
+        connect(recorder, &MeasurementRecorder::errorOccurred, mw, [](const QString& message) {
+            qWarning() << message;
+        });
+    }
+
+    // 과도 캡처 -> CSV 파일 + 이벤트 기록 (캡처 기록 스레드에서 실행되므로 UI 접근 없음)
+    const QString transientDir = QApplication::applicationDirPath() + "/" + config::sv_to_q(config::Transient::DirectoryName);
+    if(QDir().mkpath(transientDir)) {
+        // 시뮬레이션 시각은 실행마다 0부터 시작하므로 실행 시작 시각을 파일 이름에 넣어 이전 실행의 캡처를 덮어쓰지 않음
+        const QString session = QDateTime::currentDateTime().toString("yyyyMMdd-HHmmss");
+        QMetaObject::invokeMethod(m_engine, [engine = m_engine, transientDir, session, recorder = m_recorder.get()]() {
+            engine->getTransientRecorder().setCaptureSink([transientDir, session, recorder](const TransientCapture& capture) {
+                const char* triggerName = TransientCapture::triggerName(capture.trigger);
+                const QString path = transientDir + "/" + TransientRecorder::captureFileName(session, capture);
+                if(auto result = TransientRecorder::writeCsv(capture, path); !result) {
+                    qWarning() << "Transient capture write failed:" << result.error();
+                }
+                TransientRecorder::enforceRetention(transientDir, config::Transient::MaxFiles, config::Transient::MaxTotalBytes);
+                if(recorder) {
+                    // 트리거 채널(외부 트리거는 A상)의 최대 절대값
+                    const auto& samples = capture.samples[std::max(capture.channel, 0)];
+                    double peak = 0.0;
+                    for(int i{0}; i < capture.size; ++i) {
+                        peak = std::max(peak, std::abs(samples[i]));
+                    }
+                    recorder->recordEvent({
+                        .startTime = capture.triggerTime,
+                        .duration = capture.timestamps[capture.size - 1] - capture.triggerTime,
+                        .type = std::string("transient-") + triggerName,
+                        .phase = capture.channel,
+                        .extremeValue = peak
+                    });
+                }
+            });
+        });
+    } else {
+        qWarning() << "SystemController: Cannot create transient capture directory" << transientDir;
+    }
 
     // Graph -> UI (Hover)
     connect(mw->getGraphWindow(), &GraphWindow::redrawNeeded, m_engine, &SimulationEngine::onRedrawRequest);
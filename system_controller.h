@@ -8,6 +8,8 @@ class SettingsUiController;
 class SettingsManager;
 class SimulationEngine;
 class MainWindow;
+class MeasurementRecorder;
+class FramePresenter;
 
 class SystemController : public QObject
 {
@@ -25,6 +27,7 @@ private:
     // Core Components
     QThread m_simulationThread;
     SimulationEngine* m_engine = nullptr; // 스레드로 이동되므로 포인터로 관리
+    FramePresenter* m_presenter = nullptr; // 엔진 -> 뷰 갱신을 프레임 단위로 합침 (엔진 스레드)
 
     // UI Components
     std::unique_ptr<MainWindow> m_mainWindow;
@@ -32,6 +35,7 @@ private:
     // Controllers, Managers
     std::unique_ptr<SettingsManager> m_settingsManager;
     std::unique_ptr<SettingsUiController> m_settingsController;
+    std::unique_ptr<MeasurementRecorder> m_recorder; // 측정 데이터 기록 (열기 실패 시 nullptr)
 };
 
 #endif // SYSTEM_CONTROLLER_H
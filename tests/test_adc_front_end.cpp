@@ -0,0 +1,108 @@
+#include <QtTest>
+#include <cmath>
+#include <numbers>
+#include "../adc_front_end.h"
+
+class TestAdcFrontEnd : public QObject
+{
+    Q_OBJECT
+
+private:
+    // 오차/잡음 없는 설정 (양자화만 bits로 지정)
+    static AdcFrontEnd::Settings idealSettings(int bits);
+
+private slots:
+    void testQuantizationAndClipping();
+    void testGainOffsetAndPhaseDelay();
+    void testNoiseStatisticsAndSeed();
+};
+
+AdcFrontEnd::Settings TestAdcFrontEnd::idealSettings(int bits)
+{
+    AdcFrontEnd::Settings settings;
+    settings.bits = bits;
+    settings.voltageFullScale = 400.0;
+    settings.currentFullScale = 50.0;
+    return settings;
+}
+
+void TestAdcFrontEnd::testQuantizationAndClipping()
+{
+    AdcFrontEnd adc(1);
+    adc.setSettings(idealSettings(8));
+
+    // 8비트, ±400V: LSB = 3.125V, 코드 범위 [-128, 127]
+    AdcFrontEnd::Frame frame = {100.0, 1.6, 1000.0, -1000.0, 0.1, 49.0};
+    adc.process(frame);
+    QCOMPARE(frame[AdcFrontEnd::VoltageA], 100.0);
+    QCOMPARE(frame[AdcFrontEnd::VoltageB], 3.125);
+    QCOMPARE(frame[AdcFrontEnd::VoltageC], 127 * 3.125);
+    QCOMPARE(frame[AdcFrontEnd::CurrentA], -50.0);
+    QCOMPARE(frame[AdcFrontEnd::CurrentB], 0.0);
+
+    // bits = 0이면 양자화 없이 그대로
+    adc.setSettings(idealSettings(0));
+    frame = {1.2345, 0.0, 0.0, 0.0, 0.0, 0.0};
+    adc.process(frame);
+    QCOMPARE(frame[AdcFrontEnd::VoltageA], 1.2345);
+}
+
+void TestAdcFrontEnd::testGainOffsetAndPhaseDelay()
+{
+    constexpr double SampleRate = 1000.0;
+    constexpr double Frequency = 50.0;
+
+    AdcFrontEnd adc(1);
+    auto settings = idealSettings(0);
+    settings.channels[AdcFrontEnd::VoltageA].gain = 1.01;
+    settings.channels[AdcFrontEnd::VoltageA].offset = 0.5;
+    settings.channels[AdcFrontEnd::VoltageB].phaseErrorDeg = 9.0; // 50Hz/1kHz에서 0.5샘플
+    adc.setSettings(settings);
+    adc.setTiming(SampleRate, Frequency);
+
+    double previous = 0.0;
+    for(int n{0}; n < 40; ++n) {
+        const double x = 100.0 * std::sin(2.0 * std::numbers::pi * Frequency * n / SampleRate);
+        AdcFrontEnd::Frame frame = {x, x, 0.0, 0.0, 0.0, 0.0};
+        adc.process(frame);
+        QVERIFY(std::abs(frame[AdcFrontEnd::VoltageA] - (1.01 * x + 0.5)) < 1e-12);
+        if(n > 0) {
+            QVERIFY(std::abs(frame[AdcFrontEnd::VoltageB] - 0.5 * (x + previous)) < 1e-12);
+        }
+        previous = x;
+    }
+}
+
+void TestAdcFrontEnd::testNoiseStatisticsAndSeed()
+{
+    auto settings = idealSettings(0);
+    settings.channels[AdcFrontEnd::VoltageA].whiteNoiseRms = 2.0;
+    settings.channels[AdcFrontEnd::CurrentC].pinkNoiseRms = 1.0;
+
+    AdcFrontEnd adc(42);
+    AdcFrontEnd same(42);
+    adc.setSettings(settings);
+    same.setSettings(settings);
+
+    constexpr int Count = 200'000;
+    double sum = 0.0;
+    double sumSq = 0.0;
+    double pinkSumSq = 0.0;
+    for(int n{0}; n < Count; ++n) {
+        AdcFrontEnd::Frame frame{};
+        AdcFrontEnd::Frame other{};
+        adc.process(frame);
+        same.process(other);
+        QCOMPARE(frame, other); // 같은 시드는 같은 잡음열
+        sum += frame[AdcFrontEnd::VoltageA];
+        sumSq += frame[AdcFrontEnd::VoltageA] * frame[AdcFrontEnd::VoltageA];
+        pinkSumSq += frame[AdcFrontEnd::CurrentC] * frame[AdcFrontEnd::CurrentC];
+        QCOMPARE(frame[AdcFrontEnd::VoltageB], 0.0); // 잡음 없는 채널
+    }
+    QVERIFY(std::abs(sum / Count) < 0.05);
+    QVERIFY(std::abs(std::sqrt(sumSq / Count) - 2.0) < 0.05);
+    QVERIFY(std::abs(std::sqrt(pinkSumSq / Count) - 1.0) < 0.15);
+}
+
+QTEST_MAIN(TestAdcFrontEnd)
+#include "test_adc_front_end.moc"
@@ -0,0 +1,146 @@
+#include <QtTest>
+#include "../aggregation_engine.h"
+
+class TestAggregationEngine : public QObject
+{
+    Q_OBJECT
+
+private:
+    // 주어진 주파수의 1사이클 측정값 생성 (timestamp = 사이클 종료 시각)
+    MeasuredData createCycle(std::chrono::nanoseconds endTime, double voltageRms, double currentRms = 10.0);
+
+    // 특정 단계의 결과만 추출
+    QList<AggregatedData> collect(const QSignalSpy& spy, AggregationTier tier);
+
+private slots:
+    void testBaseWindow50Hz();
+    void testBaseWindow60Hz();
+    void testShortIntervalFromBaseWindows();
+    void testTenMinuteRtcAlignmentAndFlag();
+};
+
+MeasuredData TestAggregationEngine::createCycle(std::chrono::nanoseconds endTime, double voltageRms, double currentRms)
+{
+    MeasuredData data;
+    data.timestamp = endTime;
+    data.voltageRms = {voltageRms, voltageRms, voltageRms};
+    data.voltageRms_ll = {voltageRms * std::sqrt(3.0), voltageRms * std::sqrt(3.0), voltageRms * std::sqrt(3.0)};
+    data.currentRms = {currentRms, currentRms, currentRms};
+    data.activePower = {voltageRms * currentRms, voltageRms * currentRms, voltageRms * currentRms};
+    data.fundamentalVoltage.a.order = 1;
+    return data;
+}
+
+QList<AggregatedData> TestAggregationEngine::collect(const QSignalSpy& spy, AggregationTier tier)
+{
+    QList<AggregatedData> result;
+    for(const auto& args : spy) {
+        auto data = args.at(0).value<AggregatedData>();
+        if(data.tier == tier) result.append(data);
+    }
+    return result;
+}
+
+void TestAggregationEngine::testBaseWindow50Hz()
+{
+    AggregationEngine engine;
+    QSignalSpy spy(&engine, &AggregationEngine::intervalAggregated);
+
+    const std::chrono::nanoseconds period(20'000'000); // 50Hz
+
+    // 처음 10사이클: 100V, 다음 10사이클: 200V
+    for(int n{1}; n <= 20; ++n) {
+        engine.process(createCycle(period * n, (n <= 10) ? 100.0 : 200.0));
+    }
+
+    auto windows = collect(spy, AggregationTier::BaseWindow);
+    QCOMPARE(windows.size(), 2);
+    QCOMPARE(windows[0].cycleCount, 10);
+    QVERIFY(std::abs(windows[0].voltageRms.a - 100.0) < 1e-9);
+    QVERIFY(std::abs(windows[1].voltageRms.a - 200.0) < 1e-9);
+    QVERIFY(std::abs(windows[1].frequency - 50.0) < 1e-6);
+    QCOMPARE(engine.baseWindowCycles(), 10);
+}
+
+void TestAggregationEngine::testBaseWindow60Hz()
+{
+    AggregationEngine engine;
+    engine.setNominalFrequency(60.0);
+    QSignalSpy spy(&engine, &AggregationEngine::intervalAggregated);
+
+    // 60Hz 주기 (정수 ns 오차를 피하기 위해 누적 시간으로 계산)
+    auto endTime = [](int n) {
+        return std::chrono::nanoseconds(static_cast<long long>(n * 1e9 / 60.0));
+    };
+
+    // 공칭 60Hz이면 초기화 직후 첫 구간부터 12사이클 (200ms)
+    for(int n{1}; n <= 12 + 12; ++n) {
+        engine.process(createCycle(endTime(n), 120.0));
+    }
+
+    auto windows = collect(spy, AggregationTier::BaseWindow);
+    QCOMPARE(windows.size(), 2);
+    QCOMPARE(windows[0].cycleCount, 12);
+    QCOMPARE(windows[1].cycleCount, 12);
+    const auto firstWindowNs = (windows[0].endTime - endTime(0)).count();
+    QVERIFY(std::abs(firstWindowNs - 200'000'000LL) <= 1);
+    QVERIFY(std::abs(windows[1].frequency - 60.0) < 1e-3);
+
+    // reset 후에도 공칭 주파수 기준 유지
+    engine.reset();
+    QCOMPARE(engine.baseWindowCycles(), 12);
+}
+
+void TestAggregationEngine::testShortIntervalFromBaseWindows()
+{
+    AggregationEngine engine;
+    QSignalSpy spy(&engine, &AggregationEngine::intervalAggregated);
+
+    const std::chrono::nanoseconds period(20'000'000);
+
+    // 150사이클 중 앞 75사이클 100V, 뒤 75사이클 200V
+    for(int n{1}; n <= 150; ++n) {
+        engine.process(createCycle(period * n, (n <= 75) ? 100.0 : 200.0));
+    }
+
+    auto shortIntervals = collect(spy, AggregationTier::ShortInterval);
+    QCOMPARE(shortIntervals.size(), 1);
+    QCOMPARE(shortIntervals[0].cycleCount, 150);
+
+    // 사이클 RMS의 제곱 평균: sqrt((100^2 + 200^2) / 2)
+    const double expected = std::sqrt((100.0 * 100.0 + 200.0 * 200.0) / 2.0);
+    QVERIFY(std::abs(shortIntervals[0].voltageRms.a - expected) < 1e-9);
+    QVERIFY(std::abs(shortIntervals[0].activePower.a - (1000.0 + 2000.0) / 2.0) < 1e-9);
+}
+
+void TestAggregationEngine::testTenMinuteRtcAlignmentAndFlag()
+{
+    AggregationEngine engine;
+    QSignalSpy spy(&engine, &AggregationEngine::intervalAggregated);
+
+    const std::chrono::nanoseconds period(20'000'000);
+
+    // 시각 0 에서 시작하여 10분 경계(600s)를 넘을 때까지 입력
+    const int cyclesToTick = 600 * 50;
+    for(int n{1}; n <= cyclesToTick + 10; ++n) {
+        if(n == 100) {
+            engine.flagCurrentInterval(); // 첫 10분 구간 중 이벤트 발생
+        }
+        engine.process(createCycle(period * n, 230.0));
+    }
+
+    auto tenMinutes = collect(spy, AggregationTier::TenMinutes);
+    QCOMPARE(tenMinutes.size(), 1);
+    QCOMPARE(tenMinutes[0].endTime, std::chrono::nanoseconds(std::chrono::seconds(600)));
+    QCOMPARE(tenMinutes[0].cycleCount, cyclesToTick);
+    QVERIFY(tenMinutes[0].flagged);
+    QVERIFY(std::abs(tenMinutes[0].voltageRms.a - 230.0) < 1e-9);
+
+    // 플래그는 해당 기본 구간에만 설정되고 다음 구간에는 남지 않음
+    auto windows = collect(spy, AggregationTier::BaseWindow);
+    QVERIFY(windows[9].flagged);
+    QVERIFY(!windows.back().flagged);
+}
+
+QTEST_MAIN(TestAggregationEngine)
+#include "test_aggregation_engine.moc"
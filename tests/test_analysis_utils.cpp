@@ -1,11 +1,17 @@
 #include <QtTest/QtTest>
 #include "../analysis_utils.h"
+#include "../one_second_accumulator.h"
+#include "../synchronous_resampler.h"
 
 // QTest 메인 함수 생성을 위한 매크로 사용
 class TestAnalysisUtils : public QObject
 {
     Q_OBJECT
 
+private:
+    // 엔진과 같은 방식으로 한 레코드에서 RMS/유효 전력과 기본파 페이저를 모두 구함
+    static MeasuredData measureRecord(const std::vector<DataPoint>& record);
+
 private slots:
     // 1. RMS 계산 테스트 (DC) 신호
     void testCalculateTotalRms_DC();
@@ -29,8 +35,49 @@ private slots:
 
     // 7. buildOneSecondSummary 전수 검사
     void testBuildOneSecondSummary();
+
+    // 스트리밍 집계기: 지배 차수 변경 및 구간 초기화
+    void testOneSecondAccumulator_ResetAndDominantOrder();
+
+    // 창 함수 표 캐시와 coherent gain/ENBW 보정, 제로 패딩
+    void testWindowTablesAndScaling();
+
+    // 차수별 고조파 P/Q와 대칭 성분 배열
+    void testHarmonicOrderData();
+
+    // IEEE 1459 전력 분해 (상별, 3상 유효값)
+    void testIeee1459Decomposition();
+    // 순수 정현파는 사이클당 샘플 수가 2의 거듭제곱이 아니어도 비기본파 성분 0
+    void testIeee1459PureSinusoid();
 };
 
+MeasuredData TestAnalysisUtils::measureRecord(const std::vector<DataPoint>& record)
+{
+    MeasuredData cycle;
+    cycle.voltageRms = AnalysisUtils::calculateTotalRms(record, AnalysisUtils::DataType::Voltage);
+    cycle.currentRms = AnalysisUtils::calculateTotalRms(record, AnalysisUtils::DataType::Current);
+    cycle.activePower = AnalysisUtils::calculateActivePower(record);
+    cycle.voltageRms_ll = AnalysisUtils::calculateTotalRms_ll(record);
+    cycle.residualCurrentRms = AnalysisUtils::calculateResidualRms(record, AnalysisUtils::DataType::Current);
+    for(int phase{0}; phase < 3; ++phase) {
+        const auto v = AnalysisUtils::calculateSpectrum(record, AnalysisUtils::DataType::Voltage, phase, false);
+        const auto i = AnalysisUtils::calculateSpectrum(record, AnalysisUtils::DataType::Current, phase, false);
+        if(!v || !i) return cycle;
+        AnalysisUtils::getPhaseComponent(phase, cycle.fundamentalVoltage) = AnalysisUtils::convertSpectrumToHarmonics(*v)[1];
+        AnalysisUtils::getPhaseComponent(phase, cycle.fundamentalCurrent) = AnalysisUtils::convertSpectrumToHarmonics(*i)[1];
+    }
+    const auto lineToLine = [](const HarmonicAnalysisResult& from, const HarmonicAnalysisResult& to) {
+        HarmonicAnalysisResult result;
+        result.phasor = from.phasor - to.phasor;
+        result.rms = std::abs(result.phasor);
+        return result;
+    };
+    cycle.fundamentalVoltage_ll.ab = lineToLine(cycle.fundamentalVoltage.a, cycle.fundamentalVoltage.b);
+    cycle.fundamentalVoltage_ll.bc = lineToLine(cycle.fundamentalVoltage.b, cycle.fundamentalVoltage.c);
+    cycle.fundamentalVoltage_ll.ca = lineToLine(cycle.fundamentalVoltage.c, cycle.fundamentalVoltage.a);
+    return cycle;
+}
+
 void TestAnalysisUtils::testCalculateTotalRms_DC()
 {
     std::vector<DataPoint> samples(100);
@@ -291,5 +338,293 @@ void TestAnalysisUtils::testBuildOneSecondSummary()
     QCOMPARE(summary.lastCycleVoltageHarmonics.a[1].rms, 20.0);
 }
 
+void TestAnalysisUtils::testOneSecondAccumulator_ResetAndDominantOrder()
+{
+    OneSecondAccumulator accumulator;
+
+    // 1번째 구간: 100V 1사이클 (잔여값이 다음 구간에 남으면 안 됨)
+    MeasuredData old;
+    old.timestamp = std::chrono::nanoseconds(0);
+    old.voltageRms = {100.0, 100.0, 100.0};
+    old.dominantVoltage.a = {5, 50.0, 0.0, std::complex<double>(50.0, 0.0)};
+    accumulator.add(old);
+    QCOMPARE(accumulator.count(), size_t(1));
+
+    accumulator.reset();
+    QCOMPARE(accumulator.count(), size_t(0));
+
+    // 2번째 구간: 지배 차수가 3차 -> 5차 -> 3차 순으로 변경
+    MeasuredData d1;
+    d1.timestamp = std::chrono::nanoseconds(500'000'000);
+    d1.voltageRms = {200.0, 200.0, 200.0};
+    d1.fundamentalVoltage.a.order = 1;
+    d1.dominantVoltage.a = {3, 10.0, 0.0, std::complex<double>(10.0, 0.0)};
+
+    MeasuredData d2 = d1;
+    d2.timestamp = std::chrono::nanoseconds(600'000'000);
+    d2.dominantVoltage.a = {5, 40.0, 0.0, std::complex<double>(40.0, 0.0)};
+
+    MeasuredData d3 = d1;
+    d3.timestamp = std::chrono::nanoseconds(700'000'000);
+    d3.dominantVoltage.a = {3, 20.0, 0.0, std::complex<double>(20.0, 0.0)};
+
+    accumulator.add(d1);
+    accumulator.add(d2);
+    accumulator.add(d3);
+
+    OneSecondSummaryData summary = accumulator.finalize(d3);
+
+    // 이전 구간 값이 섞이지 않아야 함
+    QVERIFY(std::abs(summary.totalVoltageRms.a - 200.0) < 0.001);
+
+    // 3차가 나타난 사이클만 합산, 전체 사이클 수로 평균: sqrt((10^2 + 20^2) / 3)
+    QCOMPARE(summary.dominantHarmonicVoltageOrder, 3);
+    QVERIFY(std::abs(summary.dominantHarmonicVoltageRms - std::sqrt(500.0 / 3.0)) < 0.001);
+
+    // 마지막 두 사이클 간격 0.1s, 차수 1 -> 10Hz
+    QVERIFY(std::abs(summary.frequency - 10.0) < 0.001);
+
+    // 배치 함수와 결과가 동일해야 함
+    OneSecondSummaryData batch = AnalysisUtils::buildOneSecondSummary({d1, d2, d3});
+    QCOMPARE(batch.dominantHarmonicVoltageRms, summary.dominantHarmonicVoltageRms);
+    QCOMPARE(batch.totalVoltageRms.a, summary.totalVoltageRms.a);
+}
+
+void TestAnalysisUtils::testWindowTablesAndScaling()
+{
+    using Window = AnalysisUtils::WindowType;
+    const size_t N = 256;
+
+    // 같은 (종류, N)은 같은 표를 돌려줌
+    QCOMPARE(&AnalysisUtils::windowTable(Window::Hann, N), &AnalysisUtils::windowTable(Window::Hann, N));
+
+    // 알려진 ENBW (빈 단위)
+    QVERIFY(std::abs(AnalysisUtils::windowTable(Window::Rectangular, N).enbw - 1.0) < 1e-12);
+    QVERIFY(std::abs(AnalysisUtils::windowTable(Window::Hann, N).enbw - 1.5) < 1e-9);
+    QVERIFY(std::abs(AnalysisUtils::windowTable(Window::Hamming, N).enbw - 1.3628) < 1e-3);
+    QVERIFY(std::abs(AnalysisUtils::windowTable(Window::BlackmanHarris, N).enbw - 2.0044) < 1e-3);
+    QVERIFY(std::abs(AnalysisUtils::windowTable(Window::FlatTop, N).enbw - 3.77) < 0.01);
+    QCOMPARE(AnalysisUtils::windowTable(Window::Hann, N).coherentGain, 0.5);
+
+    auto makeTone = [](size_t count, double cyclesInWindow, double amplitude) {
+        std::vector<DataPoint> samples(count);
+        for(size_t i = 0; i < count; ++i) {
+            samples[i].voltage.a = amplitude * std::cos(2.0 * std::numbers::pi * cyclesInWindow * i / count + 0.3);
+        }
+        return samples;
+    };
+
+    // 빈 중심 정현파: 모든 창에서 coherent gain 보정 후 RMS가 맞아야 함
+    // (cos 급수 창은 음의 주파수 성분 누설이 정확히 0, Kaiser는 사이드로브만큼 남음)
+    const double amplitude = 100.0;
+    const auto tone = makeTone(N, 16.0, amplitude);
+    for(Window type : {Window::Rectangular, Window::Hann, Window::Hamming, Window::BlackmanHarris, Window::FlatTop, Window::Kaiser}) {
+        AnalysisUtils::SpectrumOptions options;
+        options.window = type;
+        auto result = AnalysisUtils::calculateSpectrum(tone, AnalysisUtils::DataType::Voltage, 0, options);
+        QVERIFY(result.has_value());
+        QVERIFY(std::abs(std::abs((*result)[16]) - amplitude / std::sqrt(2.0)) < 1e-4 * amplitude);
+    }
+
+    // 반 빈 어긋난 정현파: flat-top은 스캘럽 손실이 거의 없음 (Hann은 약 -1.4dB)
+    {
+        const auto offTone = makeTone(N, 16.5, amplitude);
+        AnalysisUtils::SpectrumOptions options;
+        options.window = Window::FlatTop;
+        auto result = AnalysisUtils::calculateSpectrum(offTone, AnalysisUtils::DataType::Voltage, 0, options);
+        QVERIFY(result.has_value());
+        const double peak = std::max(std::abs((*result)[16]), std::abs((*result)[17]));
+        QVERIFY(std::abs(peak / (amplitude / std::sqrt(2.0)) - 1.0) < 0.002);
+    }
+
+    // 전력 스케일: 백색 잡음의 빈 전력 합 ≈ 신호 분산
+    {
+        std::vector<DataPoint> noise(4096);
+        uint32_t state = 12345;
+        double variance = 0.0;
+        for(auto& p : noise) {
+            state = state * 1664525u + 1013904223u;
+            p.voltage.a = (static_cast<double>(state) / 4294967296.0 - 0.5) * 2.0;
+            variance += p.voltage.a * p.voltage.a;
+        }
+        variance /= noise.size();
+
+        AnalysisUtils::SpectrumOptions options;
+        options.window = Window::BlackmanHarris;
+        options.scaling = AnalysisUtils::SpectrumScaling::Power;
+        auto result = AnalysisUtils::calculateSpectrum(noise, AnalysisUtils::DataType::Voltage, 0, options);
+        QVERIFY(result.has_value());
+        double power = 0.0;
+        for(const auto& bin : *result) {
+            power += std::norm(bin);
+        }
+        QVERIFY(std::abs(power / variance - 1.0) < 0.05);
+    }
+
+    // 제로 패딩: 빈 수가 늘고 빈 간격이 좁아져도 같은 정현파 진폭
+    {
+        AnalysisUtils::SpectrumOptions options;
+        options.window = Window::Hann;
+        options.fftLength = 4 * N;
+        auto result = AnalysisUtils::calculateSpectrum(tone, AnalysisUtils::DataType::Voltage, 0, options);
+        QVERIFY(result.has_value());
+        QCOMPARE(result->size(), 2 * N + 1);
+        QVERIFY(std::abs(std::abs((*result)[64]) - amplitude / std::sqrt(2.0)) < 1e-6 * amplitude);
+    }
+}
+
+void TestAnalysisUtils::testHarmonicOrderData()
+{
+    constexpr size_t Orders = 8;
+    const double deg120 = 2.0 * std::numbers::pi / 3.0;
+    GenericPhaseData<AnalysisUtils::Spectrum> voltage{AnalysisUtils::Spectrum(Orders), AnalysisUtils::Spectrum(Orders), AnalysisUtils::Spectrum(Orders)};
+    GenericPhaseData<AnalysisUtils::Spectrum> current = voltage;
+
+    // 1차: 정상분 100V, 전류 10A가 30도 뒤짐 / 3차: 영상분 5V, 전류 2A가 90도 앞섬 / 5차: 역상분 10V
+    for(int phase{0}; phase < 3; ++phase) {
+        auto& v = AnalysisUtils::getPhaseComponent(phase, voltage);
+        auto& i = AnalysisUtils::getPhaseComponent(phase, current);
+        v[1] = std::polar(100.0, -phase * deg120);
+        i[1] = std::polar(10.0, -phase * deg120 - std::numbers::pi / 6.0);
+        v[3] = std::polar(5.0, 0.0);
+        i[3] = std::polar(2.0, std::numbers::pi / 2.0);
+        v[5] = std::polar(10.0, phase * deg120);
+    }
+
+    const HarmonicOrderData data = AnalysisUtils::calculateHarmonicOrderData(voltage, current);
+    QCOMPARE(data.orderCount(), Orders);
+    for(int phase{0}; phase < 3; ++phase) {
+        const auto& p = AnalysisUtils::getPhaseComponent(phase, data.activePower);
+        const auto& q = AnalysisUtils::getPhaseComponent(phase, data.reactivePower);
+        QCOMPARE_LE(std::abs(p[1] - 1000.0 * std::cos(std::numbers::pi / 6.0)), 1e-9);
+        QCOMPARE_LE(std::abs(q[1] - 500.0), 1e-9);
+        QCOMPARE_LE(std::abs(p[3]), 1e-9);
+        QCOMPARE_LE(std::abs(q[3] + 10.0), 1e-9);
+        QCOMPARE(p[5], 0.0);
+    }
+
+    QCOMPARE_LE(std::abs(data.voltageSequence.positive[1] - 100.0), 1e-9);
+    QCOMPARE_LE(data.voltageSequence.negative[1], 1e-9);
+    QCOMPARE_LE(std::abs(data.voltageSequence.zero[3] - 5.0), 1e-9);
+    QCOMPARE_LE(data.voltageSequence.positive[3], 1e-9);
+    QCOMPARE_LE(std::abs(data.voltageSequence.negative[5] - 10.0), 1e-9);
+    QCOMPARE_LE(data.voltageSequence.positive[5], 1e-9);
+    QCOMPARE_LE(std::abs(data.currentSequence.zero[3] - 2.0), 1e-9);
+
+    // 기본파는 기존 단일 차수 계산과 일치
+    HarmonicAnalysisResult ia, ib, ic;
+    ia.phasor = current.a[1];
+    ib.phasor = current.b[1];
+    ic.phasor = current.c[1];
+    const SymmetricalComponents sym = AnalysisUtils::calculateSymmetricalComponents(ia, ib, ic);
+    QCOMPARE_LE(std::abs(data.currentSequence.positive[1] - sym.positive.magnitude), 1e-9);
+    QCOMPARE_LE(std::abs(data.currentSequence.negative[1] - sym.negative.magnitude), 1e-9);
+
+    // 상 하나라도 스펙트럼이 없으면 빈 결과
+    current.b.clear();
+    QCOMPARE(AnalysisUtils::calculateHarmonicOrderData(voltage, current).orderCount(), size_t{0});
+}
+
+void TestAnalysisUtils::testIeee1459Decomposition()
+{
+    // 평형 3상 한 사이클 64점: 전압 230V + 5고조파 20V, 전류 10A(30도 지상) + 5고조파 3A(60도 지상)
+    constexpr int N = 64;
+    const double deg120 = 2.0 * std::numbers::pi / 3.0;
+    const double lag30 = std::numbers::pi / 6.0;
+    const double lag60 = std::numbers::pi / 3.0;
+    std::vector<DataPoint> samples(N);
+    for(int n{0}; n < N; ++n) {
+        const double theta = 2.0 * std::numbers::pi * n / N;
+        for(int phase{0}; phase < 3; ++phase) {
+            const double x = theta - phase * deg120;
+            AnalysisUtils::getPhaseComponent(phase, samples[n].voltage) = std::sqrt(2.0) * (230.0 * std::sin(x) + 20.0 * std::sin(5.0 * x));
+            AnalysisUtils::getPhaseComponent(phase, samples[n].current) = std::sqrt(2.0) * (10.0 * std::sin(x - lag30) + 3.0 * std::sin(5.0 * x - lag60));
+        }
+        samples[n].voltage_ll.ab = samples[n].voltage.a - samples[n].voltage.b;
+        samples[n].voltage_ll.bc = samples[n].voltage.b - samples[n].voltage.c;
+        samples[n].voltage_ll.ca = samples[n].voltage.c - samples[n].voltage.a;
+    }
+
+    const Ieee1459Data power = AnalysisUtils::calculateIeee1459(measureRecord(samples));
+    // kiss_fft가 단정밀도라 기본파 RMS에 상대 1e-7 수준 오차, 직교 차이(VH 등)에서 조금 커짐
+    const auto near = [](double actual, double expected) { return std::abs(actual - expected) <= 1e-4 * std::max(std::abs(expected), 1.0); };
+    for(int phase{0}; phase < 3; ++phase) {
+        const Ieee1459Power& p = AnalysisUtils::getPhaseComponent(phase, power.phase);
+        QVERIFY(near(p.p1, 2300.0 * std::cos(lag30)));
+        QVERIFY(near(p.q1, 2300.0 * std::sin(lag30)));
+        QVERIFY(near(p.s1, 2300.0));
+        QVERIFY(near(p.ph, 60.0 * std::cos(lag60)));
+        QVERIFY(near(p.di, 230.0 * 3.0));
+        QVERIFY(near(p.dv, 20.0 * 10.0));
+        QVERIFY(near(p.sh, 60.0));
+        QVERIFY(near(p.dh, 60.0 * std::sin(lag60)));
+        QVERIFY(near(p.pf1, std::cos(lag30)));
+        // S² = S1² + DI² + DV² + SH²
+        QVERIFY(near(p.s * p.s, p.s1 * p.s1 + p.di * p.di + p.dv * p.dv + p.sh * p.sh));
+        // Q1은 sqrt(S² - P²)보다 작음 (왜곡 전력 제외)
+        QVERIFY(p.q1 < p.n);
+    }
+
+    // 평형, 중성선 전류 없음: Ve = V, Ie = I, 시스템 값 = 상별 값의 3배
+    const Ieee1459SystemPower& system = power.system;
+    QVERIFY(near(system.ve, std::hypot(230.0, 20.0)));
+    QVERIFY(near(system.ie, std::hypot(10.0, 3.0)));
+    QVERIFY(near(system.s, 3.0 * power.phase.a.s));
+    QVERIFY(near(system.di, 3.0 * power.phase.a.di));
+    QVERIFY(near(system.p1Positive, system.p1));
+    QVERIFY(system.s1Unbalanced < 0.01);
+    QVERIFY(near(system.pf1, std::cos(lag30)));
+}
+
+void TestAnalysisUtils::testIeee1459PureSinusoid()
+{
+    // fs = 1kHz, 평형 3상 230V / 10A(30도 지상) 순수 정현파
+    const double deg120 = 2.0 * std::numbers::pi / 3.0;
+    const double lag30 = std::numbers::pi / 6.0;
+    const auto makeSample = [&](int n, double frequency) {
+        const double theta = 2.0 * std::numbers::pi * frequency * n / 1000.0;
+        DataPoint point{};
+        point.timestamp = std::chrono::microseconds(1000) * n;
+        for(int phase{0}; phase < 3; ++phase) {
+            const double x = theta - phase * deg120;
+            AnalysisUtils::getPhaseComponent(phase, point.voltage) = std::sqrt(2.0) * 230.0 * std::sin(x);
+            AnalysisUtils::getPhaseComponent(phase, point.current) = std::sqrt(2.0) * 10.0 * std::sin(x - lag30);
+        }
+        point.voltage_ll.ab = point.voltage.a - point.voltage.b;
+        point.voltage_ll.bc = point.voltage.b - point.voltage.c;
+        point.voltage_ll.ca = point.voltage.c - point.voltage.a;
+        return point;
+    };
+
+    // 1) 50Hz에 고정된 20샘플 사이클 버퍼 (직접 FFT)
+    std::vector<DataPoint> locked;
+    for(int n{0}; n < 20; ++n) {
+        locked.push_back(makeSample(n, 50.0));
+    }
+
+    // 2) 51.3Hz를 20샘플/사이클로 샘플링 -> 한 주기를 32점으로 재표본화한 레코드
+    SynchronousResampler resampler;
+    resampler.configure(20);
+    for(int n{0}; n < 200; ++n) {
+        resampler.push(makeSample(n, 51.3));
+    }
+    QVERIFY(resampler.resample(1000.0 / 51.3, std::chrono::microseconds(1000)));
+
+    const std::array<const std::vector<DataPoint>*, 2> records = {&locked, &resampler.cycle()};
+    for(const auto* record : records) {
+        const Ieee1459Data power = AnalysisUtils::calculateIeee1459(measureRecord(*record));
+        for(int phase{0}; phase < 3; ++phase) {
+            const Ieee1459Power& p = AnalysisUtils::getPhaseComponent(phase, power.phase);
+            // V와 V1이 같은 레코드이므로 VH = DV / I1, IH = DI / V1, SN 모두 거의 0 (단정밀도 FFT 오차 수준)
+            QVERIFY(std::abs(p.s1 - 2300.0) < 1.0);
+            QVERIFY(p.dv / p.s1 < 2e-3);
+            QVERIFY(p.di / p.s1 < 2e-3);
+            QVERIFY(p.sn / p.s1 < 3e-3);
+            QVERIFY(std::abs(p.p - p.p1) < 1e-3 * p.s1);
+        }
+        QVERIFY(power.system.sn / power.system.s1 < 3e-3);
+    }
+}
+
 QTEST_MAIN(TestAnalysisUtils)
 #include "test_analysis_utils.moc"
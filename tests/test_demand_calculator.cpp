@@ -1,7 +1,7 @@
 #include <QtTest>
-#include <QDateTime>
 #include <complex>
 #include "../demand_calculator.h"
+#include "../config.h"
 
 class TestDemandCalculator : public QObject
 {
@@ -18,6 +18,12 @@ private slots:
     void testTimestampPolicy();
 
     void testFullMappingCoverage();
+
+    void testNullSnapshotIgnored();
+
+    // 블록/슬라이딩/열적 수요
+    void testDemandIntervals();
+    void testSlidingDemandAndWindowMax();
 };
 
 void TestDemandCalculator::testProcessOneSecondData()
@@ -37,7 +43,7 @@ void TestDemandCalculator::testProcessOneSecondData()
     data1.frequency = 60.0;
     data1.voltageThd = {1.0, 1.0, 1.0};
 
-    calculator.processOneSecondData(data1);
+    calculator.processOneSecondData(std::make_shared<const OneSecondSummaryData>(data1));
 
     // 검증
     QCOMPARE(demand.totalVoltageRms.a.max.value, 100.0);
@@ -46,8 +52,8 @@ void TestDemandCalculator::testProcessOneSecondData()
     QCOMPARE(demand.totalVoltageRms.b.min.value, 100.0);
     QCOMPARE(demand.totalVoltageRms.c.max.value, 100.0);
     QCOMPARE(demand.totalVoltageRms.c.min.value, 100.0);
-    QVERIFY(demand.totalVoltageRms.a.max.timestamp.isValid());
-    QVERIFY(demand.totalVoltageRms.a.min.timestamp.isValid());
+    QVERIFY(demand.totalVoltageRms.a.max.hasTimestamp());
+    QVERIFY(demand.totalVoltageRms.a.min.hasTimestamp());
 
     OneSecondSummaryData data2;
     data2.totalVoltageRms = {110.0, 90.0, 105.0};
@@ -55,10 +61,9 @@ void TestDemandCalculator::testProcessOneSecondData()
     data2.frequency = 60.1;
     data2.voltageThd = {2.0, 0.5, 1.5};
     data2.totalActivePower = 2500.0;
+    data2.timestamp = data1.timestamp + std::chrono::seconds(1);
 
-    QTest::qWait(100); // 타임스탬프 차이를 위해 잠시 대기
-
-    calculator.processOneSecondData(data2);
+    calculator.processOneSecondData(std::make_shared<const OneSecondSummaryData>(data2));
 
     // 검증
     QCOMPARE(demand.totalVoltageRms.a.max.value, 110.0);
@@ -67,8 +72,8 @@ void TestDemandCalculator::testProcessOneSecondData()
     QCOMPARE(demand.totalVoltageRms.b.min.value, 90.0);
     QCOMPARE(demand.totalVoltageRms.c.max.value, 105.0);
     QCOMPARE(demand.totalVoltageRms.c.min.value, 100.0);
-    QVERIFY(demand.totalVoltageRms.a.max.timestamp.isValid());
-    QVERIFY(demand.totalVoltageRms.a.min.timestamp.isValid());
+    QVERIFY(demand.totalVoltageRms.a.max.hasTimestamp());
+    QVERIFY(demand.totalVoltageRms.a.min.hasTimestamp());
 }
 
 void TestDemandCalculator::testSymmetricalComponentsBinding()
@@ -81,7 +86,7 @@ void TestDemandCalculator::testSymmetricalComponentsBinding()
     data.voltageSymmetricalComponents.positive = {95.0, 0.0};
     data.voltageSymmetricalComponents.negative = {3.0, -30.0};
 
-    calculator.processOneSecondData(data);
+    calculator.processOneSecondData(std::make_shared<const OneSecondSummaryData>(data));
 
     // 검증
     QCOMPARE(demand.voltageSymmetricalComponents.zero.value, 5.0);
@@ -99,7 +104,7 @@ void TestDemandCalculator::testNaNHandling()
                             std::numeric_limits<double>::quiet_NaN(),
                             std::numeric_limits<double>::quiet_NaN()};
 
-    calculator.processOneSecondData(data);
+    calculator.processOneSecondData(std::make_shared<const OneSecondSummaryData>(data));
 
     // NaN 값이 들어왔을 때 MinMaxTracker가 올바르게 처리하는지 검증
     // Nan 값은 무시되어야 함
@@ -115,44 +120,44 @@ void TestDemandCalculator::testTimestampPolicy()
 
     data.totalVoltageRms = {100.0, 100.0, 100.0};
 
+    // 타임스탬프는 요약 데이터의 시뮬레이션 시간을 따름
     // 1. 첫 번째 입력
-    calculator.processOneSecondData(data);
-    QDateTime firstMaxTime = calculator.getDemandData().totalVoltageRms.a.max.timestamp;
-    QDateTime firstMinTime = calculator.getDemandData().totalVoltageRms.a.min.timestamp;
-
-    QVERIFY(firstMaxTime.isValid());
-    QVERIFY(firstMinTime.isValid());
+    data.timestamp = std::chrono::seconds(1);
+    calculator.processOneSecondData(std::make_shared<const OneSecondSummaryData>(data));
+    TrackerTimestamp firstMaxTime = calculator.getDemandData().totalVoltageRms.a.max.timestamp;
+    TrackerTimestamp firstMinTime = calculator.getDemandData().totalVoltageRms.a.min.timestamp;
 
-    QTest::qWait(100); // 타임스탬프 차이를 위해 잠시 대기
+    QVERIFY(firstMaxTime != ValueWithTimestamp<double>::NoTimestamp);
+    QVERIFY(firstMinTime != ValueWithTimestamp<double>::NoTimestamp);
 
     // 2. 동일한 값 다시 입력
-    calculator.processOneSecondData(data);
-    QDateTime secondMaxTime = calculator.getDemandData().totalVoltageRms.a.max.timestamp;
-    QDateTime secondMinTime = calculator.getDemandData().totalVoltageRms.a.min.timestamp;
+    data.timestamp = std::chrono::seconds(2);
+    calculator.processOneSecondData(std::make_shared<const OneSecondSummaryData>(data));
+    TrackerTimestamp secondMaxTime = calculator.getDemandData().totalVoltageRms.a.max.timestamp;
+    TrackerTimestamp secondMinTime = calculator.getDemandData().totalVoltageRms.a.min.timestamp;
 
     // 검증: 동일한 값이므로 타임스탬프는 변경되지 않아야 함
     QCOMPARE(firstMaxTime, secondMaxTime);
     QCOMPARE(firstMinTime, secondMinTime);
 
-    QTest::qWait(100); // 타임스탬프 차이를 위해 잠시 대기
-
     // 3. 더 큰 값 입력 -> max 타임스탬프만 변경
+    data.timestamp = std::chrono::seconds(3);
     data.totalVoltageRms = {110.0, 110.0, 110.0};
-    calculator.processOneSecondData(data);
-    QDateTime thirdMaxTime = calculator.getDemandData().totalVoltageRms.a.max.timestamp;
-    QDateTime thirdMinTime = calculator.getDemandData().totalVoltageRms.a.min.timestamp;
+    calculator.processOneSecondData(std::make_shared<const OneSecondSummaryData>(data));
+    TrackerTimestamp thirdMaxTime = calculator.getDemandData().totalVoltageRms.a.max.timestamp;
+    TrackerTimestamp thirdMinTime = calculator.getDemandData().totalVoltageRms.a.min.timestamp;
     QVERIFY(thirdMaxTime > secondMaxTime);
     QCOMPARE(thirdMinTime, secondMinTime);
 
-    QTest::qWait(100); // 타임스탬프 차이를 위해 잠시 대기
-
     // 4. 더 작은 값 입력 -> min 타임스탬프만 변경
+    data.timestamp = std::chrono::seconds(4);
     data.totalVoltageRms = {90.0, 90.0, 90.0};
-    calculator.processOneSecondData(data);
-    QDateTime fourthMaxTime = calculator.getDemandData().totalVoltageRms.a.max.timestamp;
-    QDateTime fourthMinTime = calculator.getDemandData().totalVoltageRms.a.min.timestamp;
+    calculator.processOneSecondData(std::make_shared<const OneSecondSummaryData>(data));
+    TrackerTimestamp fourthMaxTime = calculator.getDemandData().totalVoltageRms.a.max.timestamp;
+    TrackerTimestamp fourthMinTime = calculator.getDemandData().totalVoltageRms.a.min.timestamp;
     QCOMPARE(fourthMaxTime, thirdMaxTime);
     QVERIFY(fourthMinTime > thirdMinTime);
+    QCOMPARE(fourthMinTime, TrackerTimestamp(std::chrono::seconds(4)));
 }
 
 void TestDemandCalculator::testFullMappingCoverage()
@@ -224,7 +229,7 @@ void TestDemandCalculator::testFullMappingCoverage()
     data.currentU2Unbalance = 0.2;
 
     // 2. 데이터 처리
-    calculator.processOneSecondData(data);
+    calculator.processOneSecondData(std::make_shared<const OneSecondSummaryData>(data));
 
     // 3. 각 필드가 올바르게 매핑되었는지 검증
     QCOMPARE(demand.totalVoltageRms.a.max.value, 121.0);
@@ -318,5 +323,84 @@ void TestDemandCalculator::testFullMappingCoverage()
 
 }
 
+void TestDemandCalculator::testNullSnapshotIgnored()
+{
+    DemandCalculator calculator;
+    QSignalSpy spy(&calculator, &DemandCalculator::demandDataUpdated);
+
+    // 빈 스냅샷은 무시되어야 하며 시그널도 발생하지 않음
+    calculator.processOneSecondData(OneSecondSummarySnapshot{});
+
+    QCOMPARE(spy.count(), 0);
+    QCOMPARE(calculator.getDemandData().totalVoltageRms.a.max.value, std::numeric_limits<double>::lowest());
+}
+
+void TestDemandCalculator::testDemandIntervals()
+{
+    DemandCalculator calculator;
+    calculator.setDemandInterval(7); // 지원하지 않는 구간은 무시
+    QCOMPARE(calculator.demandIntervalMinutes(), config::Demand::DefaultIntervalMinutes);
+
+    calculator.setDemandInterval(1);
+    QCOMPARE(calculator.demandIntervalMinutes(), 1);
+
+    const DemandData& demand = calculator.getDemandData();
+    OneSecondSummaryData data;
+
+    // 1. 첫 1분: 1000W
+    data.totalActivePower = 1000.0;
+    for(int sec{0}; sec < 60; ++sec) {
+        calculator.processOneSecondData(std::make_shared<const OneSecondSummaryData>(data));
+    }
+    QCOMPARE(demand.totalActivePowerDemand.block, 1000.0);
+
+    // 열적 수요는 구간 길이 동안 90% 응답
+    QVERIFY(std::abs(demand.totalActivePowerDemand.thermal - 900.0) < 1.0);
+
+    // 2. 다음 1분: 2000W -> 블록 수요 갱신, 최대 수요 레지스터 갱신
+    data.totalActivePower = 2000.0;
+    for(int sec{0}; sec < 60; ++sec) {
+        calculator.processOneSecondData(std::make_shared<const OneSecondSummaryData>(data));
+    }
+    QCOMPARE(demand.totalActivePowerDemand.block, 2000.0);
+    QCOMPARE(demand.totalActivePowerDemand.peakBlock.value, 2000.0);
+    QVERIFY(demand.totalActivePowerDemand.peakBlock.hasTimestamp());
+
+    // 3. 다시 500W -> 블록 수요는 내려가도 최대 수요는 유지
+    data.totalActivePower = 500.0;
+    for(int sec{0}; sec < 60; ++sec) {
+        calculator.processOneSecondData(std::make_shared<const OneSecondSummaryData>(data));
+    }
+    QCOMPARE(demand.totalActivePowerDemand.block, 500.0);
+    QCOMPARE(demand.totalActivePowerDemand.peakBlock.value, 2000.0);
+}
+
+void TestDemandCalculator::testSlidingDemandAndWindowMax()
+{
+    // 60초 구간, 서브 구간 15개 (4초)
+    DemandIntervalTracker tracker(60, 15);
+    const TrackerTimestamp now{0};
+
+    // 60초 동안 100, 이후 8초 동안 400
+    for(int sec{0}; sec < 60; ++sec) tracker.update(100.0, now);
+    QCOMPARE(tracker.values().sliding, 100.0);
+
+    for(int sec{0}; sec < 8; ++sec) tracker.update(400.0, now);
+
+    // 서브 구간 2개가 교체됨: (13 * 100 + 2 * 400) / 15
+    QVERIFY(std::abs(tracker.values().sliding - (13.0 * 100.0 + 2.0 * 400.0) / 15.0) < 1e-9);
+    QCOMPARE(tracker.values().windowMax, 400.0);
+
+    // 400이 윈도우(60초)를 벗어나면 최대값도 내려감
+    for(int sec{0}; sec < 60; ++sec) tracker.update(50.0, now);
+    QCOMPARE(tracker.values().windowMax, 50.0);
+    QVERIFY(std::abs(tracker.values().sliding - 50.0) < 1e-9);
+    QVERIFY(std::abs(tracker.values().peakSliding.value - (13.0 * 100.0 + 2.0 * 400.0) / 15.0) < 1e-9);
+
+    // NaN은 무시
+    tracker.update(std::numeric_limits<double>::quiet_NaN(), now);
+    QCOMPARE(tracker.values().windowMax, 50.0);
+}
+
 QTEST_MAIN(TestDemandCalculator)
 #include "test_demand_calculator.moc"
\ No newline at end of file
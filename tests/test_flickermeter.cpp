@@ -0,0 +1,109 @@
+#include <QtTest>
+#include <cmath>
+#include <numbers>
+#include "../flickermeter.h"
+
+class TestFlickermeter : public QObject
+{
+    Q_OBJECT
+
+private:
+    static constexpr double Frequency = 50.0;
+    static constexpr double SampleRate = 64.0 * Frequency;
+    static constexpr double Nominal = 230.0;
+
+    // A상에만 fm Hz, modulation(ΔV/V) 정현 진폭 변조를 넣고 seconds초 동안 입력.
+    // settleSeconds 이후의 평균 Pinst를 상별로 반환
+    Flickermeter::Lanes run(Flickermeter& meter, double fm, double modulation, double seconds, double settleSeconds);
+
+private slots:
+    void testReferenceModulationGivesUnitPinst();
+    void testSteadyVoltageHasNoFlicker();
+    void testClassifierPercentiles();
+    void testPstFromConstantPinst();
+};
+
+Flickermeter::Lanes TestFlickermeter::run(Flickermeter& meter, double fm, double modulation, double seconds, double settleSeconds)
+{
+    const double peak = Nominal * std::numbers::sqrt2;
+    Flickermeter::Lanes sum{};
+    int count = 0;
+    for(int k{0}; k < static_cast<int>(seconds * SampleRate); ++k) {
+        const double t = k / SampleRate;
+        const double envelope = 1.0 + modulation / 2.0 * std::sin(2.0 * std::numbers::pi * fm * t);
+        const double phase = 2.0 * std::numbers::pi * Frequency * t;
+        meter.process({peak * envelope * std::sin(phase),
+                       peak * std::sin(phase - 2.0 * std::numbers::pi / 3.0),
+                       peak * std::sin(phase + 2.0 * std::numbers::pi / 3.0)});
+        if(t >= settleSeconds) {
+            for(size_t i{0}; i < sum.size(); ++i) sum[i] += meter.pinst()[i];
+            ++count;
+        }
+    }
+    for(double& value : sum) value /= count;
+    return sum;
+}
+
+void TestFlickermeter::testReferenceModulationGivesUnitPinst()
+{
+    // IEC 61000-4-15: 8.8Hz, ΔV/V = 0.25% 정현 변조에서 Pinst = 1
+    Flickermeter meter;
+    meter.configure(SampleRate, Frequency);
+    meter.setNominalVoltages({Nominal, Nominal, Nominal});
+    meter.reset();
+    QVERIFY(meter.isEnabled());
+
+    const auto pinst = run(meter, 8.8, 0.0025, 25.0, 15.0);
+    QVERIFY(std::abs(pinst[0] - 1.0) < 0.05);
+    QVERIFY(pinst[1] < 0.01);
+    QVERIFY(pinst[2] < 0.01);
+}
+
+void TestFlickermeter::testSteadyVoltageHasNoFlicker()
+{
+    Flickermeter meter;
+    meter.configure(SampleRate, Frequency);
+    meter.setNominalVoltages({Nominal, Nominal, Nominal});
+    meter.reset();
+
+    const auto pinst = run(meter, 8.8, 0.0, 10.0, 2.0);
+    for(double value : pinst) {
+        QVERIFY(value < 0.01);
+    }
+    QVERIFY(std::isnan(meter.pst()[0])); // 10분 전에는 Pst 없음
+}
+
+void TestFlickermeter::testClassifierPercentiles()
+{
+    // 0.01 ~ 10.00 균등 분포: P50 ≈ 5, P1 ≈ 9.9 (클래스 폭만큼 오차 허용)
+    FlickerClassifier classifier;
+    for(int i{1}; i <= 1000; ++i) {
+        classifier.add(i / 100.0);
+    }
+    QCOMPARE(classifier.count(), size_t(1000));
+    QVERIFY(std::abs(classifier.percentile(50.0) - 5.0) < 0.1);
+    QVERIFY(std::abs(classifier.percentile(1.0) - 9.9) < 0.2);
+
+    classifier.clear();
+    QCOMPARE(classifier.count(), size_t(0));
+    QVERIFY(std::isnan(classifier.pst()));
+}
+
+void TestFlickermeter::testPstFromConstantPinst()
+{
+    // 모든 백분위수가 같으면 Pst = sqrt(가중치 합 0.5096 * Pinst)
+    FlickerClassifier classifier;
+    for(int i{0}; i < 60000; ++i) {
+        classifier.add(2.0);
+    }
+    QVERIFY(std::abs(classifier.pst() - std::sqrt(0.5096 * 2.0)) < 0.01);
+
+    FlickerClassifier steady;
+    for(int i{0}; i < 60000; ++i) {
+        steady.add(0.0);
+    }
+    QVERIFY(steady.pst() < 0.05);
+}
+
+QTEST_MAIN(TestFlickermeter)
+#include "test_flickermeter.moc"
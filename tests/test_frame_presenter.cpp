@@ -0,0 +1,74 @@
+#include <QtTest>
+#include <thread>
+#include <deque>
+#include "../frame_presenter.h"
+
+class TestFramePresenter : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    void testCoalescesToLatest();
+    void testBackpressure();
+};
+
+void TestFramePresenter::testCoalescesToLatest()
+{
+    FramePresenter presenter;
+    presenter.setFrameRate(20.0); // 50ms
+    QSignalSpy spy(&presenter, &FramePresenter::waveformReady);
+
+    SampleHistory data;
+    std::vector<size_t> deliveredSizes;
+    std::vector<SampleHistorySnapshot> delivered;
+    connect(&presenter, &FramePresenter::waveformReady, this, [&](const SampleHistorySnapshot& d) {
+        deliveredSizes.push_back(d->size());
+        delivered.push_back(d);
+    });
+
+    // 한 프레임 안에 1000번 제출
+    for(int i{0}; i < 1000; ++i) {
+        data.push_back(DataPoint{});
+        presenter.submitWaveform(data);
+    }
+
+    // 첫 제출은 즉시 전달, 나머지는 다음 프레임에 최신 것 하나만
+    QCOMPARE(spy.count(), 1);
+    QTRY_COMPARE_WITH_TIMEOUT(spy.count(), 2, 500);
+    QCOMPARE(deliveredSizes.back(), size_t(1000));
+
+    // 전달된 스냅샷은 이후 원본 변경과 무관
+    data.push_back(DataPoint{});
+    QCOMPARE(delivered.front()->size(), size_t(1));
+    QCOMPARE(delivered.back()->size(), size_t(1000));
+    QCOMPARE(presenter.droppedCount(FramePresenter::Channel::Waveform), quint64(998));
+
+    // 더 이상 대기 중인 스냅샷 없음
+    QTest::qWait(150);
+    QCOMPARE(spy.count(), 2);
+}
+
+void TestFramePresenter::testBackpressure()
+{
+    QObject receiverContext;
+    FramePresenter presenter;
+    presenter.setFrameRate(100.0); // 10ms
+    presenter.setReceiverContext(&receiverContext);
+    QSignalSpy spy(&presenter, &FramePresenter::measuredReady);
+
+    std::deque<MeasuredData> data(1);
+    presenter.submitMeasured(data);
+    QCOMPARE(spy.count(), 1);
+    QCOMPARE(spy.at(0).at(0).value<MeasuredDataSnapshot>()->size(), size_t(1));
+
+    // 수신 측 이벤트 루프가 돌기 전까지는 전달 완료가 확인되지 않으므로 프레임이 지나도 보내지 않음
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    presenter.submitMeasured(data);
+    QCOMPARE(spy.count(), 1);
+
+    // 이벤트 루프가 돌면 확인 후 다음 프레임에 전달
+    QTRY_COMPARE_WITH_TIMEOUT(spy.count(), 2, 500);
+}
+
+QTEST_MAIN(TestFramePresenter)
+#include "test_frame_presenter.moc"
@@ -15,6 +15,7 @@ private slots:
     void testCoarseSearchTransition();
     void testFllToPllTransition();
     void testPLLTracking();
+    void testStreamingSogiRamp();
 };
 
 MeasuredData TestFrequencyTracker::createData(double frequencyHz, double timeSec)
@@ -239,5 +240,51 @@ void TestFrequencyTracker::testPLLTracking()
     QVERIFY(newCycles > initialCycles);
 }
 
+void TestFrequencyTracker::testStreamingSogiRamp()
+{
+    SimulationEngine engine;
+    engine.m_samplingCycles.setValue(50.0); // 추적 시작 주파수
+    engine.m_samplesPerCycle.setValue(20);
+
+    FrequencyTracker tracker(&engine);
+    tracker.setTrackingMethod(FrequencyTracker::TrackingMethod::StreamingSogi);
+    QSignalSpy spy(&tracker, &FrequencyTracker::samplingCyclesUpdated);
+
+    tracker.startTracking();
+    QCOMPARE(tracker.currentState(), FrequencyTracker::TrackingState::Streaming);
+
+    // 55Hz에서 시작해 0.5초 후부터 +2Hz/s로 증가하는 신호 (샘플링 1kHz 고정)
+    const double sampleRate = 1000.0;
+    double phase = 0.0;
+    double frequency = 55.0;
+    for(int i = 0; i < 1500; ++i) {
+        const double t = i / sampleRate;
+        frequency = (t < 0.5) ? 55.0 : 55.0 + 2.0 * (t - 0.5);
+
+        DataPoint dp;
+        dp.timestamp = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::duration<double>(t));
+        dp.voltage.a = 100.0 * std::sin(phase);
+        phase += 2.0 * std::numbers::pi * frequency / sampleRate;
+
+        tracker.process(dp, {}, {});
+
+        // 수 사이클(0.1초) 안에 1% 이내로 수렴
+        if(i == 100) {
+            QVERIFY(std::abs(tracker.trackedFrequency() - 55.0) < 0.55);
+        }
+    }
+
+    // 램프 추종 및 ROCOF
+    QVERIFY(std::abs(tracker.trackedFrequency() - frequency) < 0.1);
+    QVERIFY(std::abs(tracker.rocof() - 2.0) < 0.3);
+
+    // 잠금 후 매 사이클 샘플링 주파수 갱신
+    QVERIFY(spy.count() > 10);
+    QVERIFY(std::abs(spy.last().at(0).toDouble() - frequency) < 0.1);
+
+    tracker.stopTracking();
+    QCOMPARE(tracker.trackedFrequency(), 0.0);
+}
+
 QTEST_MAIN(TestFrequencyTracker)
 #include "test_frequency_tracker.moc"
@@ -0,0 +1,93 @@
+#include <QtTest>
+#include "../harmonic_group_analyzer.h"
+
+class TestHarmonicGroupAnalyzer : public QObject
+{
+    Q_OBJECT
+
+private:
+    // 1사이클 샘플 생성. 차수(실수)별 RMS 성분을 합성 (전압 A상과 전류 A상에 동일 적용)
+    std::vector<DataPoint> createCycle(int cycleIndex, int samplesPerCycle, const std::vector<std::pair<double, double>>& components);
+
+private slots:
+    void testGroupsAndInterharmonics();
+    void testWindowTimingAndNyquistLimit();
+};
+
+std::vector<DataPoint> TestHarmonicGroupAnalyzer::createCycle(int cycleIndex, int samplesPerCycle, const std::vector<std::pair<double, double>>& components)
+{
+    std::vector<DataPoint> cycle(samplesPerCycle);
+    for(int n{0}; n < samplesPerCycle; ++n) {
+        // 기본파 1사이클 = 1.0 (단위 시간)
+        const double t = cycleIndex + static_cast<double>(n) / samplesPerCycle;
+        double value = 0.0;
+        for(const auto& [order, rms] : components) {
+            value += rms * std::sqrt(2.0) * std::sin(2.0 * std::numbers::pi * order * t);
+        }
+        cycle[n].timestamp = std::chrono::nanoseconds(static_cast<long long>(t * 1e9));
+        cycle[n].voltage.a = value;
+        cycle[n].current.a = value;
+    }
+    return cycle;
+}
+
+void TestHarmonicGroupAnalyzer::testGroupsAndInterharmonics()
+{
+    HarmonicGroupAnalyzer analyzer;
+    QSignalSpy spy(&analyzer, &HarmonicGroupAnalyzer::harmonicGroupsUpdated);
+
+    const int samplesPerCycle = 64;
+    const int C = 10;
+
+    // 기본파 100, 3차 10, 1.3차 간고조파 5 (10사이클 윈도우에서 정확히 13번 빈에 놓임)
+    const std::vector<std::pair<double, double>> components = {{1.0, 100.0}, {3.0, 10.0}, {1.3, 5.0}};
+
+    for(int c{0}; c < C; ++c) {
+        analyzer.processCycle(createCycle(c, samplesPerCycle, components), C);
+    }
+
+    QCOMPARE(spy.count(), 1);
+    const auto& result = analyzer.lastResult();
+    QCOMPARE(result.cyclesPerWindow, C);
+    QCOMPARE(result.maxOrder, (samplesPerCycle - 1) / 2);
+
+    const auto& va = result.channels[HarmonicGroupResult::VoltageA];
+    // kiss_fft는 float 연산이므로 허용 오차 1e-3
+    // 1.3차는 1차 그룹(±4빈)에는 포함되지만 서브그룹(±1빈)에는 포함되지 않음
+    QVERIFY(std::abs(va.groups[1] - std::sqrt(100.0 * 100.0 + 5.0 * 5.0)) < 1e-3);
+    QVERIFY(std::abs(va.subgroups[1] - 100.0) < 1e-3);
+    QVERIFY(std::abs(va.groups[3] - 10.0) < 1e-3);
+    QVERIFY(std::abs(va.groups[2]) < 1e-3);
+
+    // 1차와 2차 사이의 간고조파 중심 서브그룹
+    QVERIFY(std::abs(va.interharmonicCentredSubgroups[1] - 5.0) < 1e-3);
+    QVERIFY(std::abs(va.interharmonicCentredSubgroups[2]) < 1e-3);
+
+    // 신호가 없는 채널은 0
+    QVERIFY(std::abs(result.channels[HarmonicGroupResult::VoltageB].groups[1]) < 1e-9);
+    QVERIFY(std::abs(result.channels[HarmonicGroupResult::CurrentA].groups[3] - 10.0) < 1e-3);
+}
+
+void TestHarmonicGroupAnalyzer::testWindowTimingAndNyquistLimit()
+{
+    HarmonicGroupAnalyzer analyzer;
+    QSignalSpy spy(&analyzer, &HarmonicGroupAnalyzer::harmonicGroupsUpdated);
+
+    // 12사이클 윈도우: 11사이클까지는 결과 없음
+    const std::vector<std::pair<double, double>> components = {{1.0, 50.0}};
+    for(int c{0}; c < 11; ++c) {
+        analyzer.processCycle(createCycle(c, 256, components), 12);
+    }
+    QCOMPARE(spy.count(), 0);
+
+    analyzer.processCycle(createCycle(11, 256, components), 12);
+    QCOMPARE(spy.count(), 1);
+
+    // 256 샘플/사이클이면 Nyquist 한계(127차)보다 50차 제한이 우선
+    QCOMPARE(analyzer.lastResult().maxOrder, HarmonicGroupAnalyzer::MaxHarmonicOrder);
+    QCOMPARE(analyzer.lastResult().channels[0].groups.size(), size_t(HarmonicGroupAnalyzer::MaxHarmonicOrder + 1));
+    QVERIFY(std::abs(analyzer.lastResult().channels[0].groups[1] - 50.0) < 1e-3);
+}
+
+QTEST_MAIN(TestHarmonicGroupAnalyzer)
+#include "test_harmonic_group_analyzer.moc"
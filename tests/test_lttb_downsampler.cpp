@@ -0,0 +1,93 @@
+#include <QtTest>
+#include <deque>
+#include "../lttb_downsampler.h"
+#include "../data_point.h"
+
+class TestLttbDownsampler : public QObject
+{
+    Q_OBJECT
+
+private:
+    std::deque<DataPoint> makeData(int count);
+
+private slots:
+    void testEndpointsAndOrder();
+    void testSeriesMask();
+    void testParallelRange();
+};
+
+std::deque<DataPoint> TestLttbDownsampler::makeData(int count)
+{
+    std::deque<DataPoint> data;
+    for(int i{0}; i < count; ++i) {
+        DataPoint p{};
+        p.timestamp = std::chrono::nanoseconds(i * 1000LL);
+        p.voltage.a = std::sin(i * 0.01) * 100.0 + (i % 13);
+        p.current.a = std::cos(i * 0.002) * 10.0;
+        data.push_back(p);
+    }
+    return data;
+}
+
+void TestLttbDownsampler::testEndpointsAndOrder()
+{
+    const auto data = makeData(10000);
+    const auto sampled = LttbDownsampler::downsample(data.begin(), data.end(), 500, LttbDownsampler::AllSeries,
+                                                     [](const DataPoint& p) { return p.voltage.a; },
+                                                     [](const DataPoint& p) { return p.current.a; });
+
+    QCOMPARE(sampled.size(), size_t(500));
+    QCOMPARE(sampled.front().timestamp, data.front().timestamp);
+    QCOMPARE(sampled.back().timestamp, data.back().timestamp);
+    for(size_t i = 1; i < sampled.size(); ++i) {
+        QVERIFY(sampled[i - 1].timestamp < sampled[i].timestamp);
+    }
+
+    // threshold 이하면 그대로 반환
+    const auto small = makeData(100);
+    QCOMPARE(LttbDownsampler::downsample(small.begin(), small.end(), 500, LttbDownsampler::AllSeries,
+                                         [](const DataPoint& p) { return p.voltage.a; }).size(), size_t(100));
+}
+
+void TestLttbDownsampler::testSeriesMask()
+{
+    auto data = makeData(10000);
+    const auto voltage = [](const DataPoint& p) { return p.voltage.a; };
+    const auto current = [](const DataPoint& p) { return p.current.a; };
+
+    const auto voltageOnly = LttbDownsampler::downsample(data.begin(), data.end(), 300, 0b01, voltage);
+
+    // 꺼진 계열(전류)의 스파이크는 선택에 영향을 주지 않아야 함
+    data[5000].current.a = 1e6;
+    const auto masked = LttbDownsampler::downsample(data.begin(), data.end(), 300, 0b01, voltage, current);
+    QCOMPARE(masked.size(), voltageOnly.size());
+    for(size_t i = 0; i < masked.size(); ++i) {
+        QCOMPARE(masked[i].timestamp, voltageOnly[i].timestamp);
+    }
+
+    // 켜진 계열의 스파이크는 반드시 선택됨
+    const auto both = LttbDownsampler::downsample(data.begin(), data.end(), 300, LttbDownsampler::AllSeries, voltage, current);
+    QVERIFY(std::any_of(both.begin(), both.end(), [&](const DataPoint& p) {
+        return p.timestamp == data[5000].timestamp;
+    }));
+}
+
+void TestLttbDownsampler::testParallelRange()
+{
+    // 병렬 임계값을 넘는 입력에서도 개수/순서/끝점 보존
+    const int count = static_cast<int>(config::Downsampling::ParallelThreshold) * 4;
+    const auto data = makeData(count);
+    const auto sampled = LttbDownsampler::downsample(data.begin(), data.end(), 2000, LttbDownsampler::AllSeries,
+                                                     [](const DataPoint& p) { return p.voltage.a; },
+                                                     [](const DataPoint& p) { return p.current.a; });
+
+    QCOMPARE(sampled.size(), size_t(2000));
+    QCOMPARE(sampled.front().timestamp, data.front().timestamp);
+    QCOMPARE(sampled.back().timestamp, data.back().timestamp);
+    for(size_t i = 1; i < sampled.size(); ++i) {
+        QVERIFY(sampled[i - 1].timestamp < sampled[i].timestamp);
+    }
+}
+
+QTEST_MAIN(TestLttbDownsampler)
+#include "test_lttb_downsampler.moc"
@@ -0,0 +1,223 @@
+#include <QtTest>
+#include <QTemporaryDir>
+#include <tuple>
+#include "../measurement_recorder.h"
+#include "../config.h"
+
+using namespace std::chrono_literals;
+
+class TestMeasurementRecorder : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    void testRoundTripAndRangeQuery();
+    void testBatchLargerThanTransaction();
+    void testSessionsKeepTheirRows();
+    void testAggregatesByTier();
+};
+
+void TestMeasurementRecorder::testRoundTripAndRangeQuery()
+{
+    QTemporaryDir dir;
+    QVERIFY(dir.isValid());
+    MeasurementRecorder recorder(dir.filePath("test.db").toStdString());
+
+    // 1. 1초 요약 5개 (t = 1..5s)
+    for(int sec{1}; sec <= 5; ++sec) {
+        OneSecondSummaryData data{};
+        data.timestamp = std::chrono::seconds(sec);
+        data.totalVoltageRms = {220.0 + sec, 221.0, 222.0};
+        data.frequency = 60.0;
+        data.totalActivePower = 1000.0 * sec;
+        recorder.recordSummary(std::make_shared<const OneSecondSummaryData>(data));
+    }
+
+    // 2. 수요 (블록 수요는 아직 없음 -> NaN 유지)
+    DemandData demand;
+    demand.timestamp = 3s;
+    demand.totalActivePowerDemand.sliding = 1500.0;
+    demand.currentDemand.b.thermal = 42.0;
+    demand.currentDemand.c.peakSliding.update(50.0, 2s);
+    demand.totalPowerFactorDemand.block = 0.9;
+    recorder.recordDemand(demand);
+
+    // 3. 이벤트
+    recorder.recordEvent({2s, 100ms, "dip", 0, 150.0});
+
+    recorder.flush();
+
+    // 범위 조회 [2s, 4s]
+    auto summaries = recorder.querySummaries(2s, 4s);
+    QVERIFY(summaries.has_value());
+    QCOMPARE(summaries->size(), size_t(3));
+    QCOMPARE(summaries->front().timestamp, std::chrono::nanoseconds(2s));
+    QCOMPARE(summaries->front().voltageRms.a, 222.0);
+    QCOMPARE(summaries->back().totalActivePower, 4000.0);
+    QCOMPARE(summaries->back().frequency, 60.0);
+
+    auto demands = recorder.queryDemand(0s, 10s);
+    QVERIFY(demands.has_value());
+    QCOMPARE(demands->size(), size_t(1));
+    QCOMPARE(demands->front().activePower.sliding, 1500.0);
+    QVERIFY(std::isnan(demands->front().activePower.block));
+    QCOMPARE(demands->front().current.b.thermal, 42.0);
+    QCOMPARE(demands->front().current.c.peakSliding.value, 50.0);
+    QCOMPARE(demands->front().current.c.peakSliding.timestamp, std::chrono::nanoseconds(2s));
+    QVERIFY(!demands->front().current.a.peakSliding.hasTimestamp());
+    QCOMPARE(demands->front().powerFactor.block, 0.9);
+
+    auto events = recorder.queryEvents(0s, 10s);
+    QVERIFY(events.has_value());
+    QCOMPARE(events->size(), size_t(1));
+    QCOMPARE(events->front().type, std::string("dip"));
+    QCOMPARE(events->front().duration, std::chrono::nanoseconds(100ms));
+
+    // 범위 밖
+    QCOMPARE(recorder.queryEvents(3s, 10s)->size(), size_t(0));
+    QCOMPARE(recorder.droppedCount(), size_t(0));
+}
+
+void TestMeasurementRecorder::testBatchLargerThanTransaction()
+{
+    QTemporaryDir dir;
+    QVERIFY(dir.isValid());
+    const std::string path = dir.filePath("test.db").toStdString();
+
+    // 트랜잭션 크기의 여러 배를 한 번에 기록
+    const int count = static_cast<int>(config::Recorder::BatchSize) * 3 + 7;
+    MeasurementRecorder::SessionId session = 0;
+    {
+        MeasurementRecorder recorder(path);
+        session = recorder.sessionId();
+        for(int sec{0}; sec < count; ++sec) {
+            OneSecondSummaryData data{};
+            data.timestamp = std::chrono::seconds(sec);
+            recorder.recordSummary(std::make_shared<const OneSecondSummaryData>(data));
+        }
+        // 소멸 시 남은 행을 모두 기록
+    }
+
+    // 다시 열어서 조회 (새 기록기는 새 세션이므로 이전 세션을 지정)
+    MeasurementRecorder reopened(path);
+    QVERIFY(reopened.sessionId() != session);
+    auto summaries = reopened.querySummaries(session, 0s, std::chrono::seconds(count));
+    QVERIFY(summaries.has_value());
+    QCOMPARE(summaries->size(), size_t(count));
+    QCOMPARE(reopened.querySummaries(0s, std::chrono::seconds(count))->size(), size_t(0));
+}
+
+void TestMeasurementRecorder::testSessionsKeepTheirRows()
+{
+    QTemporaryDir dir;
+    QVERIFY(dir.isValid());
+    const std::string path = dir.filePath("test.db").toStdString();
+
+    // 시뮬레이션 시간은 실행마다 0부터 시작 -> 두 세션이 같은 시각의 행을 기록
+    const auto record = [](MeasurementRecorder& recorder, double voltage, double peak) {
+        OneSecondSummaryData data{};
+        data.timestamp = 1s;
+        data.totalVoltageRms = {voltage, voltage, voltage};
+        recorder.recordSummary(std::make_shared<const OneSecondSummaryData>(data));
+
+        DemandData demand;
+        demand.timestamp = 1s;
+        demand.totalActivePowerDemand.peakBlock.update(peak, 1s);
+        demand.totalActivePowerDemand.peakSliding.update(peak + 1.0, 1s);
+        demand.totalActivePowerDemand.peakThermal.update(peak + 2.0, 1s);
+        recorder.recordDemand(demand);
+        recorder.recordEvent({1s, 20ms, "dip", 0, voltage});
+        recorder.flush();
+    };
+
+    MeasurementRecorder::SessionId first = 0;
+    {
+        MeasurementRecorder recorder(path);
+        first = recorder.sessionId();
+        record(recorder, 220.0, 1000.0);
+    }
+    MeasurementRecorder recorder(path);
+    const MeasurementRecorder::SessionId second = recorder.sessionId();
+    record(recorder, 230.0, 2000.0);
+
+    auto sessions = recorder.querySessions();
+    QVERIFY(sessions.has_value());
+    QCOMPARE(sessions->size(), size_t(2));
+    QCOMPARE(sessions->front().id, first);
+    QCOMPARE(sessions->back().id, second);
+    QVERIFY(sessions->front().startedAt <= sessions->back().startedAt);
+
+    // 같은 시각이어도 세션별로 보존
+    for(const auto& [session, voltage, peak] : {std::tuple{first, 220.0, 1000.0}, std::tuple{second, 230.0, 2000.0}}) {
+        auto summaries = recorder.querySummaries(session, 0s, 10s);
+        QVERIFY(summaries.has_value());
+        QCOMPARE(summaries->size(), size_t(1));
+        QCOMPARE(summaries->front().voltageRms.a, voltage);
+
+        auto demands = recorder.queryDemand(session, 0s, 10s);
+        QVERIFY(demands.has_value());
+        QCOMPARE(demands->size(), size_t(1));
+        const DemandValues& active = demands->front().activePower;
+        QCOMPARE(active.peakBlock.value, peak);
+        QCOMPARE(active.peakSliding.value, peak + 1.0);
+        QCOMPARE(active.peakThermal.value, peak + 2.0);
+        QCOMPARE(active.peakThermal.timestamp, std::chrono::nanoseconds(1s));
+        QVERIFY(!demands->front().reactivePower.peakSliding.hasTimestamp());
+
+        auto events = recorder.queryEvents(session, 0s, 10s);
+        QVERIFY(events.has_value());
+        QCOMPARE(events->size(), size_t(1));
+        QCOMPARE(events->front().extremeValue, voltage);
+    }
+
+    // 세션을 생략하면 현재 세션
+    QCOMPARE(recorder.querySummaries(0s, 10s)->front().voltageRms.a, 230.0);
+}
+
+void TestMeasurementRecorder::testAggregatesByTier()
+{
+    QTemporaryDir dir;
+    QVERIFY(dir.isValid());
+    MeasurementRecorder recorder(dir.filePath("test.db").toStdString());
+
+    const auto aggregate = [](AggregationTier tier, std::chrono::nanoseconds start, std::chrono::nanoseconds end, int cycles) {
+        AggregatedData data;
+        data.tier = tier;
+        data.startTime = start;
+        data.endTime = end;
+        data.cycleCount = cycles;
+        data.voltageRms = {220.0, 221.0, 222.0};
+        data.voltageRms_ll = {381.0, 382.0, 383.0};
+        data.frequency = 60.0;
+        return data;
+    };
+
+    // 기본 구간은 기록하지 않음
+    recorder.recordAggregate(aggregate(AggregationTier::BaseWindow, 0ms, 200ms, 12));
+    recorder.recordAggregate(aggregate(AggregationTier::ShortInterval, 0s, 3s, 180));
+    recorder.recordAggregate(aggregate(AggregationTier::ShortInterval, 3s, 6s, 180));
+    AggregatedData tenMinutes = aggregate(AggregationTier::TenMinutes, 0s, 600s, 36000);
+    tenMinutes.flagged = true;
+    recorder.recordAggregate(tenMinutes);
+    recorder.flush();
+
+    QCOMPARE(recorder.queryAggregates(AggregationTier::BaseWindow, 0s, 600s)->size(), size_t(0));
+
+    auto shortIntervals = recorder.queryAggregates(AggregationTier::ShortInterval, 0s, 600s);
+    QVERIFY(shortIntervals.has_value());
+    QCOMPARE(shortIntervals->size(), size_t(2));
+    QCOMPARE(shortIntervals->back().startTime, std::chrono::nanoseconds(3s));
+    QCOMPARE(shortIntervals->back().cycleCount, 180);
+    QCOMPARE(shortIntervals->back().voltageRms_ll.ca, 383.0);
+    QVERIFY(!shortIntervals->back().flagged);
+
+    auto tenMinuteIntervals = recorder.queryAggregates(AggregationTier::TenMinutes, 0s, 600s);
+    QVERIFY(tenMinuteIntervals.has_value());
+    QCOMPARE(tenMinuteIntervals->size(), size_t(1));
+    QCOMPARE(tenMinuteIntervals->front().tier, AggregationTier::TenMinutes);
+    QCOMPARE(tenMinuteIntervals->front().endTime, std::chrono::nanoseconds(600s));
+    QVERIFY(tenMinuteIntervals->front().flagged);
+}
+
+QTEST_MAIN(TestMeasurementRecorder)
+#include "test_measurement_recorder.moc"
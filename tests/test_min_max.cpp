@@ -2,6 +2,9 @@
 #include <QObject>
 #include <QDebug>
 #include "min_max_tracker.h"
+#include "min_max_archive.h"
+
+using namespace std::chrono_literals;
 
 class TestMinMaxTracker : public QObject
 {
@@ -9,13 +12,13 @@ class TestMinMaxTracker : public QObject
 private slots: // private slot은 자동으로 테스트 케이스가 됨
     void test_min_tracker();
     void test_max_tracker();
+    void test_archive_rollover();
 };
 
 void TestMinMaxTracker::test_min_tracker() {
     MinTracker<double> tracker;
-    QDateTime t1 = QDateTime::currentDateTime();
-
-    qDebug() << "MinTracker t1 : " << t1.toString("yyyy-MM-dd HH:mm:ss");
+    TrackerTimestamp t1 = 1s;
+    QVERIFY(!tracker.hasTimestamp());
 
     // Initial state should be max double
     QCOMPARE(tracker.value , std::numeric_limits<double>::max());
@@ -25,8 +28,7 @@ void TestMinMaxTracker::test_min_tracker() {
     QCOMPARE(tracker.value, 10.0);
     QCOMPARE(tracker.timestamp, t1);
     
-    QDateTime t2 = t1.addMSecs(100); // 100ms 뒤 시간
-    qDebug() << "MinTracker t2 : " << t2.toString("yyyy-MM-dd HH:mm:ss");
+    TrackerTimestamp t2 = t1 + 100ms; // 100ms 뒤 시간
     // Update with a larger value (should not change)
     tracker.update(20.0, t2);
     QCOMPARE(tracker.value, 10.0);
@@ -42,8 +44,8 @@ void TestMinMaxTracker::test_min_tracker() {
 
 void TestMinMaxTracker::test_max_tracker() {
     MaxTracker<double> tracker;
-    QDateTime t1 = QDateTime::currentDateTime();
-    qDebug() << "MaxTracker t1 : " << t1.toString("yyyy-MM-dd HH:mm:ss");
+    TrackerTimestamp t1 = 1s;
+    QVERIFY(!tracker.hasTimestamp());
     
     // Initial state should be lowest double
     QCOMPARE(tracker.value , std::numeric_limits<double>::lowest());
@@ -53,8 +55,7 @@ void TestMinMaxTracker::test_max_tracker() {
     QCOMPARE(tracker.value, 10.0);
     QCOMPARE(tracker.timestamp, t1);
     
-    QDateTime t2 = t1.addMSecs(100); // 100ms 뒤 시간
-    qDebug() << "MaxTracker t2 : " << t2.toString("yyyy-MM-dd HH:mm:ss");
+    TrackerTimestamp t2 = t1 + 100ms; // 100ms 뒤 시간
     // Update with a smaller value (should not change)
     tracker.update(5.0, t1);
     QCOMPARE(tracker.value, 10.0);
@@ -68,6 +69,48 @@ void TestMinMaxTracker::test_max_tracker() {
     qDebug() << "MaxTracker test passed";
 }
 
+void TestMinMaxTracker::test_archive_rollover() {
+    // 1시간 구간, 슬롯 3개
+    MinMaxArchive archive(1h, 3);
+    QCOMPARE(archive.lastIntervals(5).size(), size_t(0));
+
+    // 0시: 10, 20 / 1시: 5 / 3시(2시 공백): 30, 40
+    archive.update(10.0, 10min);
+    archive.update(20.0, 50min);
+    archive.update(std::numeric_limits<double>::quiet_NaN(), 55min); // 무시
+    archive.update(5.0, 1h + 1s);
+    archive.update(30.0, 3h);
+    archive.update(40.0, 3h + 30min);
+
+    auto intervals = archive.lastIntervals(5);
+    QCOMPARE(intervals.size(), size_t(2));
+    QCOMPARE(intervals[0].startTime, std::chrono::nanoseconds(0h));
+    QCOMPARE(intervals[0].min, 10.0);
+    QCOMPARE(intervals[0].max, 20.0);
+    QCOMPARE(intervals[0].average(), 15.0);
+    QCOMPARE(intervals[0].count, size_t(2));
+    QCOMPARE(intervals[1].startTime, std::chrono::nanoseconds(1h));
+    QCOMPARE(intervals[1].average(), 5.0);
+
+    // 진행 중 구간
+    QCOMPARE(archive.currentBucket().startTime, std::chrono::nanoseconds(3h));
+    QCOMPARE(archive.currentBucket().average(), 35.0);
+
+    // 링이 가득 차면 가장 오래된 구간을 덮어씀
+    archive.update(1.0, 4h);
+    archive.update(2.0, 5h);
+    intervals = archive.lastIntervals(3);
+    QCOMPARE(intervals.size(), size_t(3));
+    QCOMPARE(intervals[0].startTime, std::chrono::nanoseconds(1h));
+    QCOMPARE(intervals[1].startTime, std::chrono::nanoseconds(3h));
+    QCOMPARE(intervals[2].startTime, std::chrono::nanoseconds(4h));
+
+    // 최근 N개만 요청
+    intervals = archive.lastIntervals(1);
+    QCOMPARE(intervals.size(), size_t(1));
+    QCOMPARE(intervals[0].max, 1.0);
+}
+
 // main 함수 자동 생성 매크로
 QTEST_MAIN(TestMinMaxTracker)
 #include "test_min_max.moc"
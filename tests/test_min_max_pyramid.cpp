@@ -0,0 +1,155 @@
+#include <QtTest>
+#include <deque>
+#include <utility>
+#include "../min_max_pyramid.h"
+
+class TestMinMaxPyramid : public QObject
+{
+    Q_OBJECT
+
+private:
+    DataPoint makePoint(int index);
+
+private slots:
+    void testEnvelopeMatchesRawData();
+    void testZoomedInUsesRawSamples();
+    void testTrimFront();
+    void testMemoryBound();
+};
+
+DataPoint TestMinMaxPyramid::makePoint(int index)
+{
+    // 재현 가능한 톱니파 + 사인파 조합
+    DataPoint p{};
+    p.timestamp = std::chrono::nanoseconds(index);
+    p.voltage.a = std::sin(index * 0.01) * 100.0 + (index % 17);
+    p.current.c = std::cos(index * 0.003) * 10.0 - (index % 5);
+    return p;
+}
+
+void TestMinMaxPyramid::testEnvelopeMatchesRawData()
+{
+    MinMaxPyramid pyramid;
+    std::vector<DataPoint> raw;
+    for(int i{0}; i < 10000; ++i) {
+        raw.push_back(makePoint(i));
+        pyramid.append(raw.back());
+    }
+
+    const auto rawMinMax = [&](uint64_t first, uint64_t last) {
+        double minVa = std::numeric_limits<double>::max();
+        double maxIc = std::numeric_limits<double>::lowest();
+        for(uint64_t i = first; i <= last; ++i) {
+            minVa = std::min(minVa, raw[i].voltage.a);
+            maxIc = std::max(maxIc, raw[i].current.c);
+        }
+        return std::pair{minVa, maxIc};
+    };
+
+    std::vector<MinMaxPyramid::EnvelopeBucket> envelope;
+    const uint64_t first = 123, last = 9876;
+    pyramid.envelope(first, last, 200, envelope);
+
+    QVERIFY(!envelope.empty());
+    QVERIFY(envelope.size() <= 200);
+    QCOMPARE(envelope.front().firstIndex, first);
+    QCOMPARE(envelope.back().lastIndex, last - 1);
+
+    // 내부 버킷은 원본 구간과 정확히 일치
+    for(size_t b = 1; b + 1 < envelope.size(); ++b) {
+        const auto& bucket = envelope[b];
+        const auto [minVa, maxIc] = rawMinMax(bucket.firstIndex, bucket.lastIndex);
+        QCOMPARE(bucket.min[0], minVa);
+        QCOMPARE(bucket.max[5], maxIc);
+    }
+
+    // 전체 엔벨로프는 구간의 min/max를 포함 (Y축 범위)
+    double rawMin = std::numeric_limits<double>::max();
+    for(uint64_t i = first; i < last; ++i) rawMin = std::min(rawMin, raw[i].voltage.a);
+    double envMin = std::numeric_limits<double>::max();
+    for(const auto& bucket : envelope) envMin = std::min(envMin, bucket.min[0]);
+    QVERIFY(envMin <= rawMin);
+
+    // 최신 구간: 상위 레벨에 아직 병합되지 않은 MinLevel 버킷(10000 % 32 = 16샘플)도 포함
+    pyramid.envelope(0, 10000, 20, envelope);
+    QVERIFY(!envelope.empty());
+    QCOMPARE(envelope.back().lastIndex, uint64_t(9999));
+    for(const auto& bucket : envelope) {
+        const auto [minVa, maxIc] = rawMinMax(bucket.firstIndex, bucket.lastIndex);
+        QCOMPARE(bucket.min[0], minVa);
+        QCOMPARE(bucket.max[5], maxIc);
+    }
+}
+
+void TestMinMaxPyramid::testZoomedInUsesRawSamples()
+{
+    MinMaxPyramid pyramid;
+    std::vector<DataPoint> raw;
+    for(int i{0}; i < 5000; ++i) {
+        raw.push_back(makePoint(i));
+        pyramid.append(raw.back());
+    }
+    const auto sampleAt = [&](uint64_t index) { return raw[index]; };
+
+    // 300샘플을 100버킷으로: 버킷당 4샘플 (MinLevel보다 세밀)
+    std::vector<MinMaxPyramid::EnvelopeBucket> envelope;
+    pyramid.envelope(1000, 1300, 100, envelope, sampleAt);
+    QVERIFY(envelope.size() > 50);
+    QVERIFY(envelope.size() <= 100);
+    QCOMPARE(envelope.front().firstIndex, uint64_t(1000));
+    QCOMPARE(envelope.back().lastIndex, uint64_t(1299));
+    for(const auto& bucket : envelope) {
+        double minVa = std::numeric_limits<double>::max();
+        for(uint64_t i = bucket.firstIndex; i <= bucket.lastIndex; ++i) minVa = std::min(minVa, raw[i].voltage.a);
+        QCOMPARE(bucket.min[0], minVa);
+    }
+
+    // 원본 없이 조회하면 MinLevel 버킷까지만 나눔
+    pyramid.envelope(1000, 1300, 100, envelope);
+    QVERIFY(envelope.size() <= (300 >> MinMaxPyramid::MinLevel) + 2);
+
+    // 축소된 구간은 원본을 읽지 않고 피라미드만 사용
+    int rawReads = 0;
+    pyramid.envelope(0, 5000, 50, envelope, [&](uint64_t index) { ++rawReads; return raw[index]; });
+    QCOMPARE(rawReads, 0);
+    QVERIFY(envelope.size() <= 50);
+}
+
+void TestMinMaxPyramid::testTrimFront()
+{
+    MinMaxPyramid pyramid;
+    for(int i{0}; i < 1000; ++i) {
+        pyramid.append(makePoint(i));
+    }
+
+    pyramid.trimFront(600);
+    QCOMPARE(pyramid.beginIndex(), uint64_t(600));
+    QCOMPARE(pyramid.endIndex(), uint64_t(1000));
+
+    // 제거된 구간은 조회 결과에서 잘림
+    std::vector<MinMaxPyramid::EnvelopeBucket> envelope;
+    pyramid.envelope(0, 1000, 10, envelope);
+    QVERIFY(!envelope.empty());
+    QCOMPARE(envelope.front().firstIndex, uint64_t(600));
+    QCOMPARE(envelope.back().lastIndex, uint64_t(999));
+
+    pyramid.clear();
+    pyramid.envelope(0, 1000, 10, envelope);
+    QVERIFY(envelope.empty());
+}
+
+void TestMinMaxPyramid::testMemoryBound()
+{
+    // 모든 레벨의 버킷 합은 MinLevel 버킷 수의 약 2배 (샘플당 2 * 96 / 32 = 6바이트)
+    MinMaxPyramid pyramid;
+    constexpr int Count = 200'000;
+    for(int i{0}; i < Count; ++i) {
+        pyramid.append(makePoint(i));
+    }
+    const size_t finestBuckets = (Count >> MinMaxPyramid::MinLevel) + 1;
+    QVERIFY(pyramid.bucketCount() <= 2 * finestBuckets + MinMaxPyramid::MaxLevel);
+    QVERIFY(sizeof(MinMaxPyramid::Bucket) * pyramid.bucketCount() / Count <= 8);
+}
+
+QTEST_MAIN(TestMinMaxPyramid)
+#include "test_min_max_pyramid.moc"
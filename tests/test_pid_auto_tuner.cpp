@@ -0,0 +1,74 @@
+#include <QtTest>
+#include <array>
+#include <mutex>
+#include "../pid_auto_tuner.h"
+#include "../simulation_engine.h"
+
+class TestPidAutoTuner : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    void testGrid();
+    void testRankedRun();
+};
+
+void TestPidAutoTuner::testGrid()
+{
+    PidAutoTuner::Candidate base;
+    base.fll = { .Kp = 1.0, .Ki = 2.0, .Kd = 3.0 };
+    base.zc = { .Kp = 4.0, .Ki = 5.0, .Kd = 6.0 };
+
+    constexpr std::array<double, 3> factors = {0.5, 1.0, 2.0};
+    const auto grid = PidAutoTuner::makeGrid(base, factors);
+    QCOMPARE(grid.size(), size_t(729));
+
+    // 첫 후보는 모든 계수에 첫 배율, 마지막 후보는 마지막 배율
+    QCOMPARE(grid.front().fll.Kp, 0.5);
+    QCOMPARE(grid.front().zc.Kd, 3.0);
+    QCOMPARE(grid.back().fll.Ki, 4.0);
+    QCOMPARE(grid.back().zc.Kp, 8.0);
+}
+
+void TestPidAutoTuner::testRankedRun()
+{
+    using namespace std::chrono_literals;
+    SimulationEngine engine;
+    auto* tracker = engine.getFrequencyTracker();
+
+    PidAutoTuner::Candidate current{ tracker->getFllCoefficients(), tracker->getZcCoefficients() };
+    // 모든 계수가 0이면 거친 탐색 추정치에서 움직이지 않으므로 계단 변화 후 잠기지 못함
+    const PidAutoTuner::Candidate frozen{ .fll = { .Kp = 0.0, .Ki = 0.0, .Kd = 0.0 }, .zc = { .Kp = 0.0, .Ki = 0.0, .Kd = 0.0 } };
+
+    const std::vector<PidAutoTuner::Scenario> scenarios = {
+        { .name = "step", .duration = 4000ms, .startFrequency = 60.0, .endFrequency = 60.5, .changeStart = 2000ms },
+    };
+
+    size_t lastDone = 0;
+    std::mutex progressMutex;
+    // 나쁜 후보를 먼저 넣어 안정 정렬 순서만으로는 통과하지 못하게 함
+    const auto results = PidAutoTuner::run({frozen, current}, scenarios, [&](size_t done, size_t total) {
+        std::lock_guard lock(progressMutex);
+        QCOMPARE(total, size_t(2));
+        lastDone = std::max(lastDone, done);
+    });
+
+    QCOMPARE(results.size(), size_t(2));
+    QCOMPARE(lastDone, size_t(2));
+    QCOMPARE(results[0].candidate.fll.Kp, current.fll.Kp);
+    QCOMPARE(results[0].candidate.zc.Kd, current.zc.Kd);
+    QCOMPARE(results[0].unlockedScenarios, 0);
+    QCOMPARE(results[1].candidate.fll.Kp, 0.0);
+    QVERIFY(results[0].score < results[1].score);
+    for(const auto& result : results) {
+        QVERIFY(result.meanLockTimeSec >= 0.0);
+        QVERIFY(result.restarts >= 0);
+    }
+
+    // 취소 시 끝난 후보만 반환
+    std::atomic<bool> cancel{true};
+    QVERIFY(PidAutoTuner::run({current}, scenarios, {}, &cancel).empty());
+}
+
+QTEST_MAIN(TestPidAutoTuner)
+#include "test_pid_auto_tuner.moc"
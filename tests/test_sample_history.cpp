@@ -0,0 +1,263 @@
+#include <QtTest>
+#include <algorithm>
+#include <cmath>
+#include "../sample_history.h"
+#include "../config.h"
+
+class TestSampleHistory : public QObject
+{
+    Q_OBJECT
+
+private:
+    DataPoint makePoint(int index);
+
+private slots:
+    void testDoubleIsLossless();
+    void testQuantizedWithinHalfLsb();
+    void testStorageChangeKeepsSamples();
+    void testClipping();
+    void testIntervalChangeStartsSegment();
+    void testAlternatingIntervalKeepsBlockBound();
+    void testTimeSearchMatchesBinarySearch();
+    void testCopyIsIndependentSnapshot();
+};
+
+DataPoint TestSampleHistory::makePoint(int index)
+{
+    DataPoint p{};
+    p.timestamp = std::chrono::nanoseconds(index * 1000);
+    p.voltage.a = 311.0 * std::sin(index * 0.05);
+    p.voltage.b = 311.0 * std::sin(index * 0.05 - 2.094);
+    p.voltage.c = 311.0 * std::sin(index * 0.05 + 2.094);
+    p.current.a = 10.0 * std::sin(index * 0.05 - 0.3);
+    p.current.b = -0.001 * index;
+    p.current.c = 0.0;
+    p.voltage_ll.ab = p.voltage.a - p.voltage.b;
+    p.voltage_ll.bc = p.voltage.b - p.voltage.c;
+    p.voltage_ll.ca = p.voltage.c - p.voltage.a;
+    return p;
+}
+
+void TestSampleHistory::testDoubleIsLossless()
+{
+    SampleHistory history;
+    // DataPoint(타임스탬프 + 채널 9개) 대비 40% 이상 절약
+    QVERIFY(history.bytesPerSample() <= sizeof(DataPoint) * 6 / 10);
+    for(int i{0}; i < 100; ++i) {
+        history.push_back(makePoint(i));
+    }
+    history.pop_front();
+
+    QCOMPARE(history.size(), size_t(99));
+    QCOMPARE(history.front().timestamp, makePoint(1).timestamp);
+    QCOMPARE(history.back().voltage.b, makePoint(99).voltage.b);
+    QCOMPARE(history[10].voltage_ll.ca, makePoint(11).voltage_ll.ca);
+
+    // 반복자로 timestamp 이진 탐색 (그래프 구간 검색과 같은 방식)
+    const auto it = std::lower_bound(history.begin(), history.end(), std::chrono::nanoseconds(50'000),
+                                     [](const DataPoint& p, std::chrono::nanoseconds t) { return p.timestamp < t; });
+    QCOMPARE(it - history.begin(), std::ptrdiff_t(49));
+    QCOMPARE(it->timestamp, std::chrono::nanoseconds(50'000));
+}
+
+void TestSampleHistory::testQuantizedWithinHalfLsb()
+{
+    for(auto storage : {SampleHistory::Storage::Int32, SampleHistory::Storage::Int16}) {
+        SampleHistory history;
+        history.setStorage(storage);
+        QVERIFY(history.bytesPerSample() < sizeof(DataPoint) / 2);
+
+        for(int i{0}; i < 500; ++i) {
+            history.push_back(makePoint(i));
+        }
+
+        const double lsbV = history.lsb(SampleHistory::VoltageA);
+        const double lsbI = history.lsb(SampleHistory::CurrentA);
+        QVERIFY(lsbV > 0.0 && lsbI > 0.0);
+
+        for(int i{0}; i < 500; ++i) {
+            const DataPoint expected = makePoint(i);
+            const DataPoint actual = history[i];
+            QCOMPARE(actual.timestamp, expected.timestamp);
+            QVERIFY(std::abs(actual.voltage.c - expected.voltage.c) <= 0.5 * lsbV + 1e-12);
+            QVERIFY(std::abs(actual.current.a - expected.current.a) <= 0.5 * lsbI + 1e-12);
+            QVERIFY(std::abs(actual.current.b - expected.current.b) <= 0.5 * lsbI + 1e-12);
+            // 선간 전압은 복원된 상전압의 차이 -> 오차는 최대 1 LSB
+            QVERIFY(std::abs(actual.voltage_ll.bc - expected.voltage_ll.bc) <= lsbV + 1e-12);
+        }
+        QCOMPARE(history.clippedCount(), size_t(0));
+    }
+}
+
+void TestSampleHistory::testStorageChangeKeepsSamples()
+{
+    SampleHistory history;
+    for(int i{0}; i < 50; ++i) {
+        history.push_back(makePoint(i));
+    }
+
+    history.setStorage(SampleHistory::Storage::Int16);
+    QCOMPARE(history.size(), size_t(50));
+    const double lsb = history.lsb(SampleHistory::VoltageA);
+    QVERIFY(std::abs(history[20].voltage.a - makePoint(20).voltage.a) <= 0.5 * lsb + 1e-12);
+
+    // 새 샘플도 같은 형식으로 이어짐
+    history.push_back(makePoint(50));
+    history.pop_front();
+    QCOMPARE(history.front().timestamp, makePoint(1).timestamp);
+
+    // 다시 double로 바꿔도 값은 int16 정밀도 그대로 (이미 잃은 정보는 복원되지 않음)
+    history.setStorage(SampleHistory::Storage::Double);
+    QCOMPARE(history.lsb(SampleHistory::VoltageA), 0.0);
+    QVERIFY(std::abs(history[19].voltage.a - makePoint(20).voltage.a) <= 0.5 * lsb + 1e-12);
+}
+
+void TestSampleHistory::testClipping()
+{
+    SampleHistory history;
+    history.setStorage(SampleHistory::Storage::Int16);
+    history.setFullScale(100.0, 1.0);
+
+    DataPoint p{};
+    p.voltage.a = 150.0;
+    p.current.a = -5.0;
+    history.push_back(p);
+
+    QCOMPARE(history.clippedCount(), size_t(2));
+    QCOMPARE(history.back().voltage.a, 100.0);
+    QCOMPARE(history.back().current.a, -1.0);
+}
+
+void TestSampleHistory::testIntervalChangeStartsSegment()
+{
+    using namespace std::chrono_literals;
+    SampleHistory history;
+    std::vector<std::chrono::nanoseconds> times;
+
+    // 1ms 간격 10000개, 이후 333'333ns 간격 5000개 (샘플링 설정 변경)
+    std::chrono::nanoseconds t{0};
+    for(int i{0}; i < 15000; ++i) {
+        DataPoint p = makePoint(i);
+        p.timestamp = t;
+        history.push_back(p);
+        times.push_back(t);
+        t += (i < 10000) ? std::chrono::nanoseconds(1ms) : std::chrono::nanoseconds(333'333);
+    }
+
+    // 15000 = 4096 * 3 + 2712 -> 4블록, 간격 변경은 구간만 추가
+    QCOMPARE(history.blockCount(), size_t(4));
+    QCOMPARE(history.segmentCount(), size_t(2));
+    for(size_t i = 0; i < times.size(); i += 7) {
+        QCOMPARE(history.timestamp(i), times[i]);
+        QCOMPARE(history[i].voltage.a, makePoint(static_cast<int>(i)).voltage.a);
+    }
+
+    // 앞에서 버린 샘플만큼 블록이 해제되고 인덱스는 계속 맞음
+    for(int i{0}; i < 5000; ++i) {
+        history.pop_front();
+    }
+    QCOMPARE(history.blockCount(), size_t(3));
+    QCOMPARE(history.segmentCount(), size_t(2));
+    QCOMPARE(history.front().timestamp, times[5000]);
+    QCOMPARE(history[9999].timestamp, times[14999]);
+
+    // 10000번 샘플까지는 1ms 간격에 맞으므로 첫 구간
+    for(int i{0}; i < 5001; ++i) {
+        history.pop_front();
+    }
+    QCOMPARE(history.segmentCount(), size_t(1));
+    QCOMPARE(history.front().timestamp, times[10001]);
+}
+
+void TestSampleHistory::testAlternatingIntervalKeepsBlockBound()
+{
+    SampleHistory history;
+    history.setStorage(SampleHistory::Storage::Int16);
+    std::vector<std::chrono::nanoseconds> times;
+
+    // 간격이 매 샘플 1000ns/1001ns로 번갈아 바뀜 (추적기 지터) -> 구간은 2샘플씩
+    std::chrono::nanoseconds t{0};
+    constexpr int Count = 20000;
+    for(int i{0}; i < Count; ++i) {
+        DataPoint p = makePoint(i);
+        p.timestamp = t;
+        history.push_back(p);
+        times.push_back(t);
+        t += std::chrono::nanoseconds((i % 2 == 0) ? 1000 : 1001);
+    }
+
+    // 블록 수는 간격 변경과 무관하게 샘플 수 / BlockSize (올림)
+    const size_t blockSize = config::History::BlockSize;
+    QCOMPARE(history.blockCount(), (Count + blockSize - 1) / blockSize);
+    QCOMPARE(history.segmentCount(), size_t(Count / 2));
+    for(size_t i = 0; i < times.size(); ++i) {
+        QCOMPARE(history.timestamp(i), times[i]);
+    }
+    QCOMPARE(history.lowerBound(times[12345]).index(), size_t(12345));
+    QCOMPARE(history.upperBound(times[12345]).index(), size_t(12346));
+
+    // 앞에서 버리면 블록과 구간이 함께 해제
+    for(int i{0}; i < Count / 2; ++i) {
+        history.pop_front();
+    }
+    QCOMPARE(history.blockCount(), size_t(Count - 1) / blockSize - (Count / 2) / blockSize + 1);
+    QCOMPARE(history.segmentCount(), size_t(Count / 4));
+    QCOMPARE(history.front().timestamp, times[Count / 2]);
+}
+
+void TestSampleHistory::testTimeSearchMatchesBinarySearch()
+{
+    SampleHistory history;
+    std::chrono::nanoseconds t{0};
+    for(int i{0}; i < 9000; ++i) {
+        DataPoint p = makePoint(i);
+        p.timestamp = t;
+        history.push_back(p);
+        t += std::chrono::nanoseconds((i < 6000) ? 1000 : 1500);
+    }
+    for(int i{0}; i < 100; ++i) {
+        history.pop_front();
+    }
+
+    const auto lessTime = [](const DataPoint& p, std::chrono::nanoseconds time) { return p.timestamp < time; };
+    const auto timeLess = [](std::chrono::nanoseconds time, const DataPoint& p) { return time < p.timestamp; };
+    for(int64_t query = -5000; query < t.count() + 5000; query += 777) {
+        const std::chrono::nanoseconds time(query);
+        QCOMPARE(history.lowerBound(time).index(),
+                 std::lower_bound(history.begin(), history.end(), time, lessTime).index());
+        QCOMPARE(history.upperBound(time).index(),
+                 std::upper_bound(history.begin(), history.end(), time, timeLess).index());
+    }
+    // 샘플 시각과 정확히 같은 경우
+    const auto exact = history.timestamp(4321);
+    QCOMPARE(history.lowerBound(exact).index(), size_t(4321));
+    QCOMPARE(history.upperBound(exact).index(), size_t(4322));
+}
+
+void TestSampleHistory::testCopyIsIndependentSnapshot()
+{
+    SampleHistory history;
+    for(int i{0}; i < 5000; ++i) {
+        history.push_back(makePoint(i));
+    }
+
+    // 복사본은 블록을 공유하고, 원본에 추가/삭제해도 복사 시점 내용 그대로
+    const SampleHistorySnapshot snapshot = std::make_shared<const SampleHistory>(history);
+    for(int i{5000}; i < 9000; ++i) {
+        history.push_back(makePoint(i));
+        history.pop_front();
+    }
+    history.setStorage(SampleHistory::Storage::Int16);
+
+    QCOMPARE(snapshot->size(), size_t(5000));
+    QCOMPARE(snapshot->storage(), SampleHistory::Storage::Double);
+    for(size_t i = 0; i < snapshot->size(); i += 13) {
+        QCOMPARE((*snapshot)[i].voltage.a, makePoint(static_cast<int>(i)).voltage.a);
+        QCOMPARE(snapshot->timestamp(i), makePoint(static_cast<int>(i)).timestamp);
+    }
+    QCOMPARE(history.size(), size_t(5000));
+    QCOMPARE(history.front().timestamp, makePoint(4000).timestamp);
+}
+
+QTEST_MAIN(TestSampleHistory)
+#include "test_sample_history.moc"
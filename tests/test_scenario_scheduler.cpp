@@ -0,0 +1,114 @@
+#include <QtTest>
+#include "../scenario_scheduler.h"
+#include "../simulation_engine.h"
+
+class TestScenarioScheduler : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    void testParseJson();
+    void testSampleExactActions();
+    void testFrequencyRampEndsOnTarget();
+    void testEngineAppliesSagAtExactSample();
+};
+
+void TestScenarioScheduler::testParseJson()
+{
+    const QByteArray json = R"({
+        "name": "suite",
+        "events": [
+            { "time": 0.5, "type": "sag", "depth": 0.3, "duration": 0.1, "phases": "ab" },
+            { "time": 1.0, "type": "harmonic", "order": 5, "magnitude": 10, "target": "current" },
+            { "time": 2.0, "type": "unbalance", "phases": "c", "scale": 0.9, "degrees": -5 }
+        ]
+    })";
+
+    auto timeline = ScenarioScheduler::fromJson(json);
+    QVERIFY(timeline.has_value());
+    QCOMPARE(timeline->name, QString("suite"));
+    QCOMPARE(timeline->events.size(), size_t(3));
+    QCOMPARE(timeline->events[0].phases, 0b011u);
+    QCOMPARE(timeline->events[0].duration, std::chrono::nanoseconds(100'000'000));
+    QVERIFY(timeline->events[1].currentTarget);
+
+    // 잘못된 타입, 기간 없는 새그는 오류
+    QVERIFY(!ScenarioScheduler::fromJson(R"({"events": [{"time": 0, "type": "spike"}]})").has_value());
+    QVERIFY(!ScenarioScheduler::fromJson(R"({"events": [{"time": 0, "type": "sag", "depth": 0.5}]})").has_value());
+}
+
+void TestScenarioScheduler::testSampleExactActions()
+{
+    using namespace std::chrono_literals;
+    ScenarioScheduler scheduler;
+    ScenarioScheduler::Timeline timeline;
+    timeline.events.push_back({ .time = 1050ns, .duration = 100ns, .type = ScenarioScheduler::EventType::Sag, .depth = 0.5 });
+
+    const auto origin = 1000ns;
+    scheduler.start(timeline, origin);
+    QVERIFY(scheduler.isActive());
+
+    // 동작 시각 2050ns. 100ns 간격 샘플(1000, 1100, ...) 중 처음으로 2050 이상인 것은 2100 -> 11개 생성 후 적용
+    QCOMPARE(scheduler.samplesUntilNextAction(origin, 100ns, 1000), 11);
+    QCOMPARE(scheduler.samplesUntilNextAction(origin, 100ns, 5), 5);
+
+    QVERIFY(!scheduler.applyDue(2000ns));
+    QCOMPARE(scheduler.state().dipScale[0], 1.0);
+    QVERIFY(!scheduler.applyDue(2100ns));
+    QCOMPARE(scheduler.state().dipScale[0], 0.5);
+    QCOMPARE(scheduler.samplesUntilNextAction(2100ns, 100ns, 1000), 1); // 종료 시각 2150
+    QVERIFY(scheduler.applyDue(2200ns)); // 마지막 동작
+    QCOMPARE(scheduler.state().dipScale[0], 1.0);
+    QVERIFY(!scheduler.isActive());
+    QCOMPARE(scheduler.samplesUntilNextAction(2200ns, 100ns, 1000), 1000);
+}
+
+void TestScenarioScheduler::testFrequencyRampEndsOnTarget()
+{
+    using namespace std::chrono_literals;
+    ScenarioScheduler scheduler;
+    ScenarioScheduler::Timeline timeline;
+    timeline.events.push_back({ .time = 0ns, .duration = 1s, .type = ScenarioScheduler::EventType::FrequencyRamp, .deltaHz = -0.5 });
+    scheduler.start(timeline, 0ns);
+
+    scheduler.applyDue(0ns);
+    QCOMPARE(scheduler.state().frequencySlopeHzPerSec, -0.5);
+
+    // 불규칙한 간격으로 진행해도 끝에서는 정확히 목표 편차
+    for(int i{0}; i < 3333; ++i) scheduler.advance(0.0003);
+    QVERIFY(scheduler.applyDue(1s));
+    QCOMPARE(scheduler.state().frequencyOffsetHz, -0.5);
+    QCOMPARE(scheduler.state().frequencySlopeHzPerSec, 0.0);
+}
+
+void TestScenarioScheduler::testEngineAppliesSagAtExactSample()
+{
+    using namespace std::chrono_literals;
+    SimulationEngine engine;
+    engine.m_voltageHarmonic.setValue({});
+    engine.m_amplitude.setValue(100.0);
+
+    ScenarioScheduler::Timeline timeline;
+    timeline.events.push_back({ .time = 10ms, .duration = 1s, .type = ScenarioScheduler::EventType::Sag, .depth = 1.0 });
+    engine.startScenario(timeline);
+
+    QSignalSpy spy(&engine, &SimulationEngine::dataUpdated);
+    engine.runFor(20ms);
+    QVERIFY(spy.count() > 0);
+    const auto data = spy.last().at(0).value<SampleHistory>();
+    QVERIFY(!data.empty());
+
+    // 10ms 이전 샘플은 원래 파형, 이후는 완전 강하(0)
+    bool sawSignal = false;
+    for(const auto& point : data) {
+        if(point.timestamp < 10ms) {
+            sawSignal |= std::abs(point.voltage.a) > 1.0;
+        } else {
+            QCOMPARE(point.voltage.a, 0.0);
+        }
+    }
+    QVERIFY(sawSignal);
+}
+
+QTEST_MAIN(TestScenarioScheduler)
+#include "test_scenario_scheduler.moc"
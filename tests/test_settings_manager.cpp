@@ -0,0 +1,159 @@
+#include <QtTest>
+#include <QTemporaryDir>
+#include "../settings_manager.h"
+
+class TestSettingsManager : public QObject
+{
+    Q_OBJECT
+
+private:
+    enum class Mode { First, Second, Third };
+
+private slots:
+    void testPresetRoundTrip();
+    void testTypedValues();
+    void testSchemaMigration();
+    void testRecoversAfterFailedStatement();
+};
+
+void TestSettingsManager::testPresetRoundTrip()
+{
+    QTemporaryDir dir;
+    QVERIFY(dir.isValid());
+    SettingsManager manager(dir.filePath("settings.db").toStdString());
+
+    const SettingsManager::Preset preset = {
+        {"amplitude", SettingsManager::Value{220.5}},
+        {"samplesPerCycle", SettingsManager::Value{64LL}},
+        {"name", SettingsManager::Value{std::string("기본")}},
+    };
+    QVERIFY(manager.savePreset("A", preset).has_value());
+
+    auto loaded = manager.loadPreset("A");
+    QVERIFY(loaded.has_value());
+    QVERIFY(*loaded == preset);
+
+    // 같은 키는 덮어쓰고 다른 프리셋에는 영향 없음
+    QVERIFY(manager.savePreset("A", {{"amplitude", SettingsManager::Value{110.0}}}).has_value());
+    QVERIFY(manager.savePreset("B", {{"amplitude", SettingsManager::Value{1.0}}}).has_value());
+    loaded = manager.loadPreset("A");
+    QVERIFY(loaded.has_value());
+    QCOMPARE(loaded->size(), size_t(3));
+    QCOMPARE(SettingsManager::presetValue(*loaded, "amplitude", 0.0).value(), 110.0);
+
+    const auto names = manager.getAllPresetNames();
+    QVERIFY(names.has_value());
+    QCOMPARE(names->size(), size_t(2));
+
+    // 없는 프리셋은 빈 맵
+    loaded = manager.loadPreset("none");
+    QVERIFY(loaded.has_value());
+    QVERIFY(loaded->empty());
+}
+
+void TestSettingsManager::testTypedValues()
+{
+    QTemporaryDir dir;
+    QVERIFY(dir.isValid());
+    SettingsManager manager(dir.filePath("settings.db").toStdString());
+
+    QVERIFY(manager.saveSetting("P", "int", 42).has_value());
+    QVERIFY(manager.saveSetting("P", "double", 0.1).has_value());
+    QVERIFY(manager.saveSetting("P", "bool", true).has_value());
+    QVERIFY(manager.saveSetting("P", "enum", Mode::Third).has_value());
+    QVERIFY(manager.saveSetting("P", "text", std::string("abc")).has_value());
+
+    // 정수/실수는 문자열을 거치지 않고 타입 그대로 저장
+    const auto preset = manager.loadPreset("P");
+    QVERIFY(preset.has_value());
+    QVERIFY(std::holds_alternative<long long>(preset->at("int")));
+    QVERIFY(std::holds_alternative<double>(preset->at("double")));
+    QVERIFY(std::holds_alternative<long long>(preset->at("bool")));
+    QVERIFY(std::holds_alternative<std::string>(preset->at("text")));
+
+    QCOMPARE(manager.loadSetting("P", "int", 0).value(), 42);
+    QCOMPARE(manager.loadSetting("P", "double", 0.0).value(), 0.1);
+    QCOMPARE(manager.loadSetting("P", "bool", false).value(), true);
+    QVERIFY(manager.loadSetting("P", "enum", Mode::First).value() == Mode::Third);
+    QCOMPARE(manager.loadSetting("P", "text", std::string()).value(), std::string("abc"));
+
+    // 키가 없으면 기본값, 숫자를 문자열로 요청하면 변환
+    QCOMPARE(manager.loadSetting("P", "missing", 7).value(), 7);
+    QCOMPARE(manager.loadSetting("P", "int", std::string()).value(), std::string("42"));
+
+    // 문자열을 숫자로 해석할 수 없으면 오류
+    QVERIFY(!manager.loadSetting("P", "text", 0).has_value());
+}
+
+void TestSettingsManager::testSchemaMigration()
+{
+    QTemporaryDir dir;
+    QVERIFY(dir.isValid());
+    const std::string path = dir.filePath("settings.db").toStdString();
+
+    // 버전 0 DB: value TEXT 열이라 숫자도 문자열로 저장됨
+    {
+        sqlite::database legacy(path);
+        legacy << "CREATE TABLE Settings (preset_name TEXT NOT NULL, key TEXT NOT NULL, value TEXT,"
+                  " PRIMARY KEY (preset_name, key));";
+        legacy << "INSERT INTO Settings VALUES ('P', 'amplitude', 220.5), ('P', 'count', '12'), ('P', 'name', 'abc');";
+    }
+
+    {
+        SettingsManager manager(path);
+        QCOMPARE(manager.loadSetting("P", "amplitude", 0.0).value(), 220.5);
+        QCOMPARE(manager.loadSetting("P", "count", 0).value(), 12);
+        QCOMPARE(manager.loadSetting("P", "name", std::string()).value(), std::string("abc"));
+
+        // 이관 후 새로 저장한 값은 타입 그대로
+        QVERIFY(manager.saveSetting("P", "count", 13).has_value());
+        const auto preset = manager.loadPreset("P");
+        QVERIFY(preset.has_value());
+        QVERIFY(std::holds_alternative<long long>(preset->at("count")));
+        QVERIFY(std::holds_alternative<std::string>(preset->at("amplitude")));
+    }
+
+    sqlite::database check(path);
+    int version = 0;
+    check << "PRAGMA user_version;" >> version;
+    QCOMPARE(version, 1);
+    int legacyTables = -1;
+    check << "SELECT count(*) FROM sqlite_master WHERE name = 'Settings_v0';" >> legacyTables;
+    QCOMPARE(legacyTables, 0);
+
+    // 이미 이관된 DB를 다시 열어도 값 유지
+    SettingsManager reopened(path);
+    QCOMPARE(reopened.loadSetting("P", "count", 0).value(), 13);
+}
+
+void TestSettingsManager::testRecoversAfterFailedStatement()
+{
+    QTemporaryDir dir;
+    QVERIFY(dir.isValid());
+    const std::string path = dir.filePath("settings.db").toStdString();
+    SettingsManager manager(path);
+    QVERIFY(manager.saveSetting("P", "a", 1).has_value());
+
+    // 다른 연결에서 테이블을 지워 준비된 구문이 실행 중 실패하게 함
+    sqlite::database other(path);
+    other << "DROP TABLE Settings;";
+    QVERIFY(!manager.saveSetting("P", "a", 2).has_value());
+    QVERIFY(!manager.savePreset("P", {{"a", SettingsManager::Value{3LL}}, {"b", SettingsManager::Value{4LL}}}).has_value());
+    QVERIFY(!manager.loadSetting("P", "a", 0).has_value());
+
+    // 테이블이 돌아오면 이전 실패의 바인딩이 남지 않고 정상 동작 (실패한 프리셋 저장은 롤백됨)
+    other << "CREATE TABLE Settings (preset_name TEXT NOT NULL, key TEXT NOT NULL, value NOT NULL,"
+             " PRIMARY KEY (preset_name, key)) WITHOUT ROWID;";
+    auto preset = manager.loadPreset("P");
+    QVERIFY(preset.has_value());
+    QVERIFY(preset->empty());
+
+    QVERIFY(manager.savePreset("P", {{"a", SettingsManager::Value{5LL}}, {"b", SettingsManager::Value{6LL}}}).has_value());
+    QVERIFY(manager.saveSetting("P", "c", 7).has_value());
+    QCOMPARE(manager.loadSetting("P", "a", 0).value(), 5);
+    QCOMPARE(manager.loadSetting("P", "b", 0).value(), 6);
+    QCOMPARE(manager.loadSetting("P", "c", 0).value(), 7);
+}
+
+QTEST_MAIN(TestSettingsManager)
+#include "test_settings_manager.moc"
@@ -54,7 +54,7 @@ void TestSimulationEngine::testCaptureData()
 
     // 데이터 검증
     auto args = spy.takeFirst();
-    auto dataDeque = args.at(0).value<std::deque<DataPoint>>();
+    auto dataDeque = args.at(0).value<SampleHistory>();
     QVERIFY(!dataDeque.empty());
 
     DataPoint dp = dataDeque.back();
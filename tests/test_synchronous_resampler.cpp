@@ -0,0 +1,177 @@
+#include <QtTest>
+#include <cmath>
+#include <numbers>
+#include "../synchronous_resampler.h"
+#include "../analysis_utils.h"
+#include "../config.h"
+
+class TestSynchronousResampler : public QObject
+{
+    Q_OBJECT
+
+private:
+    // fs = 1kHz에서 A상 전압: 기본파 100V + 3고조파 10V
+    static DataPoint makeSample(int n, double frequency);
+
+private slots:
+    void testLockedPowerOfTwoIsExactCopy();
+    void testOffNominalToneHasNoLeakage();
+    void testLockedNonPowerOfTwoKeepsDirectSpectrum();
+    void testInsufficientHistoryAndRange();
+};
+
+DataPoint TestSynchronousResampler::makeSample(int n, double frequency)
+{
+    const double phase = 2.0 * std::numbers::pi * frequency * n / 1000.0;
+    DataPoint point{};
+    point.timestamp = std::chrono::microseconds(1000) * n;
+    point.voltage.a = 100.0 * std::sin(phase) + 10.0 * std::sin(3.0 * phase);
+    point.current.c = 5.0 * std::cos(phase);
+    return point;
+}
+
+void TestSynchronousResampler::testLockedPowerOfTwoIsExactCopy()
+{
+    // 주기 = 사이클당 샘플 수 = 2^k이면 보간 위치가 모두 정수 -> 입력 그대로 (커널 지연만큼 앞 구간)
+    for(auto kernel : {SynchronousResampler::Kernel::Cubic, SynchronousResampler::Kernel::Sinc}) {
+        SynchronousResampler resampler;
+        resampler.setKernel(kernel);
+        resampler.configure(32);
+        QCOMPARE(resampler.outputSize(), size_t{32});
+
+        std::vector<DataPoint> input;
+        for(int n{0}; n < 100; ++n) {
+            input.push_back(makeSample(n, 1000.0 / 32.0));
+            resampler.push(input.back());
+        }
+        QVERIFY(resampler.resample(32.0, std::chrono::microseconds(1000)));
+
+        const int delay = (kernel == SynchronousResampler::Kernel::Cubic) ? 2 : 8;
+        const int first = 100 - delay - 32;
+        const auto& cycle = resampler.cycle();
+        for(int j{0}; j < 32; ++j) {
+            QVERIFY(std::abs(cycle[j].voltage.a - input[first + j].voltage.a) < 1e-12);
+            QVERIFY(std::abs(cycle[j].current.c - input[first + j].current.c) < 1e-12);
+            QCOMPARE(cycle[j].timestamp, input[first + j].timestamp);
+        }
+    }
+}
+
+void TestSynchronousResampler::testOffNominalToneHasNoLeakage()
+{
+    // 20샘플/사이클 설정인데 신호는 51.3Hz (주기 19.49샘플): 사이클 버퍼는 정수 주기가 아님
+    constexpr double Frequency = 51.3;
+    constexpr double SamplesPerPeriod = 1000.0 / Frequency;
+    const auto rms = [](const AnalysisUtils::Spectrum& spectrum, int order) { return std::abs(spectrum[order]); };
+
+    std::vector<DataPoint> raw;
+    for(int n{180}; n < 200; ++n) {
+        raw.push_back(makeSample(n, Frequency));
+    }
+    const auto rawSpectrum = AnalysisUtils::calculateSpectrum(raw, AnalysisUtils::DataType::Voltage, 0, false);
+    QVERIFY(rawSpectrum.has_value());
+    QVERIFY(rms(*rawSpectrum, 2) > 1.0); // 누설
+
+    struct Case { SynchronousResampler::Kernel kernel; double tolerance; };
+    for(const Case& c : {Case{SynchronousResampler::Kernel::Cubic, 0.02}, Case{SynchronousResampler::Kernel::Sinc, 0.005}}) {
+        SynchronousResampler resampler;
+        resampler.setKernel(c.kernel);
+        resampler.configure(20);
+        QCOMPARE(resampler.outputSize(), size_t{32});
+        for(int n{0}; n < 200; ++n) {
+            resampler.push(makeSample(n, Frequency));
+        }
+        QVERIFY(resampler.resample(SamplesPerPeriod, std::chrono::microseconds(1000)));
+
+        const auto spectrum = AnalysisUtils::calculateSpectrum(resampler.cycle(), AnalysisUtils::DataType::Voltage, 0, false);
+        QVERIFY(spectrum.has_value());
+        QCOMPARE(spectrum->size(), size_t{17});
+        QVERIFY(std::abs(rms(*spectrum, 1) - 100.0 / std::sqrt(2.0)) < c.tolerance * 10.0);
+        QVERIFY(std::abs(rms(*spectrum, 3) - 10.0 / std::sqrt(2.0)) < c.tolerance * 10.0);
+        QVERIFY(rms(*spectrum, 2) < c.tolerance);
+        QVERIFY(rms(*spectrum, 4) < c.tolerance);
+
+        // 출력 시각 간격 = 주기 / 32
+        const auto& cycle = resampler.cycle();
+        const double spacingUs = std::chrono::duration<double, std::micro>(cycle[1].timestamp - cycle[0].timestamp).count();
+        QVERIFY(std::abs(spacingUs - 1.0e6 / Frequency / 32.0) < 1.0);
+    }
+}
+
+void TestSynchronousResampler::testLockedNonPowerOfTwoKeepsDirectSpectrum()
+{
+    // 20샘플/사이클에 정확히 고정된 50Hz: 버퍼가 이미 한 주기라 직접 FFT가 정확
+    struct Harmonic { int order; double amplitude; };
+    constexpr std::array<Harmonic, 4> Harmonics = {{{1, 100.0}, {5, 8.0}, {8, 4.0}, {9, 6.0}}};
+    const auto makeLocked = [&](int n) {
+        const double phase = 2.0 * std::numbers::pi * 50.0 * n / 1000.0;
+        DataPoint point{};
+        point.timestamp = std::chrono::microseconds(1000) * n;
+        for(const Harmonic& h : Harmonics) {
+            point.voltage.a += h.amplitude * std::sin(h.order * phase);
+        }
+        return point;
+    };
+
+    QVERIFY(SynchronousResampler::isCoherent(20.0, 20));
+    QVERIFY(SynchronousResampler::isCoherent(20.0 + 0.5 * config::Resampling::CoherentTolerance, 20));
+    QVERIFY(!SynchronousResampler::isCoherent(1000.0 / 51.3, 20));
+    QVERIFY(!SynchronousResampler::isCoherent(20.0, 0));
+
+    std::vector<DataPoint> raw;
+    for(int n{180}; n < 200; ++n) {
+        raw.push_back(makeLocked(n));
+    }
+    const auto direct = AnalysisUtils::calculateSpectrum(raw, AnalysisUtils::DataType::Voltage, 0, false);
+    QVERIFY(direct.has_value());
+    QCOMPARE(direct->size(), size_t{11});
+    for(const Harmonic& h : Harmonics) {
+        QVERIFY(std::abs(std::abs((*direct)[h.order]) - h.amplitude / std::sqrt(2.0)) < 1e-4 * h.amplitude);
+    }
+    QVERIFY(std::abs((*direct)[3]) < 1e-3);
+
+    // 같은 주기를 32점으로 보간하면 나이퀴스트 근처 차수가 깎임 -> 고정 시에는 재표본화하지 않아야 함
+    for(auto kernel : {SynchronousResampler::Kernel::Cubic, SynchronousResampler::Kernel::Sinc}) {
+        SynchronousResampler resampler;
+        resampler.setKernel(kernel);
+        resampler.configure(20);
+        for(int n{0}; n < 200; ++n) {
+            resampler.push(makeLocked(n));
+        }
+        QVERIFY(resampler.resample(20.0, std::chrono::microseconds(1000)));
+        const auto resampled = AnalysisUtils::calculateSpectrum(resampler.cycle(), AnalysisUtils::DataType::Voltage, 0, false);
+        QVERIFY(resampled.has_value());
+        const double h9 = std::abs((*resampled)[9]) / std::abs((*direct)[9]);
+        QVERIFY(std::abs(h9 - 1.0) > 0.05);
+    }
+}
+
+void TestSynchronousResampler::testInsufficientHistoryAndRange()
+{
+    SynchronousResampler resampler;
+    resampler.configure(20);
+    for(int n{0}; n < 20; ++n) {
+        resampler.push(makeSample(n, 50.0));
+    }
+    QVERIFY(!resampler.resample(20.0, std::chrono::microseconds(1000))); // 주기 + 커널 여유 부족
+
+    for(int n{20}; n < 100; ++n) {
+        resampler.push(makeSample(n, 50.0));
+    }
+    QVERIFY(resampler.resample(20.0, std::chrono::microseconds(1000)));
+    QVERIFY(!resampler.resample(45.0, std::chrono::microseconds(1000))); // 허용 주기(2배) 초과
+    QVERIFY(!resampler.resample(0.0, std::chrono::microseconds(1000)));
+
+    // 재설정하면 이력을 비움
+    resampler.configure(20);
+    QVERIFY(!resampler.resample(20.0, std::chrono::microseconds(1000)));
+
+    // 사이클당 샘플 수가 너무 적으면 비활성
+    resampler.configure(3);
+    QCOMPARE(resampler.outputSize(), size_t{0});
+    resampler.push(makeSample(0, 50.0));
+    QVERIFY(!resampler.resample(3.0, std::chrono::microseconds(1000)));
+}
+
+QTEST_MAIN(TestSynchronousResampler)
+#include "test_synchronous_resampler.moc"
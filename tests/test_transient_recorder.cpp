@@ -0,0 +1,215 @@
+#include <QtTest>
+#include <QTemporaryDir>
+#include <atomic>
+#include <cmath>
+#include <limits>
+#include <numbers>
+#include <thread>
+#include "../transient_recorder.h"
+
+class TestTransientRecorder : public QObject
+{
+    Q_OBJECT
+
+private:
+    static constexpr int SamplesPerCycle = 64;
+    static constexpr double Nominal = 230.0;
+    static constexpr std::chrono::nanoseconds SampleInterval{312'500}; // 50Hz, 64샘플/사이클
+
+    // 공칭 정현파 count 샘플 입력. spikeAt 샘플에만 spike를 더함 (-1이면 없음)
+    void feed(TransientRecorder& recorder, int count, int spikeAt = -1, double spike = 0.0);
+    TransientRecorder::TriggerSettings waveshapeOnly() const;
+    long long m_sampleIndex = 0;
+
+private slots:
+    void init();
+    void testWaveshapeCapturesPreAndPost();
+    void testSteadyDistortionDoesNotTrigger();
+    void testPoolExhaustionDropsWithoutBlocking();
+    void testExternalTriggerAndSink();
+    void testFileNameAndRetention();
+};
+
+void TestTransientRecorder::init()
+{
+    m_sampleIndex = 0;
+}
+
+void TestTransientRecorder::feed(TransientRecorder& recorder, int count, int spikeAt, double spike)
+{
+    const double peak = Nominal * std::numbers::sqrt2;
+    for(int i{0}; i < count; ++i, ++m_sampleIndex) {
+        double value = peak * std::sin(2.0 * std::numbers::pi * m_sampleIndex / SamplesPerCycle);
+        if(i == spikeAt) value += spike;
+        recorder.process(SampleInterval * m_sampleIndex, {value, value, value, 1.0, 1.0, 1.0});
+    }
+}
+
+TransientRecorder::TriggerSettings TestTransientRecorder::waveshapeOnly() const
+{
+    auto settings = TransientRecorder::defaultTriggers();
+    settings.dvdt = 0.0;
+    settings.rmsChange = 0.0;
+    settings.holdoffSamples = 0;
+    return settings;
+}
+
+void TestTransientRecorder::testWaveshapeCapturesPreAndPost()
+{
+    TransientRecorder recorder;
+    recorder.configure(32, 64, 4);
+    recorder.setTriggers(waveshapeOnly());
+    recorder.setFundamentalFrequency(50.0);
+    recorder.setSamplesPerCycle(SamplesPerCycle);
+    recorder.setNominalVoltage(0, Nominal);
+
+    std::vector<TransientCapture> captures;
+    recorder.setCaptureSink([&](const TransientCapture& capture) { captures.push_back(capture); });
+
+    feed(recorder, 120, 100, 800.0);
+    QCOMPARE(recorder.activeCaptureCount(), 1);
+    feed(recorder, 100); // 한 주기 뒤 스파이크가 기준으로 돌아와도 다시 트리거되지 않음
+    recorder.flush();
+
+    QCOMPARE(captures.size(), size_t(1));
+    const auto& capture = captures.front();
+    QCOMPARE(capture.trigger, TransientCapture::Trigger::Waveshape);
+    QCOMPARE(capture.channel, 0);
+    QCOMPARE(capture.preTriggerSamples, 32);
+    QCOMPARE(capture.size, 96);
+    QCOMPARE(capture.triggerTime, SampleInterval * 100);
+    // 사전 구간은 트리거 직전 샘플까지 시간순, 트리거 샘플은 사후 구간의 첫 샘플
+    QCOMPARE(capture.timestamps.front(), SampleInterval * 68);
+    QCOMPARE(capture.timestamps[capture.preTriggerSamples], capture.triggerTime);
+    QVERIFY(capture.samples[TransientCapture::VoltageA][32] > Nominal * std::numbers::sqrt2);
+}
+
+void TestTransientRecorder::testSteadyDistortionDoesNotTrigger()
+{
+    // 공칭보다 30% 높고 5고조파가 섞인 파형은 고정 레벨(1.2배 피크)이면 매 주기 트리거되지만
+    // 한 주기 전과 같으므로 트리거 없음. 진폭이 반으로 떨어지는 순간에만 한 번 트리거
+    TransientRecorder recorder;
+    recorder.configure(32, 64, 4);
+    recorder.setFundamentalFrequency(50.0);
+    recorder.setSamplesPerCycle(SamplesPerCycle);
+    recorder.setNominalVoltage(0, Nominal);
+
+    std::vector<TransientCapture> captures;
+    recorder.setCaptureSink([&](const TransientCapture& capture) { captures.push_back(capture); });
+
+    const auto feedDistorted = [&](int count, double scale) {
+        const double peak = Nominal * std::numbers::sqrt2;
+        for(int i{0}; i < count; ++i, ++m_sampleIndex) {
+            const double phase = 2.0 * std::numbers::pi * m_sampleIndex / SamplesPerCycle;
+            const double value = scale * peak * (std::sin(phase) + 0.2 * std::sin(5.0 * phase));
+            recorder.process(SampleInterval * m_sampleIndex, {value, value, value, 1.0, 1.0, 1.0});
+        }
+    };
+
+    feedDistorted(SamplesPerCycle * 10, 1.3);
+    QCOMPARE(recorder.activeCaptureCount(), 0);
+    QCOMPARE(recorder.capturedCount(), size_t(0));
+
+    // 기본파 최대값 위상에서 진폭 변화
+    feedDistorted(SamplesPerCycle / 4, 1.3);
+    const auto stepTime = SampleInterval * m_sampleIndex;
+    feedDistorted(SamplesPerCycle * 10, 0.65);
+    recorder.flush();
+
+    QCOMPARE(captures.size(), size_t(1));
+    QCOMPARE(captures.front().trigger, TransientCapture::Trigger::Waveshape);
+    QCOMPARE(captures.front().triggerTime, stepTime);
+}
+
+void TestTransientRecorder::testPoolExhaustionDropsWithoutBlocking()
+{
+    // 싱크 없이 버퍼 2개: 겹치는 재트리거 3번 중 마지막은 버려짐
+    TransientRecorder recorder;
+    recorder.configure(16, 200, 2);
+    recorder.setTriggers(waveshapeOnly());
+    recorder.setFundamentalFrequency(50.0);
+    recorder.setSamplesPerCycle(SamplesPerCycle);
+    recorder.setNominalVoltage(0, Nominal);
+
+    feed(recorder, SamplesPerCycle + 2); // 한 주기 전 기준이 생길 때까지
+    feed(recorder, 20, 10, 800.0);
+    feed(recorder, 20, 10, 800.0);
+    feed(recorder, 20, 10, 800.0);
+    QCOMPARE(recorder.activeCaptureCount(), 2);
+    QCOMPARE(recorder.droppedCount(), size_t(1));
+
+    feed(recorder, 300);
+    QCOMPARE(recorder.capturedCount(), size_t(2));
+    QCOMPARE(recorder.activeCaptureCount(), 0);
+
+    // 버퍼가 풀로 돌아왔으므로 다시 캡처 가능
+    feed(recorder, 20, 10, 800.0);
+    QCOMPARE(recorder.activeCaptureCount(), 1);
+}
+
+void TestTransientRecorder::testExternalTriggerAndSink()
+{
+    TransientRecorder recorder;
+    recorder.configure(8, 8, 4);
+    recorder.setFundamentalFrequency(50.0);
+    recorder.setSamplesPerCycle(SamplesPerCycle);
+    recorder.setNominalVoltage(0, Nominal);
+
+    std::atomic<int> received{0};
+    std::thread::id sinkThread;
+    recorder.setCaptureSink([&](const TransientCapture& capture) {
+        sinkThread = std::this_thread::get_id();
+        if(capture.trigger == TransientCapture::Trigger::External && capture.channel == -1) ++received;
+    });
+
+    feed(recorder, 50);
+    recorder.triggerExternal();
+    feed(recorder, 20);
+    recorder.flush();
+
+    QCOMPARE(received.load(), 1);
+    QVERIFY(sinkThread != std::this_thread::get_id());
+    QCOMPARE(recorder.droppedCount(), size_t(0));
+}
+
+void TestTransientRecorder::testFileNameAndRetention()
+{
+    QTemporaryDir dir;
+    QVERIFY(dir.isValid());
+
+    // 시뮬레이션 시각은 고정 폭이라 이름순이 시각순 (세션이 다르면 세션 시작 시각순)
+    TransientCapture capture;
+    capture.trigger = TransientCapture::Trigger::DvDt;
+    capture.triggerTime = std::chrono::nanoseconds(1'500);
+    QCOMPARE(TransientRecorder::captureFileName("20260101-000000", capture),
+             QString("transient_20260101-000000_00000000000000001500_dvdt.csv"));
+
+    capture.size = 4;
+    capture.timestamps.assign(4, std::chrono::nanoseconds{0});
+    for(auto& channel : capture.samples) {
+        channel.assign(4, 1.0);
+    }
+    QStringList names;
+    for(long long ns : {3'000'000'000LL, 20'000LL, 100'000'000LL}) {
+        for(const char* session : {"20260101-000000", "20260102-000000"}) {
+            capture.triggerTime = std::chrono::nanoseconds(ns);
+            const QString name = TransientRecorder::captureFileName(session, capture);
+            QVERIFY(TransientRecorder::writeCsv(capture, dir.filePath(name)).has_value());
+            names.push_back(name);
+        }
+    }
+    names.sort();
+
+    // 파일 수 제한: 오래된 것부터 삭제
+    QCOMPARE(TransientRecorder::enforceRetention(dir.path(), 4, std::numeric_limits<qint64>::max()), size_t(2));
+    QDir directory(dir.path());
+    QCOMPARE(directory.entryList(QDir::Files, QDir::Name), names.mid(2));
+
+    // 크기 제한: 파일 하나 크기만 남도록
+    const qint64 fileSize = QFileInfo(dir.filePath(names.back())).size();
+    QCOMPARE(TransientRecorder::enforceRetention(dir.path(), 100, fileSize), size_t(3));
+    QCOMPARE(directory.entryList(QDir::Files, QDir::Name), QStringList{names.back()});
+}
+
+QTEST_MAIN(TestTransientRecorder)
+#include "test_transient_recorder.moc"
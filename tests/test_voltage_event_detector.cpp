@@ -0,0 +1,134 @@
+#include <QtTest>
+#include <cmath>
+#include <numbers>
+#include <vector>
+#include "../voltage_event_detector.h"
+
+class TestVoltageEventDetector : public QObject
+{
+    Q_OBJECT
+
+private:
+    static constexpr int SamplesPerCycle = 100;
+    static constexpr double Nominal = 230.0;
+    static constexpr std::chrono::nanoseconds SampleInterval{200'000}; // 50Hz, 100샘플/사이클
+
+    // 지정한 배율(공칭 대비)로 cycles 사이클 동안 입력
+    void feed(VoltageEventDetector& detector, double scale, int cycles);
+    long long m_sampleIndex = 0;
+
+private slots:
+    void init();
+    void testHalfCycleRmsMatchesWindow();
+    void testDipStartDurationResidual();
+    void testHysteresisAndInterruption();
+};
+
+void TestVoltageEventDetector::init()
+{
+    m_sampleIndex = 0;
+}
+
+void TestVoltageEventDetector::feed(VoltageEventDetector& detector, double scale, int cycles)
+{
+    const double peak = Nominal * std::numbers::sqrt2 * scale;
+    for(int i{0}; i < cycles * SamplesPerCycle; ++i, ++m_sampleIndex) {
+        const double value = peak * std::sin(2.0 * std::numbers::pi * m_sampleIndex / SamplesPerCycle);
+        const double frame[] = {value};
+        detector.process(SampleInterval * m_sampleIndex, frame);
+    }
+}
+
+void TestVoltageEventDetector::testHalfCycleRmsMatchesWindow()
+{
+    // 홀수 샘플 수에서도 직전 한 사이클 창의 RMS와 같아야 함
+    constexpr int samplesPerCycle = 63;
+    HalfCycleRms rms;
+    rms.configure(2, samplesPerCycle);
+
+    std::vector<double> history;
+    int updates = 0;
+    for(int i{0}; i < samplesPerCycle * 5; ++i) {
+        const double a = 100.0 * std::sin(0.1 * i) + (i % 7);
+        const double frame[] = {a, -2.0 * a};
+        history.push_back(a);
+
+        if(rms.process(frame)) {
+            ++updates;
+            double sumSq = 0.0;
+            for(size_t k = history.size() - samplesPerCycle; k < history.size(); ++k) {
+                sumSq += history[k] * history[k];
+            }
+            const double expected = std::sqrt(sumSq / samplesPerCycle);
+            QVERIFY(std::abs(rms.values()[0] - expected) < 1e-9);
+            QVERIFY(std::abs(rms.values()[1] - 2.0 * expected) < 1e-9);
+        }
+    }
+    // 첫 사이클이 찬 뒤부터 반주기마다 갱신 (5사이클 = 반주기 10개 중 9개)
+    QCOMPARE(updates, 9);
+}
+
+void TestVoltageEventDetector::testDipStartDurationResidual()
+{
+    VoltageEventDetector detector(1);
+    detector.setSamplesPerCycle(SamplesPerCycle);
+    detector.setNominalVoltage(0, Nominal);
+
+    std::vector<VoltageEvent> events;
+    detector.setEventCallback([&](const VoltageEvent& e) { events.push_back(e); });
+
+    feed(detector, 1.0, 10);
+    const auto dipStart = SampleInterval * m_sampleIndex;
+    feed(detector, 0.5, 5);
+    QVERIFY(detector.isEventActive());
+    feed(detector, 1.0, 10);
+
+    QCOMPARE(events.size(), size_t(1));
+    const auto& e = events.front();
+    QCOMPARE(e.type, VoltageEvent::Type::Dip);
+    QCOMPARE(e.channel, 0);
+    QCOMPARE(e.startTime, detector.eventLog().front().startTime);
+
+    // Urms(1/2) 창(1사이클) 때문에 시작/종료는 최대 한 사이클 늦음
+    const auto cycle = SampleInterval * SamplesPerCycle;
+    QVERIFY(e.startTime >= dipStart && e.startTime <= dipStart + cycle);
+    QVERIFY(e.duration >= cycle * 4 && e.duration <= cycle * 6);
+    QVERIFY(std::abs(e.extremePercent - 50.0) < 0.5);
+    QVERIFY(!detector.isEventActive());
+}
+
+void TestVoltageEventDetector::testHysteresisAndInterruption()
+{
+    VoltageEventDetector detector(1);
+    detector.setSamplesPerCycle(SamplesPerCycle);
+    detector.setNominalVoltage(0, Nominal);
+
+    std::vector<VoltageEvent> events;
+    detector.setEventCallback([&](const VoltageEvent& e) { events.push_back(e); });
+
+    feed(detector, 1.0, 5);
+    feed(detector, 0.89, 5);
+    QVERIFY(detector.isEventActive());
+
+    // 91%는 dip 임계값(90%) 위지만 히스테리시스(92%) 아래이므로 계속 진행
+    feed(detector, 0.91, 5);
+    QVERIFY(detector.isEventActive());
+    QVERIFY(events.empty());
+
+    // 5% 아래로 떨어지면 interruption으로 승격
+    feed(detector, 0.01, 5);
+    feed(detector, 1.0, 5);
+    QCOMPARE(events.size(), size_t(1));
+    QCOMPARE(events.front().type, VoltageEvent::Type::Interruption);
+    QVERIFY(events.front().extremePercent < 2.0);
+
+    // 스웰
+    feed(detector, 1.2, 5);
+    feed(detector, 1.0, 5);
+    QCOMPARE(events.size(), size_t(2));
+    QCOMPARE(events.back().type, VoltageEvent::Type::Swell);
+    QVERIFY(std::abs(events.back().extremePercent - 120.0) < 0.5);
+}
+
+QTEST_MAIN(TestVoltageEventDetector)
+#include "test_voltage_event_detector.moc"
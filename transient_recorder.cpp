@@ -0,0 +1,445 @@
+#include "transient_recorder.h"
+#include "config.h"
+#include <QByteArray>
+#include <QDebug>
+#include <QDir>
+#include <QFile>
+#include <QFileInfo>
+#include <algorithm>
+#include <bit>
+#include <cmath>
+#include <numbers>
+
+const char* TransientCapture::triggerName(Trigger trigger)
+{
+    switch(trigger) {
+    case Trigger::Waveshape: return "waveshape";
+    case Trigger::DvDt: return "dvdt";
+    case Trigger::RmsChange: return "rms-change";
+    case Trigger::External: return "external";
+    }
+    return "unknown";
+}
+
+TransientRecorder::TriggerSettings TransientRecorder::defaultTriggers()
+{
+    using C = config::Transient;
+    return { C::WaveshapeRatio, C::DvDtRatio, C::RmsChangeRatio, true, C::HoldoffSamples };
+}
+
+TransientRecorder::TransientRecorder()
+    : m_triggers(defaultTriggers())
+{
+    using C = config::Transient;
+    configure(C::PreTriggerSamples, C::PostTriggerSamples, C::PoolSize);
+}
+
+TransientRecorder::~TransientRecorder()
+{
+    stopWriter();
+}
+
+void TransientRecorder::configure(int preTriggerSamples, int postTriggerSamples, size_t poolSize)
+{
+    m_preTriggerSamples = std::max(preTriggerSamples, 1);
+    m_postTriggerSamples = std::max(postTriggerSamples, 1);
+    m_captureLength = m_preTriggerSamples + m_postTriggerSamples;
+
+    for(auto& ring : m_ring) {
+        ring.assign(m_preTriggerSamples, 0.0);
+    }
+    m_timeRing.assign(m_preTriggerSamples, Nanoseconds{0});
+    m_head = 0;
+    m_filled = 0;
+    m_holdoffLeft = 0;
+    m_active.clear();
+    m_active.reserve(poolSize);
+
+    // 기록 스레드가 쓰는 중인 버퍼를 해제하지 않도록 대기열을 비운 뒤 교체
+    flush();
+    std::lock_guard lock(m_mutex);
+    m_pool.clear();
+    m_free.clear();
+    m_free.reserve(poolSize);
+    for(size_t i = 0; i < poolSize; ++i) {
+        auto capture = std::make_unique<TransientCapture>();
+        capture->timestamps.resize(m_captureLength);
+        for(auto& channel : capture->samples) {
+            channel.resize(m_captureLength);
+        }
+        m_free.push_back(capture.get());
+        m_pool.push_back(std::move(capture));
+    }
+    m_ready.reserve(poolSize);
+}
+
+void TransientRecorder::setTriggers(const TriggerSettings& settings)
+{
+    m_triggers = settings;
+    updateLevels();
+}
+
+void TransientRecorder::setSamplesPerCycle(int samplesPerCycle)
+{
+    if(samplesPerCycle == m_samplesPerCycle) return;
+    m_samplesPerCycle = samplesPerCycle;
+    m_rms.configure(m_voltage.size(), samplesPerCycle);
+    for(auto& channel : m_voltage) {
+        channel.previousRms = 0.0;
+        channel.aboveWaveshape = false;
+        channel.aboveDvDt = false;
+    }
+
+    // 추적기가 샘플링 주파수를 바꿔도 한 주기가 들어가도록 여유 (사이클당 샘플 수의 2배 + 보간 탭)
+    const size_t capacity = samplesPerCycle > 0 ? std::bit_ceil(static_cast<size_t>(samplesPerCycle) * 2 + 4) : 0;
+    for(size_t ch = 0; ch < m_cycleRing.size(); ++ch) {
+        m_cycleRing[ch].assign(capacity, 0.0);
+        m_cycleDisturbed[ch].assign(capacity, 0);
+    }
+    m_cycleCount = 0;
+}
+
+void TransientRecorder::setFundamentalFrequency(double frequencyHz)
+{
+    m_frequency = frequencyHz;
+    updateLevels();
+}
+
+void TransientRecorder::setNominalVoltage(int channel, double nominalRms)
+{
+    if(channel >= 0 && channel < static_cast<int>(m_voltage.size())) {
+        m_voltage[channel].nominalRms = nominalRms;
+        updateLevels();
+    }
+}
+
+void TransientRecorder::updateLevels()
+{
+    // 비율 설정을 채널별 절대 레벨로 미리 바꿔 샘플 경로에서는 비교만 수행
+    for(auto& channel : m_voltage) {
+        const double peak = channel.nominalRms * std::numbers::sqrt2;
+        channel.waveshapeLevel = m_triggers.waveshape * peak;
+        channel.dvdtLevel = m_triggers.dvdt * 2.0 * std::numbers::pi * m_frequency * peak;
+        channel.rmsChangeLevel = m_triggers.rmsChange * channel.nominalRms;
+    }
+}
+
+void TransientRecorder::setCaptureSink(CaptureSink sink)
+{
+    stopWriter();
+    {
+        std::lock_guard lock(m_mutex);
+        m_sink = std::move(sink);
+        m_stopRequested = false;
+    }
+    if(m_sink) {
+        m_writerThread = std::thread(&TransientRecorder::writerLoop, this);
+    }
+}
+
+void TransientRecorder::triggerExternal()
+{
+    m_externalPending = true;
+}
+
+void TransientRecorder::process(Nanoseconds timestamp, const Frame& frame)
+{
+    using Trigger = TransientCapture::Trigger;
+
+    // 1. 트리거 판정 (에지에서만, 홀드오프 중에는 상태만 갱신)
+    Trigger trigger = Trigger::External;
+    int triggerChannel = -1;
+    bool triggered = false;
+
+    if(m_externalPending && m_triggers.external) {
+        triggered = true; // 외부 표식은 홀드오프와 무관
+    }
+    m_externalPending = false;
+
+    const auto fire = [&](Trigger type, int channel) {
+        if(!triggered && m_holdoffLeft == 0) {
+            triggered = true;
+            trigger = type;
+            triggerChannel = channel;
+        }
+    };
+
+    const long long dtNs = (timestamp - m_previousTime).count();
+    const size_t cycleCapacity = m_cycleRing[0].size();
+    const size_t mask = cycleCapacity - 1;
+    const uint64_t n = m_cycleCount;
+
+    // 한 주기 전 위치 n - period (분수)를 이웃한 두 샘플로 선형 보간
+    const double period = (m_hasPrevious && dtNs > 0 && m_frequency > 0.0) ? 1.0e9 / (m_frequency * dtNs) : 0.0;
+    const uint64_t whole = static_cast<uint64_t>(period);
+    const double fraction = period - whole;
+    const bool canCompare = period >= 2.0 && whole + 2 < cycleCapacity && n >= whole + 2;
+
+    for(int ch = 0; ch < static_cast<int>(m_voltage.size()); ++ch) {
+        VoltageChannel& channel = m_voltage[ch];
+        bool disturbed = false;
+
+        if(canCompare && channel.nominalRms > 0.0) {
+            const auto& ring = m_cycleRing[ch];
+            const auto& flags = m_cycleDisturbed[ch];
+            const auto at = [&](uint64_t back) { return ring[(n - back) & mask]; };
+
+            // 기준 샘플이 교란 구간이면 비교하지 않음 (교란이 한 주기 뒤 기준으로 되돌아와 다시 트리거되는 것 방지)
+            if(flags[(n - whole) & mask] | flags[(n - whole - 1) & mask] | flags[(n - whole - 2) & mask]) {
+                channel.aboveWaveshape = false;
+                channel.aboveDvDt = false;
+            } else {
+                const double reference = (1.0 - fraction) * at(whole) + fraction * at(whole + 1);
+                const double previousReference = (1.0 - fraction) * at(whole + 1) + fraction * at(whole + 2);
+
+                if(m_triggers.waveshape > 0.0) {
+                    const bool above = std::abs(frame[ch] - reference) > channel.waveshapeLevel;
+                    if(above && !channel.aboveWaveshape) fire(Trigger::Waveshape, ch);
+                    channel.aboveWaveshape = above;
+                    disturbed = above;
+                }
+                if(m_triggers.dvdt > 0.0) {
+                    // |Δv - Δv_ref| / Δt > 레벨  ->  |Δv - Δv_ref| * 1e9 > 레벨 * Δt(ns) (나눗셈 없이)
+                    const double change = (frame[ch] - at(1)) - (reference - previousReference);
+                    const bool above = std::abs(change) * 1.0e9 > channel.dvdtLevel * dtNs;
+                    if(above && !channel.aboveDvDt) fire(Trigger::DvDt, ch);
+                    channel.aboveDvDt = above;
+                    disturbed = disturbed || above;
+                }
+            }
+        }
+
+        if(cycleCapacity > 0) {
+            m_cycleRing[ch][n & mask] = frame[ch];
+            m_cycleDisturbed[ch][n & mask] = disturbed;
+        }
+    }
+    ++m_cycleCount;
+
+    if(m_triggers.rmsChange > 0.0 && m_samplesPerCycle > 0 && m_rms.process(std::span<const double>(frame.data(), m_voltage.size()))) {
+        const auto values = m_rms.values();
+        for(int ch = 0; ch < static_cast<int>(m_voltage.size()); ++ch) {
+            VoltageChannel& channel = m_voltage[ch];
+            if(channel.nominalRms > 0.0 && channel.previousRms > 0.0
+                && std::abs(values[ch] - channel.previousRms) > channel.rmsChangeLevel) {
+                fire(Trigger::RmsChange, ch);
+            }
+            channel.previousRms = values[ch];
+        }
+    }
+
+    if(m_holdoffLeft > 0) {
+        --m_holdoffLeft;
+    }
+    if(triggered) {
+        startCapture(timestamp, trigger, triggerChannel);
+    }
+
+    // 2. 진행 중인 캡처에 현재 샘플 추가 (트리거 샘플이 사후 구간의 첫 샘플)
+    for(size_t i = 0; i < m_active.size();) {
+        TransientCapture* capture = m_active[i];
+        const int index = capture->size++;
+        capture->timestamps[index] = timestamp;
+        for(size_t ch = 0; ch < frame.size(); ++ch) {
+            capture->samples[ch][index] = frame[ch];
+        }
+        if(capture->size == capture->preTriggerSamples + m_postTriggerSamples) {
+            m_active[i] = m_active.back();
+            m_active.pop_back();
+            completeCapture(capture);
+        } else {
+            ++i;
+        }
+    }
+
+    // 3. 사전 트리거 링 갱신
+    m_timeRing[m_head] = timestamp;
+    for(size_t ch = 0; ch < frame.size(); ++ch) {
+        m_ring[ch][m_head] = frame[ch];
+    }
+    m_head = (m_head + 1 == m_preTriggerSamples) ? 0 : m_head + 1;
+    m_filled = std::min(m_filled + 1, m_preTriggerSamples);
+
+    m_previousTime = timestamp;
+    m_hasPrevious = true;
+}
+
+void TransientRecorder::startCapture(Nanoseconds timestamp, TransientCapture::Trigger trigger, int channel)
+{
+    TransientCapture* capture = nullptr;
+    {
+        std::lock_guard lock(m_mutex);
+        if(m_free.empty()) {
+            ++m_droppedCount; // 기록이 밀려도 생성 루프는 대기하지 않음
+            return;
+        }
+        capture = m_free.back();
+        m_free.pop_back();
+    }
+    m_holdoffLeft = m_triggers.holdoffSamples;
+
+    capture->trigger = trigger;
+    capture->channel = channel;
+    capture->triggerTime = timestamp;
+    capture->preTriggerSamples = m_filled;
+    capture->size = m_filled;
+
+    // 링의 가장 오래된 샘플부터 두 구간으로 나눠 복사
+    const int start = (m_head - m_filled + m_preTriggerSamples) % m_preTriggerSamples;
+    const int firstPart = std::min(m_filled, m_preTriggerSamples - start);
+    const int secondPart = m_filled - firstPart;
+    const auto copyRing = [&](const auto& ring, auto& destination) {
+        std::copy_n(ring.begin() + start, firstPart, destination.begin());
+        std::copy_n(ring.begin(), secondPart, destination.begin() + firstPart);
+    };
+    copyRing(m_timeRing, capture->timestamps);
+    for(size_t ch = 0; ch < m_ring.size(); ++ch) {
+        copyRing(m_ring[ch], capture->samples[ch]);
+    }
+
+    m_active.push_back(capture);
+}
+
+void TransientRecorder::completeCapture(TransientCapture* capture)
+{
+    {
+        std::lock_guard lock(m_mutex);
+        ++m_capturedCount;
+        if(!m_sink) {
+            m_free.push_back(capture);
+            return;
+        }
+        m_ready.push_back(capture);
+    }
+    m_readyCondition.notify_one();
+}
+
+void TransientRecorder::flush()
+{
+    std::unique_lock lock(m_mutex);
+    m_flushedCondition.wait(lock, [this] { return m_ready.empty() && m_inFlight == 0; });
+}
+
+size_t TransientRecorder::capturedCount() const
+{
+    std::lock_guard lock(m_mutex);
+    return m_capturedCount;
+}
+
+size_t TransientRecorder::droppedCount() const
+{
+    std::lock_guard lock(m_mutex);
+    return m_droppedCount;
+}
+
+void TransientRecorder::writerLoop()
+{
+    std::vector<TransientCapture*> batch;
+    batch.reserve(m_pool.size());
+
+    while(true) {
+        {
+            std::unique_lock lock(m_mutex);
+            m_readyCondition.wait(lock, [this] { return m_stopRequested || !m_ready.empty(); });
+            if(m_ready.empty()) {
+                break; // 종료 요청이고 남은 캡처 없음
+            }
+            batch.swap(m_ready);
+            m_inFlight = batch.size();
+        }
+
+        for(const TransientCapture* capture : batch) {
+            try {
+                m_sink(*capture);
+            } catch(const std::exception& e) {
+                qWarning() << "TransientRecorder: Capture sink failed -" << e.what();
+            }
+        }
+
+        {
+            std::lock_guard lock(m_mutex);
+            m_free.insert(m_free.end(), batch.begin(), batch.end());
+            m_inFlight = 0;
+            if(m_ready.empty()) {
+                m_flushedCondition.notify_all();
+            }
+        }
+        batch.clear();
+    }
+    m_flushedCondition.notify_all();
+}
+
+void TransientRecorder::stopWriter()
+{
+    if(!m_writerThread.joinable()) {
+        return;
+    }
+    {
+        std::lock_guard lock(m_mutex);
+        m_stopRequested = true;
+    }
+    m_readyCondition.notify_one();
+    m_writerThread.join();
+}
+
+std::expected<void, QString> TransientRecorder::writeCsv(const TransientCapture& capture, const QString& path)
+{
+    QFile file(path);
+    if(!file.open(QIODevice::WriteOnly | QIODevice::Truncate)) {
+        return std::unexpected(QString("파일을 열 수 없습니다: %1").arg(file.errorString()));
+    }
+
+    QByteArray text;
+    text.reserve(capture.size * 96);
+    text += "# trigger=" + QByteArray(TransientCapture::triggerName(capture.trigger))
+          + " channel=" + QByteArray::number(capture.channel)
+          + " trigger_ns=" + QByteArray::number(static_cast<qlonglong>(capture.triggerTime.count()))
+          + " pre=" + QByteArray::number(capture.preTriggerSamples) + "\n";
+    text += "t_ns,va,vb,vc,ia,ib,ic\n";
+    for(int i = 0; i < capture.size; ++i) {
+        text += QByteArray::number(static_cast<qlonglong>(capture.timestamps[i].count()));
+        for(const auto& channel : capture.samples) {
+            text += ',' + QByteArray::number(channel[i], 'g', 10);
+        }
+        text += '\n';
+    }
+
+    if(file.write(text) != text.size()) {
+        return std::unexpected(QString("쓰기 실패: %1").arg(file.errorString()));
+    }
+    return {};
+}
+
+QString TransientRecorder::captureFileName(const QString& session, const TransientCapture& capture)
+{
+    return QString("transient_%1_%2_%3.csv")
+        .arg(session)
+        .arg(static_cast<qlonglong>(capture.triggerTime.count()), 20, 10, QChar('0'))
+        .arg(TransientCapture::triggerName(capture.trigger));
+}
+
+size_t TransientRecorder::enforceRetention(const QString& directory, size_t maxFiles, qint64 maxBytes)
+{
+    // 이름순 정렬 = 세션 시작 시각, 시뮬레이션 시각 순
+    const QFileInfoList files = QDir(directory).entryInfoList({"transient_*.csv"}, QDir::Files, QDir::Name);
+    qint64 totalBytes = 0;
+    for(const QFileInfo& file : files) {
+        totalBytes += file.size();
+    }
+
+    size_t remaining = static_cast<size_t>(files.size());
+    size_t removed = 0;
+    for(const QFileInfo& file : files) {
+        if(remaining <= maxFiles && totalBytes <= maxBytes) {
+            break;
+        }
+        if(!QFile::remove(file.absoluteFilePath())) {
+            qWarning() << "TransientRecorder: Cannot remove" << file.absoluteFilePath();
+            continue;
+        }
+        totalBytes -= file.size();
+        --remaining;
+        ++removed;
+    }
+    return removed;
+}
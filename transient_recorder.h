@@ -0,0 +1,153 @@
+#ifndef TRANSIENT_RECORDER_H
+#define TRANSIENT_RECORDER_H
+
+#include <QString>
+#include <array>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <expected>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <span>
+#include <thread>
+#include <vector>
+#include "voltage_event_detector.h"
+
+// 한 번의 트리거로 고정된 파형 (트리거 직전 preTriggerSamples개 + 트리거 샘플부터의 나머지)
+struct TransientCapture {
+    enum class Trigger { Waveshape, DvDt, RmsChange, External };
+    enum Channel { VoltageA, VoltageB, VoltageC, CurrentA, CurrentB, CurrentC, ChannelCount };
+
+    Trigger trigger = Trigger::External;
+    int channel = -1;                         // 트리거된 전압 채널 (External은 -1)
+    std::chrono::nanoseconds triggerTime{0};
+    int preTriggerSamples = 0;                // 링이 덜 찼으면 설정값보다 적을 수 있음
+    int size = 0;                             // 유효 샘플 수
+    std::vector<std::chrono::nanoseconds> timestamps;
+    std::array<std::vector<double>, ChannelCount> samples;
+
+    static const char* triggerName(Trigger trigger);
+};
+
+// TransientRecorder 클래스
+// m_data에서 밀려나기 전에 짧은 과도 현상을 캡처.
+// 파형/기울기 트리거는 고정 레벨이 아니라 한 주기 전 같은 위상의 값과 비교 (IEC 61000-4-30 파형 변화 방식)하므로
+// 공칭과 다른 진폭이나 정상 고조파 왜곡에는 반응하지 않고 주기 사이의 변화에만 반응.
+// 채널별 사전 트리거 링을 항상 채우다가 트리거가 걸리면 링을 캡처 버퍼로 복사하고
+// 이후 샘플을 덧붙여 고정된 길이가 되면 기록 스레드로 넘김.
+// 링과 캡처 버퍼는 configure()에서 모두 미리 할당하므로 샘플 경로에서는 할당이 없고,
+// 버퍼 풀이 바닥나면 대기하지 않고 해당 트리거를 버림 (생성 루프를 멈추지 않음).
+// 캡처는 서로 겹칠 수 있으므로 후속 트리거 구간 안의 재트리거도 별도 캡처가 됨.
+class TransientRecorder
+{
+public:
+    using Nanoseconds = std::chrono::nanoseconds;
+    using Frame = std::array<double, TransientCapture::ChannelCount>;
+    // 기록 스레드에서 호출. 반환 후 버퍼는 풀로 돌아가므로 보관하려면 복사
+    using CaptureSink = std::function<void(const TransientCapture&)>;
+
+    // 값은 공칭 전압 대비 비율. 0 이하이면 해당 트리거 비활성
+    struct TriggerSettings {
+        double waveshape;  // |v - 한 주기 전 v| > 비율 * 공칭 피크
+        double dvdt;       // |dv/dt - 한 주기 전 dv/dt| > 비율 * 공칭 기본파 최대 기울기
+        double rmsChange;
+        bool external;
+        int holdoffSamples;
+    };
+    static TriggerSettings defaultTriggers();
+
+    TransientRecorder();
+    ~TransientRecorder();
+
+    // 링/버퍼 재할당 (진행 중 캡처는 버림). 샘플 경로와 같은 스레드에서 호출
+    void configure(int preTriggerSamples, int postTriggerSamples, size_t poolSize);
+    void setTriggers(const TriggerSettings& settings);
+    void setSamplesPerCycle(int samplesPerCycle);        // 반주기 RMS 창과 한 주기 전 비교 이력 크기
+    void setFundamentalFrequency(double frequencyHz);   // 한 주기 전 비교 간격 (샘플 간격과 함께 사용)
+    void setNominalVoltage(int channel, double nominalRms);
+
+    // 싱크 설정 시 기록 스레드 시작. 싱크가 없으면 완료된 캡처는 개수만 세고 바로 반환
+    void setCaptureSink(CaptureSink sink);
+
+    // 샘플 한 프레임 입력 (전압 A/B/C, 전류 A/B/C)
+    void process(Nanoseconds timestamp, const Frame& frame);
+    // 외부 표식(시나리오 동작 등). 다음 샘플에서 트리거
+    void triggerExternal();
+
+    // 기록 대기 캡처를 모두 싱크에 넘길 때까지 대기 (종료, 테스트용)
+    void flush();
+
+    size_t capturedCount() const;
+    size_t droppedCount() const;
+    int activeCaptureCount() const { return static_cast<int>(m_active.size()); }
+
+    // 캡처를 CSV(t_ns, va, vb, vc, ia, ib, ic)로 저장
+    static std::expected<void, QString> writeCsv(const TransientCapture& capture, const QString& path);
+    // transient_<세션>_<시뮬레이션 ns (고정 폭)>_<트리거>.csv. 이름순이 곧 기록 순서
+    static QString captureFileName(const QString& session, const TransientCapture& capture);
+    // directory의 캡처 파일이 maxFiles개 또는 maxBytes를 넘으면 이름순으로 오래된 것부터 삭제. 삭제한 파일 수 반환
+    static size_t enforceRetention(const QString& directory, size_t maxFiles, qint64 maxBytes);
+
+private:
+    struct VoltageChannel {
+        double nominalRms = 0.0;
+        double waveshapeLevel = 0.0;  // 한 주기 전과의 차이 (V)
+        double dvdtLevel = 0.0;       // 한 주기 전과의 기울기 차이 (V/s)
+        double rmsChangeLevel = 0.0;  // 절대 V
+        double previousRms = 0.0;
+        bool aboveWaveshape = false;  // 에지 검출용 직전 상태
+        bool aboveDvDt = false;
+    };
+
+    void updateLevels();
+    void startCapture(Nanoseconds timestamp, TransientCapture::Trigger trigger, int channel);
+    void completeCapture(TransientCapture* capture);
+    void writerLoop();
+    void stopWriter();
+
+    int m_preTriggerSamples = 0;
+    int m_postTriggerSamples = 0;
+    int m_captureLength = 0;      // 버퍼 길이 (사전 + 사후)
+    int m_samplesPerCycle = 0;
+    double m_frequency = 0.0;
+    TriggerSettings m_triggers;
+
+    // 사전 트리거 링 (채널별 연속 배열)
+    std::array<std::vector<double>, TransientCapture::ChannelCount> m_ring;
+    std::vector<Nanoseconds> m_timeRing;
+    int m_head = 0;
+    int m_filled = 0;
+
+    std::array<VoltageChannel, 3> m_voltage;
+
+    // 한 주기 전 비교용 전압 이력 (크기 2의 거듭제곱, 샘플 i는 i & mask 위치).
+    // 교란으로 판정된 샘플은 표시해 두고 다음 주기의 기준으로 쓰지 않음 (같은 교란이 한 주기 뒤 다시 트리거되지 않도록)
+    std::array<std::vector<double>, 3> m_cycleRing;
+    std::array<std::vector<uint8_t>, 3> m_cycleDisturbed;
+    uint64_t m_cycleCount = 0;
+    HalfCycleRms m_rms;
+    Nanoseconds m_previousTime{0};
+    bool m_hasPrevious = false;
+    bool m_externalPending = false;
+    int m_holdoffLeft = 0;
+
+    std::vector<TransientCapture*> m_active; // 사후 샘플을 채우는 중 (샘플 경로 전용)
+
+    // 풀과 기록 대기열 (샘플 경로와 기록 스레드가 공유)
+    std::vector<std::unique_ptr<TransientCapture>> m_pool;
+    mutable std::mutex m_mutex;
+    std::condition_variable m_readyCondition;
+    std::condition_variable m_flushedCondition;
+    std::vector<TransientCapture*> m_free;
+    std::vector<TransientCapture*> m_ready;
+    size_t m_inFlight = 0;
+    size_t m_capturedCount = 0;
+    size_t m_droppedCount = 0;
+    bool m_stopRequested = false;
+    CaptureSink m_sink;
+    std::thread m_writerThread;
+};
+
+#endif // TRANSIENT_RECORDER_H
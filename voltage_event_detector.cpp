@@ -0,0 +1,211 @@
+#include "voltage_event_detector.h"
+#include "config.h"
+#include <algorithm>
+#include <cmath>
+
+// ---- HalfCycleRms ----
+
+void HalfCycleRms::configure(size_t channels, int samplesPerCycle)
+{
+    m_currentHalfSumSq.assign(channels, 0.0);
+    m_previousHalfSumSq.assign(channels, 0.0);
+    m_values.assign(channels, 0.0);
+
+    const int total = std::max(samplesPerCycle, 2);
+    m_halfLength[0] = total / 2;
+    m_halfLength[1] = total - total / 2;
+    reset();
+}
+
+void HalfCycleRms::reset()
+{
+    std::ranges::fill(m_currentHalfSumSq, 0.0);
+    std::ranges::fill(m_previousHalfSumSq, 0.0);
+    std::ranges::fill(m_values, 0.0);
+    m_halfIndex = 0;
+    m_count = 0;
+    m_previousCount = 0;
+}
+
+bool HalfCycleRms::process(std::span<const double> frame)
+{
+    const size_t channels = std::min(frame.size(), m_currentHalfSumSq.size());
+    double* sums = m_currentHalfSumSq.data();
+    for(size_t ch = 0; ch < channels; ++ch) {
+        sums[ch] += frame[ch] * frame[ch];
+    }
+
+    if(++m_count < m_halfLength[m_halfIndex]) {
+        return false;
+    }
+
+    // 반주기 종료: (직전 + 현재) 반주기로 한 사이클 RMS
+    const bool windowReady = m_previousCount > 0;
+    if(windowReady) {
+        const double inverseCount = 1.0 / (m_previousCount + m_count);
+        for(size_t ch = 0; ch < m_values.size(); ++ch) {
+            m_values[ch] = std::sqrt((m_previousHalfSumSq[ch] + m_currentHalfSumSq[ch]) * inverseCount);
+        }
+    }
+
+    m_previousHalfSumSq.swap(m_currentHalfSumSq);
+    std::ranges::fill(m_currentHalfSumSq, 0.0);
+    m_previousCount = m_count;
+    m_count = 0;
+    m_halfIndex ^= 1;
+    return windowReady;
+}
+
+// ---- VoltageEvent ----
+
+const char* VoltageEvent::typeName(Type type)
+{
+    switch(type) {
+    case Type::Dip: return "dip";
+    case Type::Swell: return "swell";
+    case Type::Interruption: return "interruption";
+    }
+    return "unknown";
+}
+
+// ---- VoltageEventDetector ----
+
+VoltageEventDetector::Thresholds VoltageEventDetector::defaultThresholds()
+{
+    using C = config::EventDetection;
+    return { C::DipThreshold, C::SwellThreshold, C::InterruptionThreshold, C::Hysteresis };
+}
+
+VoltageEventDetector::VoltageEventDetector(size_t channels)
+    : m_thresholds(defaultThresholds())
+{
+    setChannelCount(channels);
+}
+
+void VoltageEventDetector::setChannelCount(size_t channels)
+{
+    m_channels.assign(channels, Channel{});
+    m_activeCount = 0;
+    m_rms.configure(channels, m_samplesPerCycle);
+}
+
+void VoltageEventDetector::setSamplesPerCycle(int samplesPerCycle)
+{
+    if(samplesPerCycle == m_samplesPerCycle) return;
+    m_samplesPerCycle = samplesPerCycle;
+    m_rms.configure(m_channels.size(), samplesPerCycle);
+}
+
+void VoltageEventDetector::setNominalVoltage(size_t channel, double nominalRms)
+{
+    if(channel < m_channels.size()) {
+        m_channels[channel].nominal = nominalRms;
+    }
+}
+
+void VoltageEventDetector::setThresholds(const Thresholds& thresholds)
+{
+    m_thresholds = thresholds;
+}
+
+void VoltageEventDetector::setEventCallback(EventCallback callback)
+{
+    m_callback = std::move(callback);
+}
+
+void VoltageEventDetector::reset()
+{
+    for(auto& channel : m_channels) {
+        channel.state = State::Normal;
+    }
+    m_activeCount = 0;
+    m_rms.reset();
+}
+
+bool VoltageEventDetector::process(Nanoseconds timestamp, std::span<const double> frame)
+{
+    if(!m_rms.process(frame)) {
+        return false;
+    }
+
+    const auto values = m_rms.values();
+    for(size_t i = 0; i < m_channels.size(); ++i) {
+        updateChannel(i, timestamp, values[i]);
+    }
+    return true;
+}
+
+bool VoltageEventDetector::isEventActive() const
+{
+    return m_activeCount > 0;
+}
+
+void VoltageEventDetector::updateChannel(size_t index, Nanoseconds timestamp, double value)
+{
+    Channel& channel = m_channels[index];
+    if(channel.nominal <= 0.0) {
+        return; // 공칭 전압 미설정 채널은 감시하지 않음
+    }
+
+    const double ratio = value / channel.nominal;
+    const auto& t = m_thresholds;
+
+    switch(channel.state) {
+    case State::Normal:
+        if(ratio < t.interruption) {
+            channel.state = State::Interruption;
+        } else if(ratio < t.dip) {
+            channel.state = State::Dip;
+        } else if(ratio > t.swell) {
+            channel.state = State::Swell;
+        } else {
+            return;
+        }
+        channel.startTime = timestamp;
+        channel.extreme = value;
+        ++m_activeCount;
+        return;
+
+    case State::Dip:
+    case State::Interruption:
+        channel.extreme = std::min(channel.extreme, value);
+        if(ratio < t.interruption) {
+            channel.state = State::Interruption;
+        }
+        if(ratio >= t.dip + t.hysteresis) {
+            finishEvent(channel, index, timestamp);
+        }
+        return;
+
+    case State::Swell:
+        channel.extreme = std::max(channel.extreme, value);
+        if(ratio <= t.swell - t.hysteresis) {
+            finishEvent(channel, index, timestamp);
+        }
+        return;
+    }
+}
+
+void VoltageEventDetector::finishEvent(Channel& channel, size_t index, Nanoseconds endTime)
+{
+    VoltageEvent event;
+    event.type = (channel.state == State::Swell) ? VoltageEvent::Type::Swell
+               : (channel.state == State::Interruption) ? VoltageEvent::Type::Interruption
+                                                        : VoltageEvent::Type::Dip;
+    event.channel = static_cast<int>(index);
+    event.startTime = channel.startTime;
+    event.duration = endTime - channel.startTime;
+    event.extremeValue = channel.extreme;
+    event.extremePercent = channel.extreme / channel.nominal * 100.0;
+
+    channel.state = State::Normal;
+    --m_activeCount;
+
+    m_log.push_back(event);
+    if(m_log.size() > config::EventDetection::MaxLogSize) {
+        m_log.pop_front();
+    }
+    if(m_callback) {
+        m_callback(event);
+    }
+}
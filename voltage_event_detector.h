@@ -0,0 +1,114 @@
+#ifndef VOLTAGE_EVENT_DETECTOR_H
+#define VOLTAGE_EVENT_DETECTOR_H
+
+#include <QMetaType>
+#include <chrono>
+#include <deque>
+#include <functional>
+#include <span>
+#include <vector>
+
+// HalfCycleRms 클래스
+// IEC 61000-4-30 Urms(1/2): 한 사이클 창의 RMS를 반주기마다 갱신.
+// 반주기별 제곱합 두 개(직전 반주기, 현재 반주기)만 유지하므로 창을 다시 훑지 않고,
+// 뺄셈 없는 합이라 누적 오차도 생기지 않음. 채널은 연속 배열(SoA)로 처리.
+class HalfCycleRms
+{
+public:
+    // 채널 수와 사이클당 샘플 수 설정 (누적값 초기화)
+    void configure(size_t channels, int samplesPerCycle);
+    void reset();
+
+    // 채널별 샘플 한 프레임 입력. 새 Urms(1/2) 값이 나왔으면 true
+    bool process(std::span<const double> frame);
+
+    // 채널별 최근 Urms(1/2)
+    std::span<const double> values() const { return m_values; }
+    size_t channelCount() const { return m_values.size(); }
+
+private:
+    std::vector<double> m_currentHalfSumSq;
+    std::vector<double> m_previousHalfSumSq;
+    std::vector<double> m_values;
+    int m_halfLength[2] = {0, 0}; // 홀수 샘플 수일 때 두 반주기 길이가 다름
+    int m_halfIndex = 0;
+    int m_count = 0;              // 현재 반주기에 누적된 샘플 수
+    int m_previousCount = 0;      // 직전 반주기 샘플 수 (0이면 아직 창이 차지 않음)
+};
+
+// 검출된 전압 이벤트
+struct VoltageEvent {
+    enum class Type { Dip, Swell, Interruption };
+
+    Type type = Type::Dip;
+    int channel = 0;                         // 검출기 채널 번호
+    std::chrono::nanoseconds startTime{0};
+    std::chrono::nanoseconds duration{0};
+    double extremeValue = 0.0;               // 잔류 전압(dip/interruption, 최소 Urms(1/2)) 또는 최대 전압(swell)
+    double extremePercent = 0.0;             // 공칭 전압 대비 %
+
+    static const char* typeName(Type type);
+};
+Q_DECLARE_METATYPE(VoltageEvent)
+
+// VoltageEventDetector 클래스
+// 채널별 Urms(1/2)에 dip/swell/interruption 상태 기계를 적용.
+// 시작은 임계값을 넘은 반주기, 종료는 히스테리시스만큼 회복한 반주기.
+// dip 중 interruption 임계값 아래로 내려가면 같은 이벤트를 interruption으로 승격.
+// 샘플당 작업은 채널별 제곱 누적뿐이고, 상태 기계는 반주기마다 한 번만 실행.
+class VoltageEventDetector
+{
+public:
+    using Nanoseconds = std::chrono::nanoseconds;
+    using EventCallback = std::function<void(const VoltageEvent&)>;
+
+    // 공칭 전압 대비 비율
+    struct Thresholds {
+        double dip;
+        double swell;
+        double interruption;
+        double hysteresis;
+    };
+    static Thresholds defaultThresholds();
+
+    explicit VoltageEventDetector(size_t channels = 0);
+
+    void setChannelCount(size_t channels);
+    void setSamplesPerCycle(int samplesPerCycle);
+    void setNominalVoltage(size_t channel, double nominalRms);
+    void setThresholds(const Thresholds& thresholds);
+    void setEventCallback(EventCallback callback);
+    void reset(); // 진행 중 이벤트는 기록하지 않고 버림
+
+    // 샘플 한 프레임 입력. 반주기가 끝나 상태 기계가 진행되었으면 true
+    bool process(Nanoseconds timestamp, std::span<const double> frame);
+
+    // 어느 채널이든 이벤트 진행 중인지 (집계 구간 플래그용)
+    bool isEventActive() const;
+
+    const HalfCycleRms& halfCycleRms() const { return m_rms; }
+    const std::deque<VoltageEvent>& eventLog() const { return m_log; }
+
+private:
+    enum class State { Normal, Dip, Swell, Interruption };
+
+    struct Channel {
+        double nominal = 0.0;
+        State state = State::Normal;
+        Nanoseconds startTime{0};
+        double extreme = 0.0;
+    };
+
+    void updateChannel(size_t index, Nanoseconds timestamp, double value);
+    void finishEvent(Channel& channel, size_t index, Nanoseconds endTime);
+
+    HalfCycleRms m_rms;
+    std::vector<Channel> m_channels;
+    Thresholds m_thresholds;
+    int m_samplesPerCycle = 0;
+    int m_activeCount = 0;
+    EventCallback m_callback;
+    std::deque<VoltageEvent> m_log;
+};
+
+#endif // VOLTAGE_EVENT_DETECTOR_H